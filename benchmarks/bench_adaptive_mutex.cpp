@@ -0,0 +1,72 @@
+// Contended counter increments under std::mutex, a test-and-set spinlock and
+// core::AdaptiveMutex.
+// Usage: bench_adaptive_mutex [threads] [increments per thread]
+
+#include "bench_common.hpp"
+#include "core/adaptive_mutex.hpp"
+#include "core/cpu_relax.hpp"
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+class SpinLock {
+public:
+    void lock() {
+        while (flag_.exchange(true, std::memory_order_acquire)) {
+            while (flag_.load(std::memory_order_relaxed)) {
+                core::cpuRelax();
+            }
+        }
+    }
+    void unlock() { flag_.store(false, std::memory_order_release); }
+
+private:
+    std::atomic<bool> flag_{false};
+};
+
+template<typename Mutex>
+double run(Mutex& mtx, std::size_t threads, std::size_t increments) {
+    std::uint64_t counter = 0;
+    return bench::timeSeconds([&] {
+        std::vector<std::thread> workers;
+        for (std::size_t t = 0; t < threads; ++t) {
+            workers.emplace_back([&] {
+                for (std::size_t i = 0; i < increments; ++i) {
+                    std::lock_guard<Mutex> lock(mtx);
+                    ++counter;
+                }
+            });
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    });
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t threads = bench::argCount(argc, argv, 1, std::thread::hardware_concurrency());
+    const std::size_t increments = bench::argCount(argc, argv, 2, 1'000'000);
+    const double ops = static_cast<double>(threads * increments);
+
+    std::cout << threads << " threads x " << increments << " increments\n";
+
+    std::mutex stdMutex;
+    bench::report("std::mutex", ops / run(stdMutex, threads, increments) / 1e6, "Mops/s");
+
+    SpinLock spinLock;
+    bench::report("spinlock", ops / run(spinLock, threads, increments) / 1e6, "Mops/s");
+
+    core::AdaptiveMutex adaptive;
+    bench::report("core::AdaptiveMutex", ops / run(adaptive, threads, increments) / 1e6, "Mops/s");
+
+    auto stats = adaptive.stats();
+    std::cout << "  contended=" << stats.contended << " spinAcquired=" << stats.spinAcquired
+              << " parked=" << stats.parked << " spinLimit=" << stats.spinLimit << "\n";
+    return 0;
+}
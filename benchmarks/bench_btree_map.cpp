@@ -0,0 +1,99 @@
+// Compares std::map with core::BTreeMap on random 64-bit keys: inserts,
+// point lookups (hits), range iteration and bulk loading from sorted input.
+// Two node sizes are measured to show the effect of NodeBytes.
+// Usage: bench_btree_map [count]   (default 10^6)
+
+#include "bench_common.hpp"
+#include "core/btree_map.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+template<typename Map>
+void measure(const std::string& name, const std::vector<std::uint64_t>& keys,
+             const std::vector<std::uint64_t>& probes) {
+    const auto n = static_cast<double>(keys.size());
+    Map map;
+    double seconds = bench::timeSeconds([&] {
+        for (std::uint64_t key : keys) {
+            map.try_emplace(key, key);
+        }
+    });
+    bench::report(name + " insert", seconds * 1e9 / n, "ns/op");
+
+    std::uint64_t checksum = 0;
+    seconds = bench::timeSeconds([&] {
+        for (std::uint64_t key : probes) {
+            checksum += map.find(key)->second;
+        }
+    });
+    bench::report(name + " lookup", seconds * 1e9 / n, "ns/op");
+
+    // Range iteration: 1000 scans of about 1000 entries each, from lower_bound
+    constexpr std::size_t kScans = 1000;
+    const std::uint64_t width = (~std::uint64_t{0} / keys.size()) * 1000;
+    std::size_t visited = 0;
+    seconds = bench::timeSeconds([&] {
+        for (std::size_t i = 0; i < kScans; ++i) {
+            const std::uint64_t from = probes[i];
+            const std::uint64_t to = from + std::min(width, ~from);
+            for (auto it = map.lower_bound(from); it != map.end() && it->first < to; ++it) {
+                checksum += it->second;
+                ++visited;
+            }
+        }
+    });
+    bench::report(name + " range iterate", seconds * 1e9 / static_cast<double>(visited),
+                  "ns/element");
+    bench::doNotOptimize(checksum);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t count = bench::argCount(argc, argv, 1, 1'000'000);
+
+    std::vector<std::uint64_t> keys(count);
+    std::mt19937_64 rng(42);
+    for (auto& key : keys) {
+        key = rng();
+    }
+    std::vector<std::uint64_t> probes = keys;
+    std::shuffle(probes.begin(), probes.end(), rng);
+
+    std::cout << count << " random uint64 -> uint64 entries\n";
+    measure<std::map<std::uint64_t, std::uint64_t>>("std::map", keys, probes);
+    measure<core::BTreeMap<std::uint64_t, std::uint64_t, std::less<>, 256>>(
+        "BTreeMap<256B nodes>", keys, probes);
+    measure<core::BTreeMap<std::uint64_t, std::uint64_t>>("BTreeMap<1KiB nodes>", keys, probes);
+
+    // Bulk load from sorted pairs against building std::map from the same input
+    std::vector<std::pair<std::uint64_t, std::uint64_t>> sorted;
+    sorted.reserve(count);
+    for (std::uint64_t key : keys) {
+        sorted.emplace_back(key, key);
+    }
+    std::sort(sorted.begin(), sorted.end());
+    sorted.erase(std::unique(sorted.begin(), sorted.end()), sorted.end());
+
+    const auto n = static_cast<double>(sorted.size());
+    std::size_t built = 0;
+    double seconds = bench::timeSeconds([&] {
+        std::map<std::uint64_t, std::uint64_t> map(sorted.begin(), sorted.end());
+        built += map.size();
+    });
+    bench::report("std::map from sorted", seconds * 1e9 / n, "ns/element");
+    seconds = bench::timeSeconds([&] {
+        core::BTreeMap<std::uint64_t, std::uint64_t> map(core::sorted_unique, sorted.begin(),
+                                                         sorted.end());
+        built += map.size();
+    });
+    bench::report("BTreeMap bulk load", seconds * 1e9 / n, "ns/element");
+    bench::doNotOptimize(built);
+    return 0;
+}
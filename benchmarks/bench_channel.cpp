@@ -0,0 +1,98 @@
+// Message throughput: core::Channel between coroutines versus a bounded
+// mutex/condition_variable queue between two threads.
+// Usage: bench_channel [messages] [capacity]
+
+#include "bench_common.hpp"
+#include "core/channel.hpp"
+#include "core/task.hpp"
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace {
+
+class CondvarQueue {
+public:
+    explicit CondvarQueue(std::size_t capacity) : capacity_(capacity) {}
+
+    void push(std::uint64_t value) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        notFull_.wait(lock, [this] { return items_.size() < capacity_; });
+        items_.push_back(value);
+        notEmpty_.notify_one();
+    }
+
+    std::uint64_t pop() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        notEmpty_.wait(lock, [this] { return !items_.empty(); });
+        const std::uint64_t value = items_.front();
+        items_.pop_front();
+        notFull_.notify_one();
+        return value;
+    }
+
+private:
+    std::size_t capacity_;
+    std::deque<std::uint64_t> items_;
+    std::mutex mutex_;
+    std::condition_variable notEmpty_;
+    std::condition_variable notFull_;
+};
+
+core::Task producer(core::Channel<std::uint64_t>& channel, std::size_t messages) {
+    for (std::uint64_t i = 0; i < messages; ++i) {
+        co_await channel.send(i);
+    }
+    channel.close();
+}
+
+core::Task consumer(core::Channel<std::uint64_t>& channel, std::uint64_t& sum) {
+    while (auto value = co_await channel.receive()) {
+        sum += *value;
+    }
+}
+
+double channelRate(std::size_t messages, std::size_t capacity) {
+    core::Channel<std::uint64_t> channel(capacity);
+    std::uint64_t sum = 0;
+    const double seconds = bench::timeSeconds([&] {
+        auto consume = consumer(channel, sum);
+        auto produce = producer(channel, messages);
+        produce.get();
+        consume.get();
+    });
+    bench::doNotOptimize(sum);
+    return static_cast<double>(messages) / seconds;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t messages = bench::argCount(argc, argv, 1, 5'000'000);
+    const std::size_t capacity = bench::argCount(argc, argv, 2, 64);
+
+    std::cout << messages << " messages, capacity " << capacity << "\n";
+
+    CondvarQueue queue(capacity);
+    std::uint64_t sum = 0;
+    const double condvarSeconds = bench::timeSeconds([&] {
+        std::thread producerThread([&] {
+            for (std::uint64_t i = 0; i < messages; ++i) {
+                queue.push(i);
+            }
+        });
+        for (std::size_t i = 0; i < messages; ++i) {
+            sum += queue.pop();
+        }
+        producerThread.join();
+    });
+    bench::doNotOptimize(sum);
+    bench::report("mutex/condvar queue (2 threads)",
+                  static_cast<double>(messages) / condvarSeconds / 1e6, "Mmsg/s");
+
+    bench::report("core::Channel buffered", channelRate(messages, capacity) / 1e6, "Mmsg/s");
+    bench::report("core::Channel unbuffered", channelRate(messages, 0) / 1e6, "Mmsg/s");
+    return 0;
+}
@@ -0,0 +1,53 @@
+/**
+ * @file bench_common.hpp
+ * @brief Minimal timing helpers shared by the benchmark executables
+ *
+ * Benchmarks are plain executables that print one line per measurement.
+ * Build them in Release mode for meaningful numbers.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+namespace bench {
+
+/// Runs @p func once and returns the elapsed wall time in seconds.
+template<typename Func>
+double timeSeconds(Func&& func) {
+    auto start = std::chrono::steady_clock::now();
+    func();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(end - start).count();
+}
+
+/// Reads a positive count from argv[index], falling back to @p fallback.
+inline std::size_t argCount(int argc, char** argv, int index, std::size_t fallback) {
+    if (argc > index) {
+        return static_cast<std::size_t>(std::strtoull(argv[index], nullptr, 10));
+    }
+    return fallback;
+}
+
+/// Prints "label: value unit" with aligned columns.
+inline void report(const std::string& label, double value, const std::string& unit) {
+    std::cout << std::left << std::setw(40) << label << std::right << std::setw(12)
+              << std::fixed << std::setprecision(3) << value << " " << unit << "\n";
+}
+
+/// Keeps the optimizer from discarding a computed value.
+template<typename T>
+void doNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &value;
+#endif
+}
+
+}  // namespace bench
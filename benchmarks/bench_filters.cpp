@@ -0,0 +1,115 @@
+// Negative-lookup filters in front of a hash set: core::BloomFilter and
+// core::CuckooFilter are built for N random keys at several target
+// false-positive rates. For each rate the benchmark reports the measured
+// rate, bits per key, and queries per second for keys that are present
+// and keys that are absent, next to std::unordered_set lookups of the
+// same keys. Absent-key queries are the case the filters exist for.
+// Usage: bench_filters [keys]   (default 10^6)
+
+#include "bench_common.hpp"
+#include "core/bloom_filter.hpp"
+#include "core/cuckoo_filter.hpp"
+#include "core/simd.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <sstream>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace {
+
+/// Best of three runs of @p query over @p keys, in million queries per second.
+template<typename Query>
+double queriesPerSecond(const std::vector<std::uint64_t>& keys, Query query,
+                        std::size_t& hits) {
+    double best = 1e30;
+    for (int run = 0; run < 3; ++run) {
+        hits = 0;
+        best = std::min(best, bench::timeSeconds([&] {
+            for (std::uint64_t key : keys) {
+                hits += query(key);
+            }
+        }));
+    }
+    bench::doNotOptimize(hits);
+    return static_cast<double>(keys.size()) / best / 1e6;
+}
+
+template<typename Query>
+void reportQueries(const std::string& label, const std::vector<std::uint64_t>& present,
+                   const std::vector<std::uint64_t>& absent, Query query) {
+    std::size_t hits = 0;
+    bench::report(label + " present", queriesPerSecond(present, query, hits), "Mq/s");
+    bench::report(label + " absent", queriesPerSecond(absent, query, hits), "Mq/s");
+    bench::report(label + " measured FPR", 100.0 * static_cast<double>(hits) /
+                                               static_cast<double>(absent.size()),
+                  "%");
+}
+
+std::string rateLabel(double rate) {
+    std::ostringstream out;
+    out << rate;
+    return out.str();
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t n = bench::argCount(argc, argv, 1, 1'000'000);
+
+    // Distinct random keys; the second half is never inserted
+    std::mt19937_64 rng(7);
+    std::unordered_set<std::uint64_t> unique;
+    while (unique.size() < 2 * n) {
+        unique.insert(rng());
+    }
+    std::vector<std::uint64_t> keys(unique.begin(), unique.end());
+    std::shuffle(keys.begin(), keys.end(), rng);
+    const std::vector<std::uint64_t> present(keys.begin(), keys.begin() + n);
+    const std::vector<std::uint64_t> absent(keys.begin() + n, keys.end());
+
+    const std::unordered_set<std::uint64_t> set(present.begin(), present.end());
+    reportQueries("unordered_set", present, absent,
+                  [&](std::uint64_t key) { return set.count(key) != 0; });
+    bench::report("unordered_set bits/key",
+                  static_cast<double>(set.bucket_count() * sizeof(void*) +
+                                      set.size() * (2 * sizeof(void*) + sizeof(std::uint64_t))) *
+                      8.0 / static_cast<double>(n),
+                  "bits");
+
+    for (double target : {0.1, 0.01, 0.001, 0.0001}) {
+        const std::string rate = rateLabel(target);
+
+        core::BloomFilter bloom(n, target);
+        for (std::uint64_t key : present) {
+            bloom.insertHash(key);
+        }
+        bench::report("bloom " + rate + " bits/key", bloom.bitsPerKey(), "bits");
+        reportQueries("bloom " + rate, present, absent,
+                      [&](std::uint64_t key) { return bloom.mayContainHash(key); });
+
+        // The scalar path shows what the vector bit test buys
+        const core::simd::Level level = core::simd::activeLevel();
+        core::simd::setLevel(core::simd::Level::kScalar);
+        core::BloomFilter scalar(n, target);
+        core::simd::setLevel(level);
+        for (std::uint64_t key : present) {
+            scalar.insertHash(key);
+        }
+        reportQueries("bloom scalar " + rate, present, absent,
+                      [&](std::uint64_t key) { return scalar.mayContainHash(key); });
+
+        core::CuckooFilter cuckoo(n, target);
+        for (std::uint64_t key : present) {
+            cuckoo.insertHash(key);
+        }
+        bench::report("cuckoo " + rate + " bits/key",
+                      static_cast<double>(cuckoo.memoryBytes()) * 8.0 / static_cast<double>(n),
+                      "bits");
+        reportQueries("cuckoo " + rate, present, absent,
+                      [&](std::uint64_t key) { return cuckoo.containsHash(key); });
+    }
+    return 0;
+}
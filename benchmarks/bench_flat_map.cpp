@@ -0,0 +1,74 @@
+// core::FlatMap versus std::map on a read-heavy table: bulk build, random
+// successful lookups and a full iteration, for a small and a large table.
+// Usage: bench_flat_map [lookups]
+
+#include "bench_common.hpp"
+#include "core/flat_map.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+template<typename Map>
+void run(const std::string& name, const std::vector<std::uint64_t>& keys,
+         const std::vector<std::uint64_t>& probes) {
+    Map map;
+    const double buildSeconds = bench::timeSeconds([&] {
+        if constexpr (std::is_same_v<Map, std::map<std::uint64_t, std::uint64_t>>) {
+            for (std::uint64_t key : keys) {
+                map.emplace(key, key);
+            }
+        } else {
+            map = Map(keys, keys);  // one sort + dedupe
+        }
+    });
+
+    std::uint64_t sum = 0;
+    const double lookupSeconds = bench::timeSeconds([&] {
+        for (std::uint64_t key : probes) {
+            sum += map.find(key)->second;
+        }
+    });
+    const double iterateSeconds = bench::timeSeconds([&] {
+        for (const auto& [key, value] : map) {
+            sum += value;
+        }
+    });
+    bench::doNotOptimize(sum);
+
+    const auto count = static_cast<double>(keys.size());
+    bench::report(name + " build", buildSeconds * 1e9 / count, "ns/element");
+    bench::report(name + " lookup", lookupSeconds * 1e9 / static_cast<double>(probes.size()),
+                  "ns/op");
+    bench::report(name + " iterate", iterateSeconds * 1e9 / count, "ns/element");
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t lookups = bench::argCount(argc, argv, 1, 2'000'000);
+    std::mt19937_64 rng(1);
+
+    for (std::size_t size : {std::size_t{1000}, std::size_t{1'000'000}}) {
+        std::vector<std::uint64_t> keys(size);
+        std::iota(keys.begin(), keys.end(), std::uint64_t{0});
+        for (auto& key : keys) {
+            key *= 0x9E3779B97F4A7C15ull;
+        }
+        std::shuffle(keys.begin(), keys.end(), rng);
+        std::vector<std::uint64_t> probes(lookups);
+        for (auto& probe : probes) {
+            probe = keys[rng() % size];
+        }
+
+        const std::string suffix = " (" + std::to_string(size) + ")";
+        run<std::map<std::uint64_t, std::uint64_t>>("std::map" + suffix, keys, probes);
+        run<core::FlatMap<std::uint64_t, std::uint64_t>>("core::FlatMap" + suffix, keys, probes);
+    }
+    return 0;
+}
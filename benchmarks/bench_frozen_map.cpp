@@ -0,0 +1,125 @@
+// Lookups in a fixed table of 32 C++ keywords → token id, four ways:
+// - core::FrozenMap: constexpr perfect hash, built at compile time
+// - std::unordered_map and std::map, filled at startup
+// - an if-chain comparing against each keyword in turn, the way such
+//   tables are often written by hand
+// The word stream is half keywords, half identifiers that miss. Also
+// reports what filling the unordered_map costs, which FrozenMap never pays.
+// Usage: bench_frozen_map [lookups]   (default 10^7)
+
+#include "bench_common.hpp"
+#include "core/frozen_map.hpp"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace {
+
+constexpr std::array<std::string_view, 32> kWords = {
+    "alignas", "auto",     "bool",     "break",    "case",      "catch",    "char",
+    "class",   "const",    "continue", "default",  "delete",    "do",       "double",
+    "else",    "enum",     "explicit", "extern",   "false",     "float",    "for",
+    "if",      "inline",   "int",      "namespace", "new",      "private",  "return",
+    "struct",  "template", "true",     "while"};
+
+constexpr auto kFrozen = [] {
+    std::array<std::pair<std::string_view, int>, kWords.size()> entries{};
+    for (std::size_t i = 0; i < kWords.size(); ++i) {
+        entries[i] = {kWords[i], static_cast<int>(i)};
+    }
+    return core::FrozenMap<std::string_view, int, kWords.size()>(entries);
+}();
+
+int ifChain(std::string_view word) {
+    for (std::size_t i = 0; i < kWords.size(); ++i) {
+        if (word == kWords[i]) {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+
+/// Best of three timings over the whole word stream, reported per lookup.
+template<typename Lookup>
+void measure(const std::string& label, const std::vector<std::string_view>& stream,
+             Lookup lookup) {
+    long long checksum = 0;
+    for (std::string_view w : stream) {
+        checksum += lookup(w);  // warm-up
+    }
+    double best = 1e30;
+    for (int attempt = 0; attempt < 3; ++attempt) {
+        best = std::min(best, bench::timeSeconds([&] {
+            for (std::string_view w : stream) {
+                checksum += lookup(w);
+            }
+        }));
+    }
+    bench::doNotOptimize(checksum);
+    bench::report(label, best * 1e9 / static_cast<double>(stream.size()), "ns/lookup");
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t n = bench::argCount(argc, argv, 1, 10'000'000);
+
+    std::vector<std::string> misses;
+    for (std::string_view w : kWords) {
+        misses.push_back(std::string(w) + "_");
+        misses.push_back("my" + std::string(w));
+    }
+    std::vector<std::string_view> stream(n);
+    std::uint64_t state = 0x9e3779b97f4a7c15ULL;
+    for (std::size_t i = 0; i < n; ++i) {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        const std::size_t r = static_cast<std::size_t>(state >> 33);
+        stream[i] = (r & 1) != 0 ? kWords[(r >> 1) % kWords.size()]
+                                 : std::string_view(misses[(r >> 1) % misses.size()]);
+    }
+
+    std::unordered_map<std::string_view, int> hashed;
+    std::map<std::string_view, int> ordered;
+    for (std::size_t i = 0; i < kWords.size(); ++i) {
+        hashed.emplace(kWords[i], static_cast<int>(i));
+        ordered.emplace(kWords[i], static_cast<int>(i));
+    }
+
+    measure("core::FrozenMap", stream, [](std::string_view w) {
+        auto it = kFrozen.find(w);
+        return it == kFrozen.end() ? -1 : it->second;
+    });
+    measure("std::unordered_map", stream, [&](std::string_view w) {
+        auto it = hashed.find(w);
+        return it == hashed.end() ? -1 : it->second;
+    });
+    measure("std::map", stream, [&](std::string_view w) {
+        auto it = ordered.find(w);
+        return it == ordered.end() ? -1 : it->second;
+    });
+    measure("if-chain", stream, ifChain);
+
+    const int builds = 100'000;
+    double best = 1e30;
+    for (int attempt = 0; attempt < 3; ++attempt) {
+        best = std::min(best, bench::timeSeconds([&] {
+            for (int b = 0; b < builds; ++b) {
+                std::unordered_map<std::string_view, int> table;
+                for (std::size_t i = 0; i < kWords.size(); ++i) {
+                    table.emplace(kWords[i], static_cast<int>(i));
+                }
+                bench::doNotOptimize(table.size());
+            }
+        }));
+    }
+    bench::report("std::unordered_map build", best * 1e9 / builds, "ns/table");
+    bench::report("core::FrozenMap build", 0.0, "ns/table (compile time)");
+    return 0;
+}
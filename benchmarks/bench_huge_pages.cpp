@@ -0,0 +1,151 @@
+// Random reads over a large table on 4 KiB pages versus core::HugePageResource.
+// dTLB load misses come from perf_event_open when the kernel allows it
+// (perf_event_paranoid <= 2 for user-space counting); otherwise "n/a".
+// Usage: bench_huge_pages [table MiB] [reads]
+
+#include "bench_common.hpp"
+#include "core/huge_page_resource.hpp"
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+/// dTLB read-miss counter for the calling thread; invalid when perf is unavailable.
+class TlbMissCounter {
+public:
+    TlbMissCounter() {
+#if defined(__linux__)
+        perf_event_attr attr{};
+        attr.type = PERF_TYPE_HW_CACHE;
+        attr.size = sizeof(attr);
+        attr.config = PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                      (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        fd_ = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+#endif
+    }
+
+    ~TlbMissCounter() {
+#if defined(__linux__)
+        if (fd_ >= 0) {
+            close(fd_);
+        }
+#endif
+    }
+
+    TlbMissCounter(const TlbMissCounter&) = delete;
+    TlbMissCounter& operator=(const TlbMissCounter&) = delete;
+
+    bool valid() const { return fd_ >= 0; }
+
+    void start() {
+#if defined(__linux__)
+        if (valid()) {
+            ioctl(fd_, PERF_EVENT_IOC_RESET, 0);
+            ioctl(fd_, PERF_EVENT_IOC_ENABLE, 0);
+        }
+#endif
+    }
+
+    std::uint64_t stop() {
+        std::uint64_t count = 0;
+#if defined(__linux__)
+        if (valid()) {
+            ioctl(fd_, PERF_EVENT_IOC_DISABLE, 0);
+            if (read(fd_, &count, sizeof(count)) != static_cast<ssize_t>(sizeof(count))) {
+                count = 0;
+            }
+        }
+#endif
+        return count;
+    }
+
+private:
+    int fd_ = -1;
+};
+
+void randomReads(const std::string& name, const std::uint64_t* table, std::size_t entries,
+                 std::size_t reads) {
+    TlbMissCounter misses;
+    std::uint64_t state = 0x9E3779B97F4A7C15ull;
+    std::uint64_t sum = 0;
+    misses.start();
+    const double seconds = bench::timeSeconds([&] {
+        for (std::size_t i = 0; i < reads; ++i) {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            sum += table[state & (entries - 1)];
+        }
+    });
+    const std::uint64_t missCount = misses.stop();
+    bench::doNotOptimize(sum);
+
+    bench::report(name + " read", seconds * 1e9 / static_cast<double>(reads), "ns/read");
+    if (misses.valid()) {
+        bench::report(name + " dTLB misses",
+                      static_cast<double>(missCount) / static_cast<double>(reads), "per read");
+    } else {
+        std::cout << name << " dTLB misses: n/a (perf_event_open unavailable)\n";
+    }
+    bench::report(name + " on huge pages",
+                  static_cast<double>(core::HugePageResource::hugeBytesAt(table)) / (1 << 20),
+                  "MiB");
+}
+
+void fill(std::uint64_t* table, std::size_t entries) {
+    for (std::size_t i = 0; i < entries; ++i) {
+        table[i] = i;
+    }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    std::size_t mebibytes = bench::argCount(argc, argv, 1, 512);
+    const std::size_t reads = bench::argCount(argc, argv, 2, 20'000'000);
+
+    // Power-of-two entry count so the index is a mask
+    std::size_t entries = 1;
+    while (entries * 2 * sizeof(std::uint64_t) <= (mebibytes << 20)) {
+        entries *= 2;
+    }
+    const std::size_t bytes = entries * sizeof(std::uint64_t);
+    mebibytes = bytes >> 20;
+    std::cout << "table: " << mebibytes << " MiB, " << reads << " random reads\n";
+
+#if defined(__linux__)
+    // Baseline: the same table with huge pages explicitly refused
+    void* regular = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS,
+                         -1, 0);
+    if (regular == MAP_FAILED) {
+        std::cerr << "mmap failed\n";
+        return 1;
+    }
+    madvise(regular, bytes, MADV_NOHUGEPAGE);
+    fill(static_cast<std::uint64_t*>(regular), entries);
+    randomReads("4 KiB pages", static_cast<const std::uint64_t*>(regular), entries, reads);
+    munmap(regular, bytes);
+#endif
+
+    core::HugePageResource resource;
+    void* huge = resource.allocate(bytes, alignof(std::uint64_t));
+    fill(static_cast<std::uint64_t*>(huge), entries);
+    randomReads("HugePageResource", static_cast<const std::uint64_t*>(huge), entries, reads);
+    resource.deallocate(huge, bytes, alignof(std::uint64_t));
+
+    resource.writeReport(std::cout);
+    return 0;
+}
@@ -0,0 +1,191 @@
+// Scheduler-style workload: a queue of live tasks keyed by deadline
+// (earliest first) receives a random mix of push, pop and reschedule
+// operations. std::priority_queue cannot reschedule, so it pushes a new
+// entry and skips stale ones on pop, as a scheduler built on it does.
+// core::IndexedHeap updates in place; it is measured with 2, 4 and 8
+// children per node.
+// Usage: bench_indexed_heap [tasks]   (default 10^5 live tasks, 10x as many operations)
+
+#include "bench_common.hpp"
+#include "core/indexed_heap.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <queue>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+enum class Op : std::uint8_t { kPush, kPop, kUpdate };
+
+struct Step {
+    Op op;
+    std::uint32_t pick;      ///< which live task to reschedule
+    std::uint64_t deadline;  ///< new or initial deadline
+};
+
+std::vector<Step> makeSteps(std::size_t count, int updatePercent, std::uint32_t seed) {
+    std::mt19937_64 rng(seed);
+    std::vector<Step> steps(count);
+    for (Step& step : steps) {
+        const int roll = static_cast<int>(rng() % 100);
+        // Pushes and pops stay balanced so the queue keeps its size
+        step.op = roll < updatePercent                          ? Op::kUpdate
+                  : roll < updatePercent + (100 - updatePercent) / 2 ? Op::kPush
+                                                                     : Op::kPop;
+        step.pick = static_cast<std::uint32_t>(rng());
+        step.deadline = rng() % 1'000'000'000;
+    }
+    return steps;
+}
+
+/// Live task ids with O(1) random pick and removal; shared by both contenders.
+struct LiveTasks {
+    std::vector<std::uint32_t> ids;
+    std::vector<std::uint32_t> index;  ///< task id -> position in ids
+    std::vector<std::uint32_t> spare;  ///< finished ids, reused by pushes
+
+    std::uint32_t create() {
+        std::uint32_t id;
+        if (!spare.empty()) {
+            id = spare.back();
+            spare.pop_back();
+        } else {
+            id = static_cast<std::uint32_t>(index.size());
+            index.push_back(0);
+        }
+        index[id] = static_cast<std::uint32_t>(ids.size());
+        ids.push_back(id);
+        return id;
+    }
+
+    void finish(std::uint32_t id) {
+        const std::uint32_t position = index[id];
+        ids[position] = ids.back();
+        index[ids[position]] = position;
+        ids.pop_back();
+        spare.push_back(id);
+    }
+};
+
+template<std::size_t D>
+std::uint64_t runIndexedHeap(std::size_t tasks, const std::vector<Step>& steps) {
+    using Heap = core::IndexedHeap<std::uint32_t, std::uint64_t, D, std::greater<>>;
+    Heap heap;
+    LiveTasks live;
+    std::vector<typename Heap::Handle> handles;
+    std::mt19937_64 rng(1);
+    auto push = [&](std::uint64_t deadline) {
+        const std::uint32_t id = live.create();
+        if (handles.size() <= id) {
+            handles.resize(id + 1);
+        }
+        handles[id] = heap.push(id, deadline);
+    };
+    for (std::size_t i = 0; i < tasks; ++i) {
+        push(rng() % 1'000'000'000);
+    }
+
+    std::uint64_t checksum = 0;
+    for (const Step& step : steps) {
+        if (step.op == Op::kPush || live.ids.empty()) {
+            push(step.deadline);
+        } else if (step.op == Op::kPop) {
+            const auto [id, deadline] = heap.pop();
+            live.finish(id);
+            checksum += deadline;
+        } else {
+            const std::uint32_t id = live.ids[step.pick % live.ids.size()];
+            heap.update(handles[id], step.deadline);
+        }
+    }
+    return checksum;
+}
+
+std::uint64_t runPriorityQueue(std::size_t tasks, const std::vector<Step>& steps,
+                               std::size_t& peakEntries) {
+    struct Entry {
+        std::uint64_t deadline;
+        std::uint32_t id;
+        std::uint32_t version;
+        bool operator>(const Entry& other) const { return deadline > other.deadline; }
+    };
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<>> queue;
+    LiveTasks live;
+    std::vector<std::uint32_t> versions;  ///< current version per task id
+    std::mt19937_64 rng(1);
+    auto push = [&](std::uint64_t deadline) {
+        const std::uint32_t id = live.create();
+        if (versions.size() <= id) {
+            versions.resize(id + 1);
+        }
+        queue.push({deadline, id, ++versions[id]});
+    };
+    for (std::size_t i = 0; i < tasks; ++i) {
+        push(rng() % 1'000'000'000);
+    }
+
+    peakEntries = queue.size();
+    std::uint64_t checksum = 0;
+    for (const Step& step : steps) {
+        if (step.op == Op::kPush || live.ids.empty()) {
+            push(step.deadline);
+        } else if (step.op == Op::kPop) {
+            // Discard entries superseded by a reschedule
+            while (queue.top().version != versions[queue.top().id]) {
+                queue.pop();
+            }
+            const Entry top = queue.top();
+            queue.pop();
+            live.finish(top.id);
+            checksum += top.deadline;
+        } else {
+            const std::uint32_t id = live.ids[step.pick % live.ids.size()];
+            queue.push({step.deadline, id, ++versions[id]});
+            peakEntries = std::max(peakEntries, queue.size());
+        }
+    }
+    return checksum;
+}
+
+/// Best of three runs; single runs vary too much on a shared machine.
+template<typename Run>
+double bestSeconds(Run run) {
+    double best = bench::timeSeconds(run);
+    for (int i = 0; i < 2; ++i) {
+        best = std::min(best, bench::timeSeconds(run));
+    }
+    return best;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t tasks = bench::argCount(argc, argv, 1, 100'000);
+    const std::size_t operations = 10 * tasks;
+
+    for (int updatePercent : {0, 50, 90}) {
+        const std::vector<Step> steps = makeSteps(operations, updatePercent, 42);
+        const std::string mix = std::to_string(updatePercent) + "% update";
+        const auto n = static_cast<double>(operations);
+        std::uint64_t checksum = 0;
+        std::size_t peakEntries = 0;
+
+        double seconds = bestSeconds([&] {
+            checksum += runPriorityQueue(tasks, steps, peakEntries);
+        });
+        bench::report(mix + " std::priority_queue (lazy)", seconds * 1e9 / n, "ns/op");
+        bench::report(mix + " std::priority_queue peak entries",
+                      static_cast<double>(peakEntries) / static_cast<double>(tasks), "x tasks");
+        seconds = bestSeconds([&] { checksum += runIndexedHeap<2>(tasks, steps); });
+        bench::report(mix + " IndexedHeap D=2", seconds * 1e9 / n, "ns/op");
+        seconds = bestSeconds([&] { checksum += runIndexedHeap<4>(tasks, steps); });
+        bench::report(mix + " IndexedHeap D=4", seconds * 1e9 / n, "ns/op");
+        seconds = bestSeconds([&] { checksum += runIndexedHeap<8>(tasks, steps); });
+        bench::report(mix + " IndexedHeap D=8", seconds * 1e9 / n, "ns/op");
+        bench::doNotOptimize(checksum);
+    }
+    return 0;
+}
@@ -0,0 +1,87 @@
+// Key lookup with interned symbols versus std::string keys. Keys look like
+// config paths ("section7.option42.timeout_ms"), longer than the SSO limit.
+// Usage: bench_intern_pool [lookups]
+
+#include "bench_common.hpp"
+#include "core/intern_pool.hpp"
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+int main(int argc, char** argv) {
+    const std::size_t lookups = bench::argCount(argc, argv, 1, 5'000'000);
+    constexpr std::size_t kKeys = 1000;
+
+    core::InternPool pool;
+    std::vector<std::string> keys;
+    std::vector<core::Symbol> symbols;
+    std::unordered_map<std::string, int> byString;
+    std::unordered_map<core::Symbol, int> bySymbol;
+    for (std::size_t i = 0; i < kKeys; ++i) {
+        keys.push_back("section" + std::to_string(i % 17) + ".option" + std::to_string(i) +
+                       ".timeout_ms");
+        symbols.push_back(pool.intern(keys.back()));
+        byString.emplace(keys.back(), static_cast<int>(i));
+        bySymbol.emplace(symbols.back(), static_cast<int>(i));
+    }
+
+    std::vector<std::uint32_t> order(lookups);
+    std::uint32_t state = 12345;
+    for (auto& index : order) {
+        state = state * 1664525u + 1013904223u;
+        index = (state >> 8) % kKeys;
+    }
+
+    const auto perLookup = [&](double seconds) {
+        return seconds * 1e9 / static_cast<double>(lookups);
+    };
+
+    long long sum = 0;
+    double seconds = bench::timeSeconds([&] {
+        for (std::uint32_t index : order) {
+            sum += byString.find(keys[index])->second;
+        }
+    });
+    bench::report("unordered_map<string> find", perLookup(seconds), "ns/op");
+
+    seconds = bench::timeSeconds([&] {
+        for (std::uint32_t index : order) {
+            sum += bySymbol.find(symbols[index])->second;
+        }
+    });
+    bench::report("unordered_map<Symbol> find", perLookup(seconds), "ns/op");
+
+    seconds = bench::timeSeconds([&] {
+        for (std::uint32_t index : order) {
+            sum += pool.find(keys[index]).id();
+        }
+    });
+    bench::report("InternPool::find (string -> Symbol)", perLookup(seconds), "ns/op");
+
+    seconds = bench::timeSeconds([&] {
+        for (std::size_t i = 1; i < order.size(); ++i) {
+            sum += keys[order[i]] == keys[order[i - 1]];
+        }
+    });
+    bench::report("std::string equality", perLookup(seconds), "ns/op");
+
+    seconds = bench::timeSeconds([&] {
+        for (std::size_t i = 1; i < order.size(); ++i) {
+            sum += symbols[order[i]] == symbols[order[i - 1]];
+        }
+    });
+    bench::report("Symbol equality", perLookup(seconds), "ns/op");
+    bench::doNotOptimize(sum);
+
+    std::size_t stringBytes = 0;
+    for (const auto& key : keys) {
+        stringBytes += sizeof(std::string) + key.capacity() + 1;
+    }
+    bench::report("std::string key footprint", static_cast<double>(stringBytes) / kKeys,
+                  "bytes/key");
+    bench::report("Symbol handle", sizeof(core::Symbol), "bytes/key");
+    bench::report("InternPool arena (all keys, once)",
+                  static_cast<double>(pool.arenaBytes()) / 1024.0, "KiB");
+    return 0;
+}
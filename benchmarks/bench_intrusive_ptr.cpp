@@ -0,0 +1,71 @@
+// Copy+destroy and creation cost of std::shared_ptr versus core::IntrusivePtr
+// with atomic and non-atomic counting, measured on one thread. A thread is
+// started first: libstdc++ skips shared_ptr's atomics while a process has
+// never been multi-threaded, which would not reflect a real server.
+// Usage: bench_intrusive_ptr [iterations]
+
+#include "bench_common.hpp"
+#include "core/intrusive_ptr.hpp"
+#include <memory>
+#include <string>
+#include <thread>
+
+namespace {
+
+struct Payload {
+    int value = 42;
+};
+
+struct AtomicPayload : core::RefCounted<AtomicPayload> {
+    int value = 42;
+};
+
+struct LocalPayload : core::RefCounted<LocalPayload, core::NonAtomicRefCount> {
+    int value = 42;
+};
+
+template<typename Ptr>
+void copyAndDestroy(const std::string& name, const Ptr& source, std::size_t iterations) {
+    const double seconds = bench::timeSeconds([&] {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            Ptr copy(source);
+            bench::doNotOptimize(copy);
+        }
+    });
+    bench::report(name + " copy+destroy", seconds * 1e9 / static_cast<double>(iterations), "ns");
+}
+
+template<typename Make>
+void create(const std::string& name, Make make, std::size_t iterations) {
+    const double seconds = bench::timeSeconds([&] {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto ptr = make();
+            bench::doNotOptimize(ptr);
+        }
+    });
+    bench::report(name + " create+destroy", seconds * 1e9 / static_cast<double>(iterations),
+                  "ns");
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t iterations = bench::argCount(argc, argv, 1, 20'000'000);
+    std::thread([] {}).join();
+
+    bench::report("sizeof(std::shared_ptr)", sizeof(std::shared_ptr<Payload>), "bytes");
+    bench::report("sizeof(core::IntrusivePtr)", sizeof(core::IntrusivePtr<AtomicPayload>),
+                  "bytes");
+
+    copyAndDestroy("std::shared_ptr", std::make_shared<Payload>(), iterations);
+    copyAndDestroy("IntrusivePtr<atomic>", core::make_intrusive<AtomicPayload>(), iterations);
+    copyAndDestroy("IntrusivePtr<non-atomic>", core::make_intrusive<LocalPayload>(), iterations);
+
+    const std::size_t creations = iterations / 4;
+    create("make_shared", [] { return std::make_shared<Payload>(); }, creations);
+    create("make_intrusive<atomic>", [] { return core::make_intrusive<AtomicPayload>(); },
+           creations);
+    create("make_intrusive<non-atomic>",
+           [] { return core::make_intrusive<LocalPayload>(); }, creations);
+    return 0;
+}
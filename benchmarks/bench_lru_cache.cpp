@@ -0,0 +1,137 @@
+// Memoization throughput from 1 to 32 threads. Every thread looks keys up
+// with get-or-compute (the compute step is trivial, so the cache itself is
+// measured). Keys are skewed so a few are hot, as in real memo tables.
+// Compared implementations:
+// - one std::mutex around an unordered_map plus a std::list LRU order
+// - core::LruCache with one shard (LRU)
+// - core::LruCache sharded, LRU and CLOCK
+// Usage: bench_lru_cache [total operations]   (default 4 * 10^6)
+
+#include "bench_common.hpp"
+#include "core/lru_cache.hpp"
+#include <cmath>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t kCapacity = 1 << 16;
+constexpr std::uint64_t kKeySpace = 1 << 17;
+
+/// The ad-hoc memo table: a map, an LRU list and one lock around both.
+class MutexLru {
+public:
+    explicit MutexLru(std::size_t capacity) : capacity_(capacity) {}
+
+    template<typename Compute>
+    std::uint64_t getOrCompute(std::uint64_t key, Compute compute) {
+        {
+            std::lock_guard lock(mutex_);
+            auto it = map_.find(key);
+            if (it != map_.end()) {
+                order_.splice(order_.begin(), order_, it->second.second);
+                return it->second.first;
+            }
+        }
+        const std::uint64_t value = compute();
+        std::lock_guard lock(mutex_);
+        if (map_.find(key) == map_.end()) {
+            order_.push_front(key);
+            map_.emplace(key, std::make_pair(value, order_.begin()));
+            if (map_.size() > capacity_) {
+                map_.erase(order_.back());
+                order_.pop_back();
+            }
+        }
+        return value;
+    }
+
+private:
+    std::mutex mutex_;
+    std::size_t capacity_;
+    std::list<std::uint64_t> order_;
+    std::unordered_map<std::uint64_t, std::pair<std::uint64_t, std::list<std::uint64_t>::iterator>>
+        map_;
+};
+
+std::vector<std::uint64_t> skewedKeys(std::size_t count, std::uint32_t seed) {
+    std::mt19937_64 rng(seed);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    std::vector<std::uint64_t> keys(count);
+    for (auto& key : keys) {
+        // Cubing a uniform value concentrates draws on the low keys
+        key = static_cast<std::uint64_t>(std::pow(unit(rng), 3.0) * kKeySpace);
+    }
+    return keys;
+}
+
+template<typename Cache>
+void measure(const std::string& name, Cache& cache, std::size_t threads, std::size_t totalOps) {
+    const std::size_t perThread = totalOps / threads;
+    std::vector<std::vector<std::uint64_t>> keys;
+    for (std::size_t t = 0; t < threads; ++t) {
+        keys.push_back(skewedKeys(perThread, static_cast<std::uint32_t>(t + 1)));
+    }
+    std::vector<std::uint64_t> checksums(threads * 8);
+    const double seconds = bench::timeSeconds([&] {
+        std::vector<std::thread> workers;
+        for (std::size_t t = 0; t < threads; ++t) {
+            workers.emplace_back([&, t] {
+                std::uint64_t sum = 0;
+                for (std::uint64_t key : keys[t]) {
+                    sum += cache.getOrCompute(key, [key] { return key * 2654435761u; });
+                }
+                checksums[t * 8] = sum;
+            });
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    });
+    bench::doNotOptimize(checksums);
+    bench::report(name + " " + std::to_string(threads) + " threads",
+                  static_cast<double>(perThread * threads) / seconds / 1e6, "Mops/s");
+}
+
+using Cache = core::LruCache<std::uint64_t, std::uint64_t>;
+
+Cache::Options cacheOptions(core::EvictionPolicy policy, std::size_t shards) {
+    Cache::Options options;
+    options.maxEntries = kCapacity;
+    options.policy = policy;
+    options.shards = shards;
+    return options;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t totalOps = bench::argCount(argc, argv, 1, 4'000'000);
+    bench::report("hardware threads", std::thread::hardware_concurrency(), "threads");
+
+    for (std::size_t threads : {1, 2, 4, 8, 16, 32}) {
+        MutexLru adHoc(kCapacity);
+        measure("mutex+map+list", adHoc, threads, totalOps);
+
+        Cache single(cacheOptions(core::EvictionPolicy::kLru, 1));
+        measure("LruCache 1 shard", single, threads, totalOps);
+
+        Cache lru(cacheOptions(core::EvictionPolicy::kLru, 64));
+        measure("LruCache LRU 64 shards", lru, threads, totalOps);
+
+        Cache clock(cacheOptions(core::EvictionPolicy::kClock, 64));
+        measure("LruCache CLOCK 64 shards", clock, threads, totalOps);
+        if (threads == 1) {
+            bench::report("LRU hit rate", 100.0 * lru.stats().hitRate(), "%");
+            bench::report("CLOCK hit rate", 100.0 * clock.stats().hitRate(), "%");
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,41 @@
+// Compares std::sort with core::parallel_sort on random 64-bit keys.
+// Usage: bench_parallel_sort [count]   (default 10^7; the target workload is 10^8)
+
+#include "bench_common.hpp"
+#include "core/parallel_sort.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+int main(int argc, char** argv) {
+    const std::size_t count = bench::argCount(argc, argv, 1, 10'000'000);
+    auto& pool = core::ThreadPool::getInstance();
+
+    std::vector<std::uint64_t> input(count);
+    std::mt19937_64 rng(42);
+    for (auto& key : input) {
+        key = rng();
+    }
+
+    std::cout << "Sorting " << count << " uint64 keys, " << pool.size() << " pool workers\n";
+
+    auto keys = input;
+    const double sequential = bench::timeSeconds([&] { std::sort(keys.begin(), keys.end()); });
+    bench::report("std::sort", sequential, "s");
+
+    keys = input;
+    const double parallel = bench::timeSeconds([&] { core::parallel_sort(keys); });
+    bench::report("core::parallel_sort", parallel, "s");
+    if (!std::is_sorted(keys.begin(), keys.end())) {
+        std::cerr << "parallel_sort produced unsorted output\n";
+        return 1;
+    }
+
+    keys = input;
+    const double stable = bench::timeSeconds([&] { core::parallel_stable_sort(keys); });
+    bench::report("core::parallel_stable_sort", stable, "s");
+
+    bench::report("speedup (parallel_sort)", sequential / parallel, "x");
+    return 0;
+}
@@ -0,0 +1,56 @@
+// Throughput of a parse -> transform -> aggregate -> emit core::Pipeline.
+// Usage: bench_pipeline [items] [max tokens]
+
+#include "bench_common.hpp"
+#include "core/pipeline.hpp"
+#include <cstdint>
+#include <optional>
+#include <string>
+
+int main(int argc, char** argv) {
+    const std::size_t items = bench::argCount(argc, argv, 1, 1'000'000);
+    const std::size_t tokens = bench::argCount(argc, argv, 2, 256);
+
+    std::size_t next = 0;
+    std::uint64_t aggregate = 0;
+    std::uint64_t emitted = 0;
+
+    core::Pipeline pipeline(tokens);
+    pipeline
+        .addSource<std::string>("parse",
+                                [&]() -> std::optional<std::string> {
+                                    if (next == items) {
+                                        return std::nullopt;
+                                    }
+                                    return std::to_string(next++);
+                                })
+        .addStage<std::string, std::uint64_t>(
+            "transform", core::StageMode::Parallel,
+            [](const std::string& text) {
+                std::uint64_t hash = 1469598103934665603ULL;
+                for (char c : text) {
+                    hash = (hash ^ static_cast<unsigned char>(c)) * 1099511628211ULL;
+                }
+                return hash;
+            })
+        .addStage<std::uint64_t, std::uint64_t>("aggregate", core::StageMode::SerialOutOfOrder,
+                                                [&](std::uint64_t hash) {
+                                                    aggregate ^= hash;
+                                                    return aggregate;
+                                                })
+        .addSink<std::uint64_t>("emit", core::StageMode::SerialInOrder,
+                                [&](std::uint64_t) { ++emitted; });
+
+    const double seconds = bench::timeSeconds([&] { pipeline.run(); });
+    std::cout << items << " items, " << tokens << " tokens, "
+              << core::ThreadPool::getInstance().size() + 1 << " workers\n";
+    bench::report("pipeline throughput", static_cast<double>(emitted) / seconds / 1e6, "Mitems/s");
+    for (const auto& stage : pipeline.stats()) {
+        bench::report("  " + stage.name + " busy",
+                      std::chrono::duration<double>(stage.busyTime).count(), "s");
+        bench::report("  " + stage.name + " max queue depth",
+                      static_cast<double>(stage.maxQueueDepth), "items");
+    }
+    bench::doNotOptimize(aggregate);
+    return 0;
+}
@@ -0,0 +1,60 @@
+// Compares std::sort with core::radix_sort and core::parallel_radix_sort on
+// random 64-bit keys, then std::sort with the MSD string sort.
+// Usage: bench_radix_sort [count]   (default 10^7; the target workload is 10^8,
+//        which needs ~2.4 GB for the input, the working copy and the scratch buffer)
+
+#include "bench_common.hpp"
+#include "core/radix_sort.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+int main(int argc, char** argv) {
+    const std::size_t count = bench::argCount(argc, argv, 1, 10'000'000);
+    auto& pool = core::ThreadPool::getInstance();
+
+    std::vector<std::uint64_t> input(count);
+    std::mt19937_64 rng(42);
+    for (auto& key : input) {
+        key = rng();
+    }
+
+    std::cout << "Sorting " << count << " uint64 keys, " << pool.size() << " pool workers\n";
+
+    auto keys = input;
+    const double sequential = bench::timeSeconds([&] { std::sort(keys.begin(), keys.end()); });
+    bench::report("std::sort", sequential, "s");
+
+    keys = input;
+    const double radix = bench::timeSeconds([&] { core::radix_sort(keys); });
+    bench::report("core::radix_sort", radix, "s");
+    if (!std::is_sorted(keys.begin(), keys.end())) {
+        std::cerr << "radix_sort produced unsorted output\n";
+        return 1;
+    }
+
+    keys = input;
+    const double parallel = bench::timeSeconds([&] { core::parallel_radix_sort(keys); });
+    bench::report("core::parallel_radix_sort", parallel, "s");
+
+    bench::report("speedup (radix_sort)", sequential / radix, "x");
+    bench::report("speedup (parallel_radix_sort)", sequential / parallel, "x");
+
+    // Strings: decimal renderings of a tenth as many keys
+    std::vector<std::string> words(count / 10);
+    for (std::size_t i = 0; i < words.size(); ++i) {
+        words[i] = std::to_string(input[i]);
+    }
+    auto sortedWords = words;
+    const double stringSort =
+        bench::timeSeconds([&] { std::sort(sortedWords.begin(), sortedWords.end()); });
+    bench::report("std::sort (strings)", stringSort, "s");
+
+    sortedWords = words;
+    const double stringRadix = bench::timeSeconds([&] { core::radix_sort(sortedWords); });
+    bench::report("core::radix_sort (strings)", stringRadix, "s");
+    bench::report("speedup (strings)", stringSort / stringRadix, "x");
+    return 0;
+}
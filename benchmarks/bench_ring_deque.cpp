@@ -0,0 +1,148 @@
+// Queue-style workloads on std::deque and core::RingDeque<int>:
+// - fifo: a queue held at a fixed depth, one push_back and one pop_front
+//   per operation (a message or task queue in steady state)
+// - fill/drain: push N elements, then pop them all (a BFS frontier)
+// - both ends: random pushes and pops at either end (a work-stealing deque)
+// - iterate: sum every element, through iterators and, for RingDeque,
+//   through its two contiguous segments
+// Allocation counts come from core_alloc_tracker.
+// Usage: bench_ring_deque [operations]   (default 10^7)
+
+#include "bench_common.hpp"
+#include "core/alloc_tracker.hpp"
+#include "core/ring_deque.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <numeric>
+#include <string>
+#include <vector>
+
+namespace {
+
+/// Best of three timings of @p run, in nanoseconds per operation.
+template<typename Run>
+double nsPerOp(std::size_t ops, Run run) {
+    double best = 1e30;
+    for (int attempt = 0; attempt < 3; ++attempt) {
+        best = std::min(best, bench::timeSeconds(run));
+    }
+    return best * 1e9 / static_cast<double>(ops);
+}
+
+template<typename Deque>
+void runFifo(const std::string& name, std::size_t depth, std::size_t ops) {
+    Deque queue;
+    for (std::size_t i = 0; i < depth; ++i) {
+        queue.push_back(static_cast<int>(i));
+    }
+    long long checksum = 0;
+    core::alloc::AllocationScope scope;
+    const double ns = nsPerOp(ops, [&] {
+        for (std::size_t i = 0; i < ops; ++i) {
+            checksum += queue.front();
+            queue.pop_front();
+            queue.push_back(static_cast<int>(i));
+        }
+    });
+    bench::doNotOptimize(checksum);
+    const std::string label = name + " fifo depth " + std::to_string(depth);
+    bench::report(label, ns, "ns/op");
+    bench::report(label + " allocs", static_cast<double>(scope.allocations()) /
+                                         static_cast<double>(3 * ops) * 1000.0,
+                  "per 1k ops");
+}
+
+template<typename Deque>
+void runFillDrain(const std::string& name, std::size_t count) {
+    long long checksum = 0;
+    const double ns = nsPerOp(count, [&] {
+        Deque queue;
+        for (std::size_t i = 0; i < count; ++i) {
+            queue.push_back(static_cast<int>(i));
+        }
+        while (!queue.empty()) {
+            checksum += queue.front();
+            queue.pop_front();
+        }
+    });
+    bench::doNotOptimize(checksum);
+    bench::report(name + " fill/drain " + std::to_string(count), ns, "ns/element");
+}
+
+template<typename Deque>
+void runBothEnds(const std::string& name, std::size_t ops) {
+    std::uint32_t state = 12345;
+    Deque deque;
+    long long checksum = 0;
+    const double ns = nsPerOp(ops, [&] {
+        for (std::size_t i = 0; i < ops; ++i) {
+            state = state * 1664525u + 1013904223u;
+            const std::uint32_t choice = (state >> 16) % 8;
+            // Owner pushes and pops at the back, thieves take from the front;
+            // pushes slightly outnumber pops so the deque stays populated
+            if (choice < 4 || deque.empty()) {
+                deque.push_back(static_cast<int>(i));
+            } else if (choice < 7) {
+                checksum += deque.back();
+                deque.pop_back();
+            } else {
+                checksum += deque.front();
+                deque.pop_front();
+            }
+        }
+    });
+    bench::doNotOptimize(checksum);
+    bench::report(name + " both ends", ns, "ns/op");
+}
+
+template<typename Deque>
+void runIterate(const std::string& name, std::size_t count, int repeats) {
+    Deque deque;
+    for (std::size_t i = 0; i < count; ++i) {
+        deque.push_back(static_cast<int>(i));
+    }
+    // Rotate so a RingDeque's contents wrap around the buffer end
+    for (std::size_t i = 0; i < count / 3; ++i) {
+        deque.push_back(deque.front());
+        deque.pop_front();
+    }
+    long long checksum = 0;
+    const std::size_t elements = count * static_cast<std::size_t>(repeats);
+    bench::report(name + " iterate", nsPerOp(elements, [&] {
+                      for (int r = 0; r < repeats; ++r) {
+                          checksum += std::accumulate(deque.begin(), deque.end(), 0LL);
+                      }
+                  }),
+                  "ns/element");
+    if constexpr (std::is_same_v<Deque, core::RingDeque<int>>) {
+        bench::report(name + " iterate segments", nsPerOp(elements, [&] {
+                          for (int r = 0; r < repeats; ++r) {
+                              auto [first, second] = deque.segments();
+                              checksum += std::accumulate(first.begin(), first.end(), 0LL);
+                              checksum += std::accumulate(second.begin(), second.end(), 0LL);
+                          }
+                      }),
+                      "ns/element");
+    }
+    bench::doNotOptimize(checksum);
+}
+
+template<typename Deque>
+void runAll(const std::string& name, std::size_t ops) {
+    for (std::size_t depth : {16, 4096, 1 << 20}) {
+        runFifo<Deque>(name, depth, ops);
+    }
+    runFillDrain<Deque>(name, ops);
+    runBothEnds<Deque>(name, ops);
+    runIterate<Deque>(name, 1 << 16, 200);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t ops = bench::argCount(argc, argv, 1, 10'000'000);
+    runAll<std::deque<int>>("std::deque", ops);
+    runAll<core::RingDeque<int>>("core::RingDeque", ops);
+    return 0;
+}
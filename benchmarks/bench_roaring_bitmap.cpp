@@ -0,0 +1,158 @@
+// Compares core::RoaringBitmap with std::set and std::unordered_set on three
+// ID distributions: sparse (random over all 32 bits), dense (random over a
+// range twice the set size) and runs (consecutive blocks of 1000 IDs).
+// Reports heap bytes per element (from core_alloc_tracker) and the time of
+// union, intersection and difference of two such sets. The std::set results
+// come from std::set_* into a vector; the std::unordered_set results probe
+// one set with the elements of the other.
+// Usage: bench_roaring_bitmap [count]   (default 10^6)
+
+#include "bench_common.hpp"
+#include "core/alloc_tracker.hpp"
+#include "core/roaring_bitmap.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <random>
+#include <set>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace {
+
+std::vector<std::uint32_t> makeIds(const std::string& kind, std::size_t count,
+                                   std::uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::vector<std::uint32_t> ids;
+    ids.reserve(count);
+    if (kind == "sparse") {
+        for (std::size_t i = 0; i < count; ++i) {
+            ids.push_back(static_cast<std::uint32_t>(rng()));
+        }
+    } else if (kind == "dense") {
+        std::uniform_int_distribution<std::uint32_t> id(0, static_cast<std::uint32_t>(2 * count));
+        for (std::size_t i = 0; i < count; ++i) {
+            ids.push_back(id(rng));
+        }
+    } else {
+        std::uniform_int_distribution<std::uint32_t> gap(0, 2000);
+        std::uint32_t next = 0;
+        while (ids.size() < count) {
+            next += gap(rng);
+            for (std::uint32_t i = 0; i < 1000 && ids.size() < count; ++i) {
+                ids.push_back(next++);
+            }
+        }
+    }
+    std::sort(ids.begin(), ids.end());
+    ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+    return ids;
+}
+
+/// Builds a container inside an allocation scope and reports bytes per element.
+template<typename Build>
+auto measureMemory(const std::string& label, std::size_t elements, Build build) {
+    core::alloc::AllocationScope scope;
+    auto container = build();
+    bench::report(label + " memory",
+                  static_cast<double>(scope.counters().netBytes()) /
+                      static_cast<double>(elements),
+                  "bytes/element");
+    return container;
+}
+
+void runDataset(const std::string& kind, std::size_t count) {
+    const std::vector<std::uint32_t> left = makeIds(kind, count, 1);
+    const std::vector<std::uint32_t> right = makeIds(kind, count, 2);
+    const std::size_t elements = left.size();
+
+    const auto setA = measureMemory(kind + " std::set", elements, [&] {
+        return std::set<std::uint32_t>(left.begin(), left.end());
+    });
+    const std::set<std::uint32_t> setB(right.begin(), right.end());
+    const auto hashA = measureMemory(kind + " std::unordered_set", elements, [&] {
+        return std::unordered_set<std::uint32_t>(left.begin(), left.end());
+    });
+    const std::unordered_set<std::uint32_t> hashB(right.begin(), right.end());
+    const auto roaringA = measureMemory(kind + " RoaringBitmap", elements, [&] {
+        core::RoaringBitmap bitmap;
+        bitmap.addMany(left.data(), left.size());
+        bitmap.runOptimize();
+        return bitmap;
+    });
+    core::RoaringBitmap roaringB;
+    roaringB.addMany(right.data(), right.size());
+    roaringB.runOptimize();
+
+    const auto stats = roaringA.stats();
+    bench::report(kind + " RoaringBitmap array containers",
+                  static_cast<double>(stats.arrays), "containers");
+    bench::report(kind + " RoaringBitmap bitmap containers",
+                  static_cast<double>(stats.bitmaps), "containers");
+    bench::report(kind + " RoaringBitmap run containers",
+                  static_cast<double>(stats.runs), "containers");
+
+    std::size_t checksum = 0;
+    auto reportOp = [&](const std::string& op, const std::string& name, auto&& fn) {
+        // The untimed first call takes the page faults for the result buffers,
+        // which otherwise land on whichever contender runs after a large free
+        checksum += fn();
+        const double seconds = bench::timeSeconds([&] { checksum += fn(); });
+        bench::report(kind + " " + op + " " + name,
+                      seconds * 1e9 / static_cast<double>(elements), "ns/element");
+    };
+
+    auto setOp = [&](auto algorithm) {
+        return [&, algorithm] {
+            std::vector<std::uint32_t> out;
+            algorithm(setA.begin(), setA.end(), setB.begin(), setB.end(),
+                      std::back_inserter(out));
+            return out.size();
+        };
+    };
+    reportOp("union", "std::set", setOp([](auto... args) { std::set_union(args...); }));
+    reportOp("union", "std::unordered_set", [&] {
+        std::unordered_set<std::uint32_t> out = hashA;
+        out.insert(hashB.begin(), hashB.end());
+        return out.size();
+    });
+    reportOp("union", "RoaringBitmap", [&] { return (roaringA | roaringB).size(); });
+
+    reportOp("intersection", "std::set",
+             setOp([](auto... args) { std::set_intersection(args...); }));
+    reportOp("intersection", "std::unordered_set", [&] {
+        std::vector<std::uint32_t> out;
+        for (std::uint32_t id : hashA) {
+            if (hashB.count(id) != 0) {
+                out.push_back(id);
+            }
+        }
+        return out.size();
+    });
+    reportOp("intersection", "RoaringBitmap", [&] { return (roaringA & roaringB).size(); });
+
+    reportOp("difference", "std::set",
+             setOp([](auto... args) { std::set_difference(args...); }));
+    reportOp("difference", "std::unordered_set", [&] {
+        std::vector<std::uint32_t> out;
+        for (std::uint32_t id : hashA) {
+            if (hashB.count(id) == 0) {
+                out.push_back(id);
+            }
+        }
+        return out.size();
+    });
+    reportOp("difference", "RoaringBitmap", [&] { return (roaringA - roaringB).size(); });
+    bench::doNotOptimize(checksum);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t count = bench::argCount(argc, argv, 1, 1'000'000);
+    for (const char* kind : {"sparse", "dense", "runs"}) {
+        runDataset(kind, count);
+    }
+    return 0;
+}
@@ -0,0 +1,91 @@
+// Read throughput of core::SeqLock versus std::shared_mutex for a small
+// snapshot with one writer publishing every ~10 microseconds.
+// Usage: bench_seqlock [reader threads] [milliseconds]
+
+#include "bench_common.hpp"
+#include "core/seqlock.hpp"
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct Rates {
+    double bid = 0;
+    double ask = 0;
+    std::uint64_t timestamp = 0;
+    std::uint64_t sequence = 0;
+};
+
+class SharedMutexRates {
+public:
+    Rates load() const {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        return rates_;
+    }
+    void store(const Rates& rates) {
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        rates_ = rates;
+    }
+
+private:
+    mutable std::shared_mutex mutex_;
+    Rates rates_;
+};
+
+template<typename Snapshot>
+double readsPerSecond(Snapshot& snapshot, std::size_t readers, std::chrono::milliseconds duration) {
+    std::atomic<bool> stop{false};
+    std::atomic<std::uint64_t> totalReads{0};
+
+    std::vector<std::thread> threads;
+    for (std::size_t r = 0; r < readers; ++r) {
+        threads.emplace_back([&] {
+            std::uint64_t reads = 0;
+            double checksum = 0;
+            while (!stop.load(std::memory_order_relaxed)) {
+                checksum += snapshot.load().bid;
+                ++reads;
+            }
+            bench::doNotOptimize(checksum);
+            totalReads.fetch_add(reads);
+        });
+    }
+    threads.emplace_back([&] {
+        Rates rates;
+        while (!stop.load(std::memory_order_relaxed)) {
+            ++rates.sequence;
+            rates.bid = static_cast<double>(rates.sequence);
+            snapshot.store(rates);
+            std::this_thread::sleep_for(std::chrono::microseconds(10));
+        }
+    });
+
+    std::this_thread::sleep_for(duration);
+    stop = true;
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    return static_cast<double>(totalReads.load()) / std::chrono::duration<double>(duration).count();
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t readers = bench::argCount(argc, argv, 1, std::thread::hardware_concurrency());
+    const std::chrono::milliseconds duration(bench::argCount(argc, argv, 2, 1000));
+
+    std::cout << readers << " readers, 1 writer, " << duration.count() << " ms per run\n";
+
+    SharedMutexRates shared;
+    bench::report("std::shared_mutex reads", readsPerSecond(shared, readers, duration) / 1e6,
+                  "Mreads/s");
+
+    core::SeqLock<Rates> seqlock;
+    bench::report("core::SeqLock reads", readsPerSecond(seqlock, readers, duration) / 1e6,
+                  "Mreads/s");
+    return 0;
+}
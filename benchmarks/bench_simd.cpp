@@ -0,0 +1,135 @@
+// Throughput of the core::simd kernels at every instruction-set level the
+// CPU supports, next to the standard algorithm each one replaces. Each
+// kernel runs over a cache-resident buffer (128 KiB, repeated) and over a
+// large one that streams from memory. Find and findByte look for a value
+// that is absent, so they scan the whole buffer.
+// Usage: bench_simd [large-buffer MiB]   (default 256)
+
+#include "bench_common.hpp"
+#include "core/simd.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+using core::simd::Level;
+
+struct Buffers {
+    std::vector<std::int32_t> ints;
+    std::vector<float> floats;
+    std::vector<std::uint8_t> bytes;
+};
+
+Buffers makeBuffers(std::size_t bytes) {
+    std::mt19937 rng(1);
+    Buffers b;
+    b.ints.resize(bytes / sizeof(std::int32_t));
+    b.floats.resize(bytes / sizeof(float));
+    b.bytes.resize(bytes);
+    for (auto& v : b.ints) {
+        v = static_cast<std::int32_t>(rng() % 1'000'000);
+    }
+    for (auto& v : b.floats) {
+        v = static_cast<float>(rng() % 1000) * 0.001f;
+    }
+    for (auto& v : b.bytes) {
+        v = static_cast<std::uint8_t>(rng() % 255);  // never 255
+    }
+    return b;
+}
+
+/// Runs @p kernel over @p bytes of data @p repeats times and reports GB/s.
+void measure(const std::string& label, std::size_t bytes, int repeats,
+             const std::function<std::uint64_t()>& kernel) {
+    std::uint64_t checksum = kernel();  // warm-up, and faults the pages in
+    const double seconds = bench::timeSeconds([&] {
+        for (int r = 0; r < repeats; ++r) {
+            checksum += kernel();
+        }
+    });
+    bench::doNotOptimize(checksum);
+    bench::report(label, static_cast<double>(bytes) * repeats / seconds / 1e9, "GB/s");
+}
+
+void runSuite(const std::string& size, const Buffers& b, int repeats) {
+    const std::size_t bytes = b.bytes.size();
+    const std::span<const std::int32_t> ints(b.ints);
+    const std::span<const float> floats(b.floats);
+    const std::uint8_t* data = b.bytes.data();
+    constexpr std::int32_t kAbsent = -1;
+
+    auto prefix = [&](const std::string& kernel, const std::string& impl) {
+        return size + " " + kernel + " " + impl;
+    };
+
+    measure(prefix("find", "std::find"), bytes, repeats, [&] {
+        return static_cast<std::uint64_t>(std::find(ints.begin(), ints.end(), kAbsent) -
+                                          ints.begin());
+    });
+    measure(prefix("count", "std::count"), bytes, repeats, [&] {
+        return static_cast<std::uint64_t>(std::count(ints.begin(), ints.end(), 7));
+    });
+    measure(prefix("minMax", "std::minmax_element"), bytes, repeats, [&] {
+        const auto [low, high] = std::minmax_element(ints.begin(), ints.end());
+        return static_cast<std::uint64_t>(*low + *high);
+    });
+    measure(prefix("sum", "std::accumulate"), bytes, repeats, [&] {
+        const std::int64_t total = std::accumulate(ints.begin(), ints.end(), std::int64_t{0});
+        return static_cast<std::uint64_t>(total);
+    });
+    measure(prefix("sum float", "std::accumulate"), bytes, repeats, [&] {
+        return static_cast<std::uint64_t>(std::accumulate(floats.begin(), floats.end(), 0.0f));
+    });
+    measure(prefix("findByte", "std::memchr"), bytes, repeats, [&] {
+        return reinterpret_cast<std::uintptr_t>(std::memchr(data, 255, bytes));
+    });
+    measure(prefix("countByte", "std::count"), bytes, repeats, [&] {
+        return static_cast<std::uint64_t>(std::count(data, data + bytes, std::uint8_t{7}));
+    });
+
+    const Level original = core::simd::activeLevel();
+    for (Level level : {Level::kScalar, Level::kSSE2, Level::kAVX2, Level::kAVX512}) {
+        if (level > core::simd::detectedLevel()) {
+            break;
+        }
+        core::simd::setLevel(level);
+        const std::string name = core::simd::levelName(level);
+        measure(prefix("find", name), bytes, repeats,
+                [&] { return core::simd::find(ints, kAbsent); });
+        measure(prefix("count", name), bytes, repeats,
+                [&] { return core::simd::count(ints, 7); });
+        measure(prefix("minMax", name), bytes, repeats, [&] {
+            const core::simd::MinMax result = core::simd::minMax(ints);
+            return static_cast<std::uint64_t>(result.min + result.max);
+        });
+        measure(prefix("sum", name), bytes, repeats,
+                [&] { return static_cast<std::uint64_t>(core::simd::sum(ints)); });
+        measure(prefix("sum float", name), bytes, repeats,
+                [&] { return static_cast<std::uint64_t>(core::simd::sum(floats)); });
+        measure(prefix("findByte", name), bytes, repeats, [&] {
+            return reinterpret_cast<std::uintptr_t>(core::simd::findByte(data, bytes, 255));
+        });
+        measure(prefix("countByte", name), bytes, repeats,
+                [&] { return core::simd::countByte(data, bytes, 7); });
+    }
+    core::simd::setLevel(original);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t largeMiB = bench::argCount(argc, argv, 1, 256);
+    bench::report("detected level " + std::string(core::simd::levelName(
+                                          core::simd::detectedLevel())),
+                  static_cast<double>(core::simd::detectedLevel()), "level");
+
+    runSuite("128KiB", makeBuffers(128 * 1024), 2000);
+    runSuite(std::to_string(largeMiB) + "MiB", makeBuffers(largeMiB << 20), 3);
+    return 0;
+}
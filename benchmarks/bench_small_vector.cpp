@@ -0,0 +1,53 @@
+// Short-list workload: build, scan and drop many lists of 0-8 ints, as
+// std::vector and as core::SmallVector with 8 inline slots. Allocation
+// counts come from core_alloc_tracker.
+// Usage: bench_small_vector [lists]
+
+#include "bench_common.hpp"
+#include "core/alloc_tracker.hpp"
+#include "core/small_vector.hpp"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace {
+
+template<typename List>
+void runWorkload(const std::string& name, const std::vector<std::uint8_t>& lengths) {
+    core::alloc::AllocationScope scope;
+    long long checksum = 0;
+    const double seconds = bench::timeSeconds([&] {
+        for (std::size_t i = 0; i < lengths.size(); ++i) {
+            List list;
+            for (int j = 0; j < lengths[i]; ++j) {
+                list.push_back(static_cast<int>(i) + j);
+            }
+            for (int value : list) {
+                checksum += value;
+            }
+        }
+    });
+    bench::doNotOptimize(checksum);
+
+    const auto lists = static_cast<double>(lengths.size());
+    bench::report(name + " time", seconds * 1e9 / lists, "ns/list");
+    bench::report(name + " allocations",
+                  static_cast<double>(scope.allocations()) / lists, "allocs/list");
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t lists = bench::argCount(argc, argv, 1, 2'000'000);
+
+    std::vector<std::uint8_t> lengths(lists);
+    std::uint32_t state = 12345;
+    for (auto& length : lengths) {
+        state = state * 1664525u + 1013904223u;
+        length = static_cast<std::uint8_t>((state >> 16) % 9);
+    }
+
+    runWorkload<std::vector<int>>("std::vector<int>", lengths);
+    runWorkload<core::SmallVector<int, 8>>("core::SmallVector<int, 8>", lengths);
+    return 0;
+}
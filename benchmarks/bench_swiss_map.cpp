@@ -0,0 +1,86 @@
+// core::SwissMap versus std::unordered_map at a high load factor (~0.86 for
+// SwissMap). Measures insert, successful (hit) and unsuccessful (miss)
+// lookups for uint64 keys, and hits for short string keys.
+// Usage: bench_swiss_map [lookups]
+
+#include "bench_common.hpp"
+#include "core/swiss_map.hpp"
+#include <cstdint>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+template<typename Map, typename Key>
+void run(const std::string& name, const std::vector<Key>& keys, const std::vector<Key>& hits,
+         const std::vector<Key>& misses) {
+    Map map;
+    const double insertSeconds = bench::timeSeconds([&] {
+        for (const Key& key : keys) {
+            map.emplace(key, 1);
+        }
+    });
+
+    std::uint64_t found = 0;
+    const double hitSeconds = bench::timeSeconds([&] {
+        for (const Key& key : hits) {
+            found += map.find(key)->second;
+        }
+    });
+    const double missSeconds = bench::timeSeconds([&] {
+        for (const Key& key : misses) {
+            found += map.count(key);
+        }
+    });
+    bench::doNotOptimize(found);
+
+    bench::report(name + " insert", insertSeconds * 1e9 / static_cast<double>(keys.size()),
+                  "ns/op");
+    bench::report(name + " hit", hitSeconds * 1e9 / static_cast<double>(hits.size()), "ns/op");
+    bench::report(name + " miss", missSeconds * 1e9 / static_cast<double>(misses.size()),
+                  "ns/op");
+    bench::report(name + " load factor", static_cast<double>(map.load_factor()), "");
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t lookups = bench::argCount(argc, argv, 1, 4'000'000);
+    // 900k keys fill a 2^20-slot SwissMap to 0.86, just under its 7/8 limit
+    constexpr std::size_t kKeys = 900'000;
+
+    std::mt19937_64 rng(3);
+    std::vector<std::uint64_t> keys(kKeys);
+    for (auto& key : keys) {
+        key = rng() | 1;  // odd keys are present, even keys are misses
+    }
+    std::vector<std::uint64_t> hits(lookups);
+    std::vector<std::uint64_t> misses(lookups);
+    for (std::size_t i = 0; i < lookups; ++i) {
+        hits[i] = keys[rng() % kKeys];
+        misses[i] = rng() & ~std::uint64_t{1};
+    }
+    run<std::unordered_map<std::uint64_t, std::uint64_t>>("unordered_map<u64>", keys, hits,
+                                                         misses);
+    run<core::SwissMap<std::uint64_t, std::uint64_t>>("SwissMap<u64>", keys, hits, misses);
+
+    // Short string keys (SSO) over a smaller table
+    constexpr std::size_t kStrings = 100'000;
+    std::vector<std::string> words(kStrings);
+    std::vector<std::string> wordHits(lookups / 4);
+    std::vector<std::string> wordMisses(lookups / 4);
+    for (std::size_t i = 0; i < kStrings; ++i) {
+        words[i] = "user" + std::to_string(i * 7);
+    }
+    for (std::size_t i = 0; i < wordHits.size(); ++i) {
+        wordHits[i] = words[rng() % kStrings];
+        wordMisses[i] = "user" + std::to_string((rng() % kStrings) * 7 + 3);
+    }
+    run<std::unordered_map<std::string, std::uint64_t>>("unordered_map<string>", words,
+                                                       wordHits, wordMisses);
+    run<core::SwissMap<std::string, std::uint64_t>>("SwissMap<string>", words, wordHits,
+                                                   wordMisses);
+    return 0;
+}
@@ -0,0 +1,115 @@
+// Element-wise math on large double arrays, three ways:
+// - naive: std::vector operators that return a new vector per operation,
+//   the way such helpers are usually written
+// - loop: a hand-written loop, the lower bound
+// - core::Vec: the same source as naive, fused by expression templates
+// Expressions: a = b * c + d, and a longer one,
+// a = (b + c) * (d - e) / 2 + b * e. Allocation counts come from
+// core_alloc_tracker.
+// Usage: bench_vec [elements]   (default 10^6; try 10^4 for cache-resident)
+
+#include "bench_common.hpp"
+#include "core/alloc_tracker.hpp"
+#include "core/vec.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace naive {
+
+using Array = std::vector<double>;
+
+Array operator+(const Array& x, const Array& y) {
+    Array out(x.size());
+    for (std::size_t i = 0; i < x.size(); ++i) {
+        out[i] = x[i] + y[i];
+    }
+    return out;
+}
+
+Array operator-(const Array& x, const Array& y) {
+    Array out(x.size());
+    for (std::size_t i = 0; i < x.size(); ++i) {
+        out[i] = x[i] - y[i];
+    }
+    return out;
+}
+
+Array operator*(const Array& x, const Array& y) {
+    Array out(x.size());
+    for (std::size_t i = 0; i < x.size(); ++i) {
+        out[i] = x[i] * y[i];
+    }
+    return out;
+}
+
+Array operator/(const Array& x, double s) {
+    Array out(x.size());
+    for (std::size_t i = 0; i < x.size(); ++i) {
+        out[i] = x[i] / s;
+    }
+    return out;
+}
+
+}  // namespace naive
+
+namespace {
+
+/// Best of three timings of @p repeats calls to @p run, reported per element.
+void measure(const std::string& label, std::size_t elements, int repeats,
+             const std::function<void()>& run) {
+    run();  // warm-up: faults pages in and sizes the outputs
+    core::alloc::AllocationScope scope;
+    double best = 1e30;
+    for (int attempt = 0; attempt < 3; ++attempt) {
+        best = std::min(best, bench::timeSeconds([&] {
+            for (int r = 0; r < repeats; ++r) {
+                run();
+            }
+        }));
+    }
+    bench::report(label, best * 1e9 / (static_cast<double>(elements) * repeats), "ns/element");
+    bench::report(label + " allocs",
+                  static_cast<double>(scope.allocations()) / (3.0 * repeats), "per eval");
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    using namespace naive;
+    const std::size_t n = bench::argCount(argc, argv, 1, 1'000'000);
+    const int repeats = static_cast<int>(std::max<std::size_t>(1, 100'000'000 / n));
+
+    Array a(n), b(n), c(n), d(n), e(n);
+    core::Vec<double> va(n), vb(n), vc(n), vd(n), ve(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        b[i] = vb[i] = 1.0 + static_cast<double>(i % 17);
+        c[i] = vc[i] = 0.5 * static_cast<double>(i % 13);
+        d[i] = vd[i] = 2.0 - static_cast<double>(i % 7);
+        e[i] = ve[i] = 0.25 * static_cast<double>(i % 5);
+    }
+
+    measure("b*c+d naive", n, repeats, [&] { a = b * c + d; });
+    measure("b*c+d loop", n, repeats, [&] {
+        for (std::size_t i = 0; i < n; ++i) {
+            a[i] = b[i] * c[i] + d[i];
+        }
+    });
+    measure("b*c+d core::Vec", n, repeats, [&] { va = vb * vc + vd; });
+
+    measure("(b+c)*(d-e)/2+b*e naive", n, repeats, [&] { a = (b + c) * (d - e) / 2.0 + b * e; });
+    measure("(b+c)*(d-e)/2+b*e loop", n, repeats, [&] {
+        for (std::size_t i = 0; i < n; ++i) {
+            a[i] = (b[i] + c[i]) * (d[i] - e[i]) / 2.0 + b[i] * e[i];
+        }
+    });
+    measure("(b+c)*(d-e)/2+b*e core::Vec", n, repeats,
+            [&] { va = (vb + vc) * (vd - ve) / 2.0 + vb * ve; });
+
+    bench::doNotOptimize(a[n / 2]);
+    bench::doNotOptimize(va[n / 2]);
+    bench::report("results agree", a[n / 3] == va[n / 3] ? 1.0 : 0.0, "bool");
+    return 0;
+}
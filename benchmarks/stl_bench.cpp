@@ -0,0 +1,226 @@
+// CSV measurements of the containers STLQuest introduces: vector, deque,
+// list, map, unordered_map, set and priority_queue. For every element size
+// (8, 64, 256 bytes) and count (10, 100, ..., max) it reports:
+//   insert   ns per element, building from shuffled keys
+//   lookup   ns per successful find by key (linear search for sequences)
+//   iterate  ns per element visited in a full pass
+//   erase    ns per erase by key (pop for priority_queue)
+//   memory   heap bytes per element after the build, from core_alloc_tracker
+// Operations a container does not offer are left out. Combinations that
+// would need more than the memory budget are skipped with a note on stderr;
+// the default 3 GiB budget covers 10^7 elements of 8 and 64 bytes and skips
+// only 256-byte elements at 10^7 (about 8 GB).
+//
+// Usage: stl_bench [max count = 10000000] [memory budget MiB = 3072] > stl.csv
+
+#include "bench_common.hpp"
+#include "core/alloc_tracker.hpp"
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <iostream>
+#include <list>
+#include <map>
+#include <numeric>
+#include <queue>
+#include <random>
+#include <set>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+struct NoPayload {};
+
+template<std::size_t Bytes>
+struct Element {
+    using Payload =
+        std::conditional_t<Bytes == 8, NoPayload, std::array<std::uint64_t, Bytes / 8 - 1>>;
+
+    std::uint64_t key = 0;
+    [[no_unique_address]] Payload payload{};
+
+    friend bool operator<(const Element& a, const Element& b) { return a.key < b.key; }
+};
+
+static_assert(sizeof(Element<8>) == 8 && sizeof(Element<64>) == 64);
+
+constexpr std::size_t kTargetElements = 1'000'000;  // work per measurement for small counts
+constexpr std::size_t kLinearBudget = 20'000'000;   // element visits for linear searches
+constexpr std::size_t kNodeOverhead = 64;           // node links, malloc header, hash buckets
+
+template<typename C>
+constexpr bool kIsQueue = requires(C& c) { c.top(); };
+
+template<typename C>
+constexpr bool kIsMap = requires { typename C::mapped_type; };
+
+template<typename C>
+constexpr bool kIsSet = !kIsMap<C> && requires { typename C::key_type; };
+
+template<typename C>
+constexpr bool kIsSequence = !kIsQueue<C> && !kIsMap<C> && !kIsSet<C>;
+
+template<typename C>
+void insertOne(C& c, std::uint64_t key) {
+    using Value = typename C::value_type;
+    if constexpr (kIsQueue<C>) {
+        c.push(Value{key});
+    } else if constexpr (kIsMap<C>) {
+        c.emplace(key, typename C::mapped_type{key});
+    } else if constexpr (kIsSet<C>) {
+        c.insert(Value{key});
+    } else {
+        c.push_back(Value{key});
+    }
+}
+
+template<typename C>
+auto findKey(C& c, std::uint64_t key) {
+    if constexpr (kIsMap<C>) {
+        return c.find(key);
+    } else if constexpr (kIsSet<C>) {
+        return c.find(typename C::value_type{key});
+    } else {
+        return std::find_if(c.begin(), c.end(), [key](const auto& e) { return e.key == key; });
+    }
+}
+
+template<typename C>
+std::uint64_t keyOf(const C&, const typename C::value_type& value) {
+    if constexpr (kIsMap<C>) {
+        return value.second.key;
+    } else {
+        return value.key;
+    }
+}
+
+void emit(const std::string& container, std::size_t bytes, std::size_t count,
+          const std::string& operation, double value, const std::string& unit) {
+    std::cout << container << "," << bytes << "," << count << "," << operation << "," << value
+              << "," << unit << "\n";
+}
+
+template<typename C, std::size_t Bytes>
+void measure(const std::string& name, std::size_t count, std::mt19937_64& rng) {
+    std::vector<std::uint64_t> keys(count);
+    std::iota(keys.begin(), keys.end(), std::uint64_t{0});
+    for (auto& key : keys) {
+        key = key * 0x9E3779B97F4A7C15ull;  // unique, spread over the key space
+    }
+    std::shuffle(keys.begin(), keys.end(), rng);
+    std::vector<std::uint64_t> probes = keys;
+    std::shuffle(probes.begin(), probes.end(), rng);
+
+    // Small counts build many containers so every timing covers enough work
+    const std::size_t copies = std::max<std::size_t>(1, kTargetElements / count);
+    std::vector<C> containers;
+    containers.reserve(copies);
+
+    // Containers are constructed inside the scope: deque allocates up front
+    core::alloc::AllocationScope scope;
+    double seconds = bench::timeSeconds([&] {
+        for (std::size_t copy = 0; copy < copies; ++copy) {
+            C& c = containers.emplace_back();
+            for (std::uint64_t key : keys) {
+                insertOne(c, key);
+            }
+        }
+    });
+    const auto built = static_cast<double>(copies * count);
+    emit(name, Bytes, count, "insert", seconds * 1e9 / built, "ns/element");
+    emit(name, Bytes, count, "memory", static_cast<double>(scope.counters().netBytes()) / built,
+         "bytes/element");
+
+    std::uint64_t checksum = 0;
+    if constexpr (!kIsQueue<C>) {
+        std::size_t lookups = kTargetElements;
+        if constexpr (kIsSequence<C>) {
+            lookups = std::clamp<std::size_t>(kLinearBudget / count, 1, kTargetElements);
+        }
+        C& c = containers.front();
+        seconds = bench::timeSeconds([&] {
+            for (std::size_t i = 0; i < lookups; ++i) {
+                checksum += findKey(c, probes[i % count]) != c.end();
+            }
+        });
+        emit(name, Bytes, count, "lookup", seconds * 1e9 / static_cast<double>(lookups),
+             "ns/op");
+
+        seconds = bench::timeSeconds([&] {
+            for (const auto& each : containers) {
+                for (const auto& value : each) {
+                    checksum += keyOf(each, value);
+                }
+            }
+        });
+        emit(name, Bytes, count, "iterate", seconds * 1e9 / built, "ns/element");
+    }
+
+    // Erase up to the budget from each copy, by key in random order
+    std::size_t perCopy = count;
+    if constexpr (kIsSequence<C>) {
+        perCopy = std::clamp<std::size_t>(kLinearBudget / count / copies, 1, count);
+    } else if constexpr (!kIsQueue<C>) {
+        perCopy = std::min(count, kTargetElements);
+    }
+    seconds = bench::timeSeconds([&] {
+        for (auto& c : containers) {
+            for (std::size_t i = 0; i < perCopy; ++i) {
+                if constexpr (kIsQueue<C>) {
+                    checksum += c.top().key;
+                    c.pop();
+                } else {
+                    c.erase(findKey(c, probes[i]));
+                }
+            }
+        }
+    });
+    emit(name, Bytes, count, "erase", seconds * 1e9 / static_cast<double>(perCopy * copies),
+         "ns/op");
+    bench::doNotOptimize(checksum);
+}
+
+template<std::size_t Bytes>
+void measureAll(std::size_t count, std::size_t budgetBytes, std::mt19937_64& rng) {
+    using E = Element<Bytes>;
+    // Peak of the hungriest container plus the key and probe arrays. Node
+    // containers pay kNodeOverhead per element; a vector briefly holds its
+    // old and doubled buffers (under 3x) while it grows.
+    const std::size_t perElement =
+        std::max(Bytes + kNodeOverhead, 3 * Bytes) + 2 * sizeof(std::uint64_t);
+    const std::size_t estimate = count * perElement;
+    if (estimate > budgetBytes) {
+        std::cerr << "skipping " << Bytes << "-byte elements at count " << count
+                  << " (over memory budget)\n";
+        return;
+    }
+    measure<std::vector<E>, Bytes>("vector", count, rng);
+    measure<std::deque<E>, Bytes>("deque", count, rng);
+    measure<std::list<E>, Bytes>("list", count, rng);
+    measure<std::map<std::uint64_t, E>, Bytes>("map", count, rng);
+    measure<std::unordered_map<std::uint64_t, E>, Bytes>("unordered_map", count, rng);
+    measure<std::set<E>, Bytes>("set", count, rng);
+    measure<std::priority_queue<E>, Bytes>("priority_queue", count, rng);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t maxCount = bench::argCount(argc, argv, 1, 10'000'000);
+    const std::size_t budgetBytes = bench::argCount(argc, argv, 2, 3072) << 20;
+
+    std::mt19937_64 rng(42);
+    std::cout << "container,element_bytes,count,operation,value,unit\n";
+    for (std::size_t count = 10; count <= maxCount; count *= 10) {
+        measureAll<8>(count, budgetBytes, rng);
+        measureAll<64>(count, budgetBytes, rng);
+        measureAll<256>(count, budgetBytes, rng);
+        std::cout.flush();
+    }
+    return 0;
+}
@@ -0,0 +1,98 @@
+/**
+ * @file alloc_tracker.hpp
+ * @brief Allocation counting and per-call-site statistics
+ *
+ * Linking the opt-in `core_alloc_tracker` library replaces the global
+ * operator new/delete family. Every allocation then updates plain
+ * thread-local counters, which AllocationScope turns into "what did this
+ * block allocate" measurements. When a sample rate is set, every Nth
+ * allocation also captures its call stack and is charged to a per-call-site
+ * table with allocation, byte and peak live-byte totals.
+ *
+ * Only operator new/delete are seen; direct malloc() calls are not.
+ *
+ * @author Modern C++ Starter Template
+ * @date 2025
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <vector>
+
+namespace core::alloc {
+
+/// Allocation counters for one thread (or the part of it inside a scope).
+struct Counters {
+    std::uint64_t allocations = 0;
+    std::uint64_t deallocations = 0;
+    std::uint64_t bytesAllocated = 0;
+    std::uint64_t bytesFreed = 0;
+    std::int64_t peakBytes = 0;  ///< highest live-byte level above the starting point
+
+    std::int64_t netBytes() const {
+        return static_cast<std::int64_t>(bytesAllocated) - static_cast<std::int64_t>(bytesFreed);
+    }
+};
+
+/// Lifetime counters of the calling thread.
+Counters threadCounters();
+
+/**
+ * @brief Measures the allocations the current thread makes while it lives
+ *
+ * Scopes nest and must be destroyed in reverse order of creation (as
+ * locals are); each one reports only what happened since it was created.
+ *
+ * Example usage:
+ * core::alloc::AllocationScope scope;
+ * hotPath();
+ * EXPECT_EQ(scope.allocations(), 0u);
+ */
+class AllocationScope {
+public:
+    AllocationScope();
+    ~AllocationScope();
+
+    AllocationScope(const AllocationScope&) = delete;
+    AllocationScope& operator=(const AllocationScope&) = delete;
+
+    Counters counters() const;
+    std::uint64_t allocations() const { return counters().allocations; }
+    std::uint64_t bytesAllocated() const { return counters().bytesAllocated; }
+
+private:
+    Counters start_;
+    std::int64_t outerPeak_ = 0;
+    const AllocationScope* parent_ = nullptr;
+};
+
+/// Estimated totals for one sampled call stack (sampled counts x sample rate).
+struct CallSite {
+    std::vector<void*> frames;  ///< innermost caller first
+    std::uint64_t allocations = 0;
+    std::uint64_t bytes = 0;
+    std::int64_t liveBytes = 0;
+    std::int64_t peakBytes = 0;
+};
+
+/**
+ * @brief Captures the stack of every @p everyN-th allocation per thread
+ *
+ * 0 (the default) disables sampling; 1 records every allocation.
+ */
+void setSampleRate(std::uint32_t everyN);
+std::uint32_t sampleRate();
+
+/// Recorded call sites, largest byte total first.
+std::vector<CallSite> callSites();
+
+/// Zeroes call-site totals; live bytes are kept so later frees stay balanced.
+void resetCallSites();
+
+/// Writes the top @p maxSites call sites with symbolized frames where available.
+void writeReport(std::ostream& out, std::size_t maxSites = 10);
+
+}  // namespace core::alloc
@@ -0,0 +1,129 @@
+/**
+ * @file bounded_queue.hpp
+ * @brief Bounded lock-free multi-producer/multi-consumer queue
+ *
+ * Array-based queue after Dmitry Vyukov's bounded MPMC design. Each cell
+ * carries a sequence number telling producers and consumers whose turn it
+ * is, so a push or pop is one CAS on the shared position plus one store to
+ * the cell. The enqueue and dequeue positions live on separate cache lines.
+ *
+ * @author Modern C++ Starter Template
+ * @date 2025
+ */
+
+#pragma once
+
+#include "core/stress_point.hpp"
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace core {
+
+/**
+ * @brief Fixed-capacity MPMC FIFO; tryPush/tryPop never block
+ *
+ * Example usage:
+ * core::BoundedQueue<int> queue(1024);
+ * queue.tryPush(42);
+ * int value;
+ * if (queue.tryPop(value)) { ... }
+ */
+template<typename T>
+class BoundedQueue {
+    static_assert(std::is_default_constructible_v<T>,
+                  "BoundedQueue<T> requires a default-constructible T");
+    static_assert(std::is_nothrow_move_assignable_v<T>,
+                  "BoundedQueue<T> requires noexcept move assignment");
+
+public:
+    /// @param capacity rounded up to the next power of two (minimum 2)
+    explicit BoundedQueue(std::size_t capacity)
+        : capacity_(std::bit_ceil(capacity < 2 ? std::size_t{2} : capacity)),
+          mask_(capacity_ - 1),
+          cells_(std::make_unique<Cell[]>(capacity_)) {
+        for (std::size_t i = 0; i < capacity_; ++i) {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    BoundedQueue(const BoundedQueue&) = delete;
+    BoundedQueue& operator=(const BoundedQueue&) = delete;
+
+    /// @return false if the queue is full
+    bool tryPush(T value) {
+        std::size_t position = enqueuePos_.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell& cell = cells_[position & mask_];
+            const std::size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(sequence - position);
+            CORE_STRESS_POINT("bounded_queue.push.claim");
+            if (diff == 0) {
+                if (enqueuePos_.compare_exchange_weak(position, position + 1,
+                                                      std::memory_order_relaxed)) {
+                    CORE_STRESS_POINT("bounded_queue.push.publish");
+                    cell.value = std::move(value);
+                    cell.sequence.store(position + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                position = enqueuePos_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /// @return false if the queue is empty
+    bool tryPop(T& out) {
+        std::size_t position = dequeuePos_.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell& cell = cells_[position & mask_];
+            const std::size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(sequence - (position + 1));
+            CORE_STRESS_POINT("bounded_queue.pop.claim");
+            if (diff == 0) {
+                if (dequeuePos_.compare_exchange_weak(position, position + 1,
+                                                      std::memory_order_relaxed)) {
+                    CORE_STRESS_POINT("bounded_queue.pop.release");
+                    out = std::move(cell.value);
+                    cell.sequence.store(position + capacity_, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                position = dequeuePos_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    std::size_t capacity() const { return capacity_; }
+
+    /// Approximate number of queued items (exact when quiescent).
+    std::size_t sizeApprox() const {
+        const std::size_t tail = enqueuePos_.load(std::memory_order_relaxed);
+        const std::size_t head = dequeuePos_.load(std::memory_order_relaxed);
+        return tail > head ? tail - head : 0;
+    }
+
+    bool emptyApprox() const { return sizeApprox() == 0; }
+
+private:
+    struct Cell {
+        std::atomic<std::size_t> sequence{0};
+        T value{};
+    };
+
+    const std::size_t capacity_;
+    const std::size_t mask_;
+    std::unique_ptr<Cell[]> cells_;
+    alignas(64) std::atomic<std::size_t> enqueuePos_{0};
+    alignas(64) std::atomic<std::size_t> dequeuePos_{0};
+};
+
+}  // namespace core
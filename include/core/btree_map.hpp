@@ -0,0 +1,1039 @@
+/**
+ * @file btree_map.hpp
+ * @brief Ordered map stored as a B+tree with wide, contiguous nodes
+ *
+ * core::BTreeMap<K, V> keeps many keys per node in one array, so a lookup
+ * touches a few cache lines per level instead of one node per comparison
+ * as in std::map's red-black tree. Values live only in the leaves. Inner
+ * nodes hold copies of separator keys and child pointers. Leaves are
+ * linked in both directions, so iteration and range scans walk arrays and
+ * never go back up the tree.
+ *
+ * Node capacity comes from the NodeBytes template argument: each node holds
+ * about NodeBytes of keys plus values (leaves) or keys plus child pointers
+ * (inner nodes). The default of 1 KiB gives 64 slots for 8-byte keys and
+ * values, so 10^6 entries fit in four levels. A binary search reads about
+ * six of a node's 16 cache lines. Each level costs one cache miss, so
+ * smaller nodes mean more levels and slower lookups, while larger nodes make
+ * inserts shift more elements.
+ *
+ * Bulk construction sorts once and builds the tree bottom-up with full
+ * leaves; input tagged core::sorted_unique skips the sort. Inserts and
+ * erases split, borrow and merge as usual. Every node but the root stays
+ * at least half full.
+ *
+ * Keys must be copyable (separators are copies) and both keys and values
+ * must be nothrow movable. Insertion and erasure invalidate iterators into
+ * the nodes they touch; treat every iterator as invalidated by a modification.
+ *
+ * @author Modern C++ Starter Template
+ * @date 2025
+ */
+
+#pragma once
+
+#include "core/flat_map.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace core {
+
+namespace detail {
+
+/// Uninitialized storage for N objects; the owning node tracks which are live.
+template<typename T, std::size_t N>
+struct BTreeSlots {
+    BTreeSlots() noexcept {}
+    ~BTreeSlots() {}
+    BTreeSlots(const BTreeSlots&) = delete;
+    BTreeSlots& operator=(const BTreeSlots&) = delete;
+
+    union {
+        T items[N];
+    };
+};
+
+/// Inserts @p item at @p pos into the live range [items, items + count).
+template<typename T>
+void btreeInsertAt(T* items, std::size_t count, std::size_t pos, T& item) noexcept {
+    if (pos == count) {
+        std::construct_at(items + count, std::move(item));
+        return;
+    }
+    std::construct_at(items + count, std::move(items[count - 1]));
+    std::move_backward(items + pos, items + count - 1, items + count);
+    items[pos] = std::move(item);
+}
+
+/// Removes the element at @p pos from the live range [items, items + count).
+template<typename T>
+void btreeEraseAt(T* items, std::size_t count, std::size_t pos) noexcept {
+    std::move(items + pos + 1, items + count, items + pos);
+    std::destroy_at(items + count - 1);
+}
+
+/// Moves [src, src + count) to the end of the live range [dst, dst + size).
+template<typename T>
+void btreeAppend(T* dst, std::size_t size, T* src, std::size_t count) noexcept {
+    std::uninitialized_move_n(src, count, dst + size);
+    std::destroy_n(src, count);
+}
+
+/**
+ * Splits the sequence "src with @p item inserted at @p pos" (count + 1
+ * elements): the first @p keep stay in src, the rest move to uninitialized
+ * @p dst.
+ */
+template<typename T>
+void btreeSplitInsert(T* src, std::size_t count, std::size_t pos, T& item, std::size_t keep,
+                      T* dst) noexcept {
+    std::size_t out = 0;
+    for (std::size_t j = keep; j <= count; ++j) {
+        T& from = j < pos ? src[j] : (j == pos ? item : src[j - 1]);
+        std::construct_at(dst + out++, std::move(from));
+    }
+    if (pos < keep) {
+        std::move_backward(src + pos, src + keep - 1, src + keep);
+        src[pos] = std::move(item);
+    }
+    std::destroy(src + keep, src + count);
+}
+
+}  // namespace detail
+
+/**
+ * @brief Ordered map stored as a B+tree with linked leaves
+ *
+ * Iterators are bidirectional and dereference to a proxy
+ * std::pair<const Key&, T&>, as with core::FlatMap.
+ *
+ * Example usage:
+ * core::BTreeMap<std::uint64_t, std::string> orders;
+ * orders[1001] = "pending";
+ * for (auto it = orders.lower_bound(1000); it != orders.end() && it->first < 2000; ++it) { ... }
+ * orders.scan(1000, 2000, [](std::uint64_t id, const std::string& state) { ... });
+ *
+ * core::BTreeMap<int, int> table(core::sorted_unique, sortedPairs.begin(), sortedPairs.end());
+ */
+template<typename Key, typename T, typename Compare = std::less<>, std::size_t NodeBytes = 1024>
+class BTreeMap {
+    template<bool Const>
+    class Iterator;
+
+    static_assert(std::is_nothrow_move_constructible_v<Key> &&
+                      std::is_nothrow_move_assignable_v<Key>,
+                  "BTreeMap keys must be nothrow movable");
+    static_assert(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T>,
+                  "BTreeMap values must be nothrow movable");
+
+public:
+    using key_type = Key;
+    using mapped_type = T;
+    using value_type = std::pair<Key, T>;
+    using key_compare = Compare;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = std::pair<const Key&, T&>;
+    using const_reference = std::pair<const Key&, const T&>;
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    /// Entries per leaf and separator keys per inner node.
+    static constexpr size_type kLeafSlots =
+        std::clamp<size_type>(NodeBytes / (sizeof(Key) + sizeof(T)), 4, 4096);
+    static constexpr size_type kInnerSlots =
+        std::clamp<size_type>(NodeBytes / (sizeof(Key) + sizeof(void*)), 4, 4096);
+
+    BTreeMap() noexcept(std::is_nothrow_default_constructible_v<Compare>) = default;
+    explicit BTreeMap(const Compare& compare) : compare_(compare) {}
+
+    /// Bulk construction: one stable sort, first of equal keys wins.
+    template<std::input_iterator It>
+    BTreeMap(It first, It last, const Compare& compare = Compare()) : compare_(compare) {
+        std::vector<value_type> items;
+        for (; first != last; ++first) {
+            items.emplace_back((*first).first, (*first).second);
+        }
+        std::stable_sort(items.begin(), items.end(), [this](const auto& a, const auto& b) {
+            return compare_(a.first, b.first);
+        });
+        const auto unique = std::unique(items.begin(), items.end(),
+                                        [this](const auto& a, const auto& b) {
+                                            return !compare_(a.first, b.first);
+                                        });
+        bulkLoad(std::make_move_iterator(items.begin()),
+                 static_cast<size_type>(unique - items.begin()));
+    }
+
+    /// Bottom-up construction from input already sorted with unique keys.
+    template<std::forward_iterator It>
+    BTreeMap(sorted_unique_t, It first, It last, const Compare& compare = Compare())
+        : compare_(compare) {
+        bulkLoad(first, static_cast<size_type>(std::distance(first, last)));
+    }
+
+    BTreeMap(std::initializer_list<value_type> init, const Compare& compare = Compare())
+        : BTreeMap(init.begin(), init.end(), compare) {}
+
+    BTreeMap(const BTreeMap& other) : compare_(other.compare_) {
+        bulkLoad(other.begin(), other.size());
+    }
+
+    BTreeMap(BTreeMap&& other) noexcept
+        : root_(std::exchange(other.root_, nullptr)),
+          head_(std::exchange(other.head_, nullptr)),
+          tail_(std::exchange(other.tail_, nullptr)),
+          size_(std::exchange(other.size_, 0)),
+          height_(std::exchange(other.height_, 0)),
+          compare_(other.compare_) {}
+
+    BTreeMap& operator=(const BTreeMap& other) {
+        if (this != &other) {
+            BTreeMap copy(other);
+            swap(copy);
+        }
+        return *this;
+    }
+
+    BTreeMap& operator=(BTreeMap&& other) noexcept {
+        if (this != &other) {
+            clear();
+            swap(other);
+        }
+        return *this;
+    }
+
+    ~BTreeMap() { clear(); }
+
+    iterator begin() noexcept { return iterator(head_, 0); }
+    iterator end() noexcept { return iterator(tail_, tail_ ? tail_->count : 0); }
+    const_iterator begin() const noexcept { return const_iterator(head_, 0); }
+    const_iterator end() const noexcept {
+        return const_iterator(tail_, tail_ ? tail_->count : 0);
+    }
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+    reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+    reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+    const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+    const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+
+    bool empty() const noexcept { return size_ == 0; }
+    size_type size() const noexcept { return size_; }
+    /// Levels above the leaves: 0 while everything fits in one leaf.
+    size_type height() const noexcept { return height_; }
+
+    void clear() noexcept {
+        if (root_ != nullptr) {
+            destroyTree(root_);
+        }
+        root_ = nullptr;
+        head_ = tail_ = nullptr;
+        size_ = 0;
+        height_ = 0;
+    }
+
+    key_compare key_comp() const { return compare_; }
+
+    template<typename K>
+        requires detail::kFlatLookup<Compare, Key, K>
+    iterator find(const K& key) {
+        const auto [leaf, pos] = findSlot(key);
+        return leaf ? iterator(leaf, pos) : end();
+    }
+    iterator find(const Key& key) { return find<Key>(key); }
+
+    template<typename K>
+        requires detail::kFlatLookup<Compare, Key, K>
+    const_iterator find(const K& key) const {
+        const auto [leaf, pos] = findSlot(key);
+        return leaf ? const_iterator(leaf, pos) : end();
+    }
+    const_iterator find(const Key& key) const { return find<Key>(key); }
+
+    template<typename K>
+        requires detail::kFlatLookup<Compare, Key, K>
+    bool contains(const K& key) const {
+        return findSlot(key).first != nullptr;
+    }
+    bool contains(const Key& key) const { return contains<Key>(key); }
+
+    template<typename K>
+        requires detail::kFlatLookup<Compare, Key, K>
+    size_type count(const K& key) const {
+        return contains(key) ? 1 : 0;
+    }
+    size_type count(const Key& key) const { return count<Key>(key); }
+
+    template<typename K>
+        requires detail::kFlatLookup<Compare, Key, K>
+    iterator lower_bound(const K& key) {
+        return boundAt<iterator>(key, false);
+    }
+    iterator lower_bound(const Key& key) { return lower_bound<Key>(key); }
+
+    template<typename K>
+        requires detail::kFlatLookup<Compare, Key, K>
+    const_iterator lower_bound(const K& key) const {
+        return boundAt<const_iterator>(key, false);
+    }
+    const_iterator lower_bound(const Key& key) const { return lower_bound<Key>(key); }
+
+    template<typename K>
+        requires detail::kFlatLookup<Compare, Key, K>
+    iterator upper_bound(const K& key) {
+        return boundAt<iterator>(key, true);
+    }
+    iterator upper_bound(const Key& key) { return upper_bound<Key>(key); }
+
+    template<typename K>
+        requires detail::kFlatLookup<Compare, Key, K>
+    const_iterator upper_bound(const K& key) const {
+        return boundAt<const_iterator>(key, true);
+    }
+    const_iterator upper_bound(const Key& key) const { return upper_bound<Key>(key); }
+
+    template<typename K>
+        requires detail::kFlatLookup<Compare, Key, K>
+    std::pair<iterator, iterator> equal_range(const K& key) {
+        return {lower_bound(key), upper_bound(key)};
+    }
+    std::pair<iterator, iterator> equal_range(const Key& key) { return equal_range<Key>(key); }
+
+    template<typename K>
+        requires detail::kFlatLookup<Compare, Key, K>
+    std::pair<const_iterator, const_iterator> equal_range(const K& key) const {
+        return {lower_bound(key), upper_bound(key)};
+    }
+    std::pair<const_iterator, const_iterator> equal_range(const Key& key) const {
+        return equal_range<Key>(key);
+    }
+
+    /**
+     * @brief Calls fn(key, value) for every key in [from, to), in order
+     *
+     * Walks the linked leaves one array at a time; cheaper per element than
+     * stepping an iterator from lower_bound(from).
+     */
+    template<typename K, typename Fn>
+        requires detail::kFlatLookup<Compare, Key, K>
+    void scan(const K& from, const K& to, Fn&& fn) const {
+        if (root_ == nullptr) {
+            return;
+        }
+        const Leaf* leaf = leafFor(from);
+        size_type pos = lowerIndex(leaf, from);
+        for (; leaf != nullptr; leaf = leaf->next, pos = 0) {
+            for (; pos < leaf->count; ++pos) {
+                const Key& key = leaf->keys.items[pos];
+                if (!compare_(key, to)) {
+                    return;
+                }
+                const T& value = leaf->values.items[pos];
+                fn(key, value);
+            }
+        }
+    }
+
+    template<typename K>
+        requires detail::kFlatLookup<Compare, Key, K>
+    T& at(const K& key) {
+        return checkedValue(key);
+    }
+    T& at(const Key& key) { return at<Key>(key); }
+
+    template<typename K>
+        requires detail::kFlatLookup<Compare, Key, K>
+    const T& at(const K& key) const {
+        return checkedValue(key);
+    }
+    const T& at(const Key& key) const { return at<Key>(key); }
+
+    T& operator[](const Key& key) { return (*try_emplace(key).first).second; }
+    T& operator[](Key&& key) { return (*try_emplace(std::move(key)).first).second; }
+
+    template<typename... Args>
+    std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args) {
+        return emplaceKey(key, std::forward<Args>(args)...);
+    }
+
+    template<typename... Args>
+    std::pair<iterator, bool> try_emplace(Key&& key, Args&&... args) {
+        return emplaceKey(std::move(key), std::forward<Args>(args)...);
+    }
+
+    template<typename M>
+    std::pair<iterator, bool> insert_or_assign(const Key& key, M&& value) {
+        auto result = try_emplace(key, std::forward<M>(value));
+        if (!result.second) {
+            (*result.first).second = std::forward<M>(value);
+        }
+        return result;
+    }
+
+    std::pair<iterator, bool> insert(const value_type& value) {
+        return try_emplace(value.first, value.second);
+    }
+
+    std::pair<iterator, bool> insert(value_type&& value) {
+        return try_emplace(std::move(value.first), std::move(value.second));
+    }
+
+    template<typename... Args>
+    std::pair<iterator, bool> emplace(Args&&... args) {
+        value_type value(std::forward<Args>(args)...);
+        return try_emplace(std::move(value.first), std::move(value.second));
+    }
+
+    template<typename K>
+        requires(detail::kFlatLookup<Compare, Key, K> && !std::is_convertible_v<K, const_iterator>)
+    size_type erase(const K& key) {
+        if (root_ == nullptr) {
+            return 0;
+        }
+        Path path;
+        Leaf* leaf = leafFor(key, path);
+        const size_type pos = lowerIndex(leaf, key);
+        if (pos == leaf->count || compare_(key, leaf->keys.items[pos])) {
+            return 0;
+        }
+        eraseFromLeaf(leaf, pos, path);
+        return 1;
+    }
+    size_type erase(const Key& key) { return erase<Key>(key); }
+
+    /// Erases the element at @p position and returns the iterator after it.
+    iterator erase(const_iterator position) {
+        Leaf* leaf = position.leaf_;
+        const size_type pos = position.index_;
+        if (leaf == root_ || leaf->count > kMinLeaf) {
+            // No rebalancing: the successor stays in this leaf or the next
+            eraseLeafEntry(leaf, pos);
+            if (leaf->count == 0) {
+                clear();
+                return end();
+            }
+            return pos < leaf->count || leaf->next == nullptr ? iterator(leaf, pos)
+                                                              : iterator(leaf->next, 0);
+        }
+        // Borrowing or merging moves entries between leaves: find the successor again
+        const_iterator next = std::next(position);
+        if (next == cend()) {
+            erase(leaf->keys.items[pos]);
+            return end();
+        }
+        Key successor((*next).first);
+        erase(leaf->keys.items[pos]);
+        return lower_bound(successor);
+    }
+
+    void swap(BTreeMap& other) noexcept {
+        using std::swap;
+        swap(root_, other.root_);
+        swap(head_, other.head_);
+        swap(tail_, other.tail_);
+        swap(size_, other.size_);
+        swap(height_, other.height_);
+        swap(compare_, other.compare_);
+    }
+
+    friend void swap(BTreeMap& a, BTreeMap& b) noexcept { a.swap(b); }
+
+    friend bool operator==(const BTreeMap& a, const BTreeMap& b) {
+        return a.size() == b.size() &&
+               std::equal(a.begin(), a.end(), b.begin(), [](const auto& x, const auto& y) {
+                   return x.first == y.first && x.second == y.second;
+               });
+    }
+
+private:
+    static constexpr size_type kMinLeaf = kLeafSlots / 2;
+    static constexpr size_type kMinInner = kInnerSlots / 2;
+    /// Inner nodes have at least 3 children, so 48 levels exceed any size_t count.
+    static constexpr size_type kMaxHeight = 48;
+
+    struct Node {
+        std::uint16_t count = 0;  ///< live keys
+        bool leaf;
+    };
+
+    struct Leaf : Node {
+        Leaf() noexcept : Node{0, true} {}
+        Leaf* prev = nullptr;
+        Leaf* next = nullptr;
+        detail::BTreeSlots<Key, kLeafSlots> keys;
+        detail::BTreeSlots<T, kLeafSlots> values;
+    };
+
+    struct Inner : Node {
+        Inner() noexcept : Node{0, false} {}
+        detail::BTreeSlots<Key, kInnerSlots> keys;
+        Node* children[kInnerSlots + 1];
+    };
+
+    static_assert(kLeafSlots <= UINT16_MAX && kInnerSlots <= UINT16_MAX);
+
+    struct PathEntry {
+        Inner* node;
+        size_type index;  ///< child taken
+    };
+    using Path = PathEntry[kMaxHeight];
+
+    static Inner* asInner(Node* node) noexcept { return static_cast<Inner*>(node); }
+    static Leaf* asLeaf(Node* node) noexcept { return static_cast<Leaf*>(node); }
+
+    static void destroyNode(Node* node) noexcept {
+        if (node->leaf) {
+            Leaf* leaf = asLeaf(node);
+            std::destroy_n(leaf->keys.items, leaf->count);
+            std::destroy_n(leaf->values.items, leaf->count);
+            delete leaf;
+        } else {
+            Inner* inner = asInner(node);
+            std::destroy_n(inner->keys.items, inner->count);
+            delete inner;
+        }
+    }
+
+    static void destroyTree(Node* node) noexcept {
+        if (!node->leaf) {
+            Inner* inner = asInner(node);
+            for (size_type i = 0; i <= inner->count; ++i) {
+                destroyTree(inner->children[i]);
+            }
+        }
+        destroyNode(node);
+    }
+
+    template<typename K>
+    size_type childIndex(const Inner* inner, const K& key) const {
+        // Keys equal to a separator live in the subtree to its right
+        return static_cast<size_type>(
+            std::upper_bound(inner->keys.items, inner->keys.items + inner->count, key, compare_) -
+            inner->keys.items);
+    }
+
+    template<typename K>
+    size_type lowerIndex(const Leaf* leaf, const K& key) const {
+        return static_cast<size_type>(
+            std::lower_bound(leaf->keys.items, leaf->keys.items + leaf->count, key, compare_) -
+            leaf->keys.items);
+    }
+
+    template<typename K>
+    size_type upperIndex(const Leaf* leaf, const K& key) const {
+        return static_cast<size_type>(
+            std::upper_bound(leaf->keys.items, leaf->keys.items + leaf->count, key, compare_) -
+            leaf->keys.items);
+    }
+
+    /// Leaf whose key range covers @p key; the tree must not be empty.
+    template<typename K>
+    Leaf* leafFor(const K& key) const {
+        Node* node = root_;
+        for (size_type level = 0; level < height_; ++level) {
+            Inner* inner = asInner(node);
+            node = inner->children[childIndex(inner, key)];
+        }
+        return asLeaf(node);
+    }
+
+    /// As leafFor, recording the inner node and child index at each level.
+    template<typename K>
+    Leaf* leafFor(const K& key, Path& path) const {
+        Node* node = root_;
+        for (size_type level = 0; level < height_; ++level) {
+            Inner* inner = asInner(node);
+            const size_type index = childIndex(inner, key);
+            path[level] = {inner, index};
+            node = inner->children[index];
+        }
+        return asLeaf(node);
+    }
+
+    /// Leaf and position of @p key, or {nullptr, 0} when absent.
+    template<typename K>
+    std::pair<Leaf*, size_type> findSlot(const K& key) const {
+        if (root_ == nullptr) {
+            return {nullptr, 0};
+        }
+        Leaf* leaf = leafFor(key);
+        const size_type pos = lowerIndex(leaf, key);
+        if (pos == leaf->count || compare_(key, leaf->keys.items[pos])) {
+            return {nullptr, 0};
+        }
+        return {leaf, pos};
+    }
+
+    template<typename It, typename K>
+    It boundAt(const K& key, bool upper) const {
+        if (root_ == nullptr) {
+            return It(nullptr, 0);
+        }
+        Leaf* leaf = leafFor(key);
+        const size_type pos = upper ? upperIndex(leaf, key) : lowerIndex(leaf, key);
+        if (pos == leaf->count && leaf->next != nullptr) {
+            return It(leaf->next, 0);
+        }
+        return It(leaf, pos);
+    }
+
+    template<typename K>
+    T& checkedValue(const K& key) const {
+        const auto [leaf, pos] = findSlot(key);
+        if (leaf == nullptr) {
+            throw std::out_of_range("BTreeMap::at: key not found");
+        }
+        return leaf->values.items[pos];
+    }
+
+    template<typename K, typename... Args>
+    std::pair<iterator, bool> emplaceKey(K&& key, Args&&... args) {
+        if (root_ == nullptr) {
+            auto leaf = std::make_unique<Leaf>();
+            T value(std::forward<Args>(args)...);
+            Key ownKey(std::forward<K>(key));
+            std::construct_at(leaf->values.items, std::move(value));
+            std::construct_at(leaf->keys.items, std::move(ownKey));
+            leaf->count = 1;
+            root_ = head_ = tail_ = leaf.release();
+            size_ = 1;
+            return {iterator(head_, 0), true};
+        }
+
+        Path path;
+        Leaf* leaf = leafFor(key, path);
+        const size_type pos = lowerIndex(leaf, key);
+        if (pos < leaf->count && !compare_(key, leaf->keys.items[pos])) {
+            return {iterator(leaf, pos), false};
+        }
+
+        // Everything that can throw happens before the tree changes
+        T value(std::forward<Args>(args)...);
+        Key ownKey(std::forward<K>(key));
+        if (leaf->count < kLeafSlots) {
+            detail::btreeInsertAt(leaf->keys.items, leaf->count, pos, ownKey);
+            detail::btreeInsertAt(leaf->values.items, leaf->count, pos, value);
+            ++leaf->count;
+            ++size_;
+            return {iterator(leaf, pos), true};
+        }
+        return {splitInsert(leaf, pos, ownKey, value, path), true};
+    }
+
+    /// Inserts into a full leaf, splitting it and as many ancestors as needed.
+    iterator splitInsert(Leaf* leaf, size_type pos, Key& key, T& value, Path& path) {
+        constexpr size_type kKeep = (kLeafSlots + 1) / 2;
+
+        // Allocate every node the split can need, and copy the separator
+        size_type splits = 0;
+        while (splits < height_ && path[height_ - 1 - splits].node->count == kInnerSlots) {
+            ++splits;
+        }
+        const bool newRoot = splits == height_;
+        auto rightLeaf = std::make_unique<Leaf>();
+        std::unique_ptr<Inner> spare[kMaxHeight + 1];  // indexed by level; [height_] is a new root
+        for (size_type level = height_ - splits; level < height_; ++level) {
+            spare[level] = std::make_unique<Inner>();
+        }
+        if (newRoot) {
+            spare[height_] = std::make_unique<Inner>();
+        }
+        Key separator(pos == kKeep ? key : leaf->keys.items[pos < kKeep ? kKeep - 1 : kKeep]);
+
+        // From here on nothing throws
+        Leaf* right = rightLeaf.release();
+        detail::btreeSplitInsert(leaf->keys.items, kLeafSlots, pos, key, kKeep, right->keys.items);
+        detail::btreeSplitInsert(leaf->values.items, kLeafSlots, pos, value, kKeep,
+                                 right->values.items);
+        leaf->count = static_cast<std::uint16_t>(kKeep);
+        right->count = static_cast<std::uint16_t>(kLeafSlots + 1 - kKeep);
+        right->prev = leaf;
+        right->next = leaf->next;
+        (leaf->next ? leaf->next->prev : tail_) = right;
+        leaf->next = right;
+        ++size_;
+        const iterator inserted = pos < kKeep ? iterator(leaf, pos) : iterator(right, pos - kKeep);
+
+        Node* child = right;
+        for (size_type level = height_; level-- > 0;) {
+            const auto [inner, index] = path[level];
+            if (inner->count < kInnerSlots) {
+                detail::btreeInsertAt(inner->keys.items, inner->count, index, separator);
+                std::copy_backward(inner->children + index + 1, inner->children + inner->count + 1,
+                                   inner->children + inner->count + 2);
+                inner->children[index + 1] = child;
+                ++inner->count;
+                return inserted;
+            }
+            child = splitInner(inner, index, separator, child, spare[level].release());
+        }
+
+        Inner* root = spare[height_].release();
+        std::construct_at(root->keys.items, std::move(separator));
+        root->children[0] = root_;
+        root->children[1] = child;
+        root->count = 1;
+        root_ = root;
+        ++height_;
+        return inserted;
+    }
+
+    /**
+     * Inserts (separator, child) after child @p index of a full inner node,
+     * moving the upper half into @p right. On return @p separator holds the
+     * key to insert into the parent.
+     */
+    static Inner* splitInner(Inner* inner, size_type index, Key& separator, Node* child,
+                             Inner* right) noexcept {
+        constexpr size_type kKeep = kInnerSlots / 2;
+        constexpr size_type kMoved = kInnerSlots + 1 - kKeep;  // includes the promoted key
+
+        Node* children[kInnerSlots + 2];
+        std::copy_n(inner->children, index + 1, children);
+        children[index + 1] = child;
+        std::copy(inner->children + index + 1, inner->children + kInnerSlots + 1,
+                  children + index + 2);
+
+        // The first moved key goes up; the rest become the right node's keys
+        detail::btreeSplitInsert(inner->keys.items, kInnerSlots, index, separator, kKeep,
+                                 right->keys.items);
+        separator = std::move(right->keys.items[0]);
+        detail::btreeEraseAt(right->keys.items, kMoved, 0);
+
+        inner->count = static_cast<std::uint16_t>(kKeep);
+        right->count = static_cast<std::uint16_t>(kMoved - 1);
+        std::copy_n(children, kKeep + 1, inner->children);
+        std::copy_n(children + kKeep + 1, kMoved, right->children);
+        return right;
+    }
+
+    void eraseLeafEntry(Leaf* leaf, size_type pos) noexcept {
+        detail::btreeEraseAt(leaf->keys.items, leaf->count, pos);
+        detail::btreeEraseAt(leaf->values.items, leaf->count, pos);
+        --leaf->count;
+        --size_;
+    }
+
+    static void unlinkLeaf(Leaf* leaf, Leaf*& tail) noexcept {
+        leaf->prev->next = leaf->next;
+        (leaf->next ? leaf->next->prev : tail) = leaf->prev;
+    }
+
+    /// Removes key @p index and child @p index + 1 from an inner node.
+    static void eraseInnerEntry(Inner* inner, size_type index) noexcept {
+        detail::btreeEraseAt(inner->keys.items, inner->count, index);
+        std::copy(inner->children + index + 2, inner->children + inner->count + 1,
+                  inner->children + index + 1);
+        --inner->count;
+    }
+
+    void eraseFromLeaf(Leaf* leaf, size_type pos, Path& path) {
+        eraseLeafEntry(leaf, pos);
+        if (height_ == 0) {
+            if (leaf->count == 0) {
+                clear();
+            }
+            return;
+        }
+        if (leaf->count >= kMinLeaf) {
+            return;
+        }
+
+        auto [parent, index] = path[height_ - 1];
+        Leaf* left = index > 0 ? asLeaf(parent->children[index - 1]) : nullptr;
+        Leaf* right = index < parent->count ? asLeaf(parent->children[index + 1]) : nullptr;
+
+        // Borrowing copies the new separator first; if that throws the
+        // leaf is left underfull, which is still a valid tree
+        if (left != nullptr && left->count > kMinLeaf) {
+            Key separator(left->keys.items[left->count - 1]);
+            detail::btreeInsertAt(leaf->keys.items, leaf->count, 0,
+                                  left->keys.items[left->count - 1]);
+            detail::btreeInsertAt(leaf->values.items, leaf->count, 0,
+                                  left->values.items[left->count - 1]);
+            --left->count;
+            std::destroy_at(left->keys.items + left->count);
+            std::destroy_at(left->values.items + left->count);
+            ++leaf->count;
+            parent->keys.items[index - 1] = std::move(separator);
+            return;
+        }
+        if (right != nullptr && right->count > kMinLeaf) {
+            Key separator(right->keys.items[1]);
+            std::construct_at(leaf->keys.items + leaf->count, std::move(right->keys.items[0]));
+            std::construct_at(leaf->values.items + leaf->count, std::move(right->values.items[0]));
+            ++leaf->count;
+            detail::btreeEraseAt(right->keys.items, right->count, 0);
+            detail::btreeEraseAt(right->values.items, right->count, 0);
+            --right->count;
+            parent->keys.items[index] = std::move(separator);
+            return;
+        }
+
+        // Merge into the left neighbour when there is one, else absorb the right
+        if (left != nullptr) {
+            mergeLeaves(left, leaf);
+            eraseInnerEntry(parent, index - 1);
+        } else {
+            mergeLeaves(leaf, right);
+            eraseInnerEntry(parent, index);
+        }
+        rebalanceInner(path, height_ - 1);
+    }
+
+    /// Moves every entry of @p right into @p left and frees @p right.
+    void mergeLeaves(Leaf* left, Leaf* right) noexcept {
+        detail::btreeAppend(left->keys.items, left->count, right->keys.items, right->count);
+        detail::btreeAppend(left->values.items, left->count, right->values.items, right->count);
+        left->count = static_cast<std::uint16_t>(left->count + right->count);
+        right->count = 0;
+        unlinkLeaf(right, tail_);
+        delete right;
+    }
+
+    /// Restores the minimum fill of path[level].node after it lost an entry.
+    void rebalanceInner(Path& path, size_type level) noexcept {
+        for (;; --level) {
+            Inner* node = path[level].node;
+            if (level == 0) {
+                if (node->count == 0) {
+                    root_ = node->children[0];
+                    delete node;
+                    --height_;
+                }
+                return;
+            }
+            if (node->count >= kMinInner) {
+                return;
+            }
+
+            auto [parent, index] = path[level - 1];
+            Inner* left = index > 0 ? asInner(parent->children[index - 1]) : nullptr;
+            Inner* right = index < parent->count ? asInner(parent->children[index + 1]) : nullptr;
+
+            // Rotations move the parent separator down and a sibling key up
+            if (left != nullptr && left->count > kMinInner) {
+                detail::btreeInsertAt(node->keys.items, node->count, 0,
+                                      parent->keys.items[index - 1]);
+                std::copy_backward(node->children, node->children + node->count + 1,
+                                   node->children + node->count + 2);
+                node->children[0] = left->children[left->count];
+                ++node->count;
+                parent->keys.items[index - 1] = std::move(left->keys.items[left->count - 1]);
+                --left->count;
+                std::destroy_at(left->keys.items + left->count);
+                return;
+            }
+            if (right != nullptr && right->count > kMinInner) {
+                std::construct_at(node->keys.items + node->count,
+                                  std::move(parent->keys.items[index]));
+                node->children[node->count + 1] = right->children[0];
+                ++node->count;
+                parent->keys.items[index] = std::move(right->keys.items[0]);
+                detail::btreeEraseAt(right->keys.items, right->count, 0);
+                std::copy(right->children + 1, right->children + right->count + 1,
+                          right->children);
+                --right->count;
+                return;
+            }
+
+            if (left != nullptr) {
+                mergeInner(left, parent->keys.items[index - 1], node);
+                eraseInnerEntry(parent, index - 1);
+            } else {
+                mergeInner(node, parent->keys.items[index], right);
+                eraseInnerEntry(parent, index);
+            }
+        }
+    }
+
+    /// Appends @p separator and all of @p right to @p left, then frees @p right.
+    static void mergeInner(Inner* left, Key& separator, Inner* right) noexcept {
+        std::construct_at(left->keys.items + left->count, std::move(separator));
+        detail::btreeAppend(left->keys.items, left->count + 1, right->keys.items, right->count);
+        std::copy_n(right->children, right->count + 1, left->children + left->count + 1);
+        left->count = static_cast<std::uint16_t>(left->count + 1 + right->count);
+        right->count = 0;
+        delete right;
+    }
+
+    /**
+     * Builds the tree bottom-up from @p n sorted, unique elements: leaves
+     * first, split evenly so each is at least half full, then each inner
+     * level over the one below.
+     */
+    template<typename It>
+    void bulkLoad(It first, size_type n) {
+        if (n == 0) {
+            return;
+        }
+        std::vector<Node*> level;
+        std::vector<const Key*> lowest;  // smallest key under each node of `level`
+        try {
+            const size_type leaves = (n + kLeafSlots - 1) / kLeafSlots;
+            level.reserve(leaves);
+            lowest.reserve(leaves);
+            Leaf* previous = nullptr;
+            for (size_type i = 0; i < leaves; ++i) {
+                Leaf* leaf = new Leaf();
+                level.push_back(leaf);
+                leaf->prev = previous;
+                if (previous != nullptr) {
+                    previous->next = leaf;
+                }
+                const size_type count = n / leaves + (i < n % leaves ? 1 : 0);
+                for (size_type j = 0; j < count; ++j, ++first) {
+                    // Value first: a key is live only when its value is
+                    std::construct_at(leaf->values.items + j, (*first).second);
+                    try {
+                        std::construct_at(leaf->keys.items + j, (*first).first);
+                    } catch (...) {
+                        std::destroy_at(leaf->values.items + j);
+                        throw;
+                    }
+                    ++leaf->count;
+                }
+                lowest.push_back(leaf->keys.items);
+                previous = leaf;
+            }
+            head_ = asLeaf(level.front());
+            tail_ = asLeaf(level.back());
+
+            while (level.size() > 1) {
+                const size_type groups = (level.size() + kInnerSlots) / (kInnerSlots + 1);
+                std::vector<Node*> parents;
+                std::vector<const Key*> parentLowest;
+                parents.reserve(groups);
+                parentLowest.reserve(groups);
+                try {
+                    size_type next = 0;
+                    for (size_type g = 0; g < groups; ++g) {
+                        const size_type children =
+                            level.size() / groups + (g < level.size() % groups ? 1 : 0);
+                        Inner* inner = new Inner();
+                        parents.push_back(inner);
+                        std::copy_n(level.begin() + static_cast<difference_type>(next), children,
+                                    inner->children);
+                        for (size_type c = 1; c < children; ++c) {
+                            std::construct_at(inner->keys.items + c - 1, *lowest[next + c]);
+                            ++inner->count;
+                        }
+                        parentLowest.push_back(lowest[next]);
+                        next += children;
+                    }
+                } catch (...) {
+                    // The children are still owned by `level`
+                    for (Node* parent : parents) {
+                        destroyNode(parent);
+                    }
+                    throw;
+                }
+                level = std::move(parents);
+                lowest = std::move(parentLowest);
+                ++height_;
+            }
+        } catch (...) {
+            // Built levels are complete subtrees; the current level owns all of them
+            for (Node* node : level) {
+                destroyTree(node);
+            }
+            head_ = tail_ = nullptr;
+            height_ = 0;
+            throw;
+        }
+        root_ = level.front();
+        size_ = n;
+    }
+
+    Node* root_ = nullptr;
+    Leaf* head_ = nullptr;
+    Leaf* tail_ = nullptr;
+    size_type size_ = 0;
+    size_type height_ = 0;
+    [[no_unique_address]] Compare compare_;
+};
+
+/// Bidirectional iterator over the linked leaves of a BTreeMap.
+template<typename Key, typename T, typename Compare, std::size_t NodeBytes>
+template<bool Const>
+class BTreeMap<Key, T, Compare, NodeBytes>::Iterator {
+    using Mapped = std::conditional_t<Const, const T, T>;
+
+public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = std::pair<Key, T>;
+    using difference_type = std::ptrdiff_t;
+    using reference = std::pair<const Key&, Mapped&>;
+
+    /// Makes `it->first` and `it->second` work on the proxy reference.
+    struct pointer {
+        reference ref;
+        const reference* operator->() const noexcept { return &ref; }
+    };
+
+    Iterator() noexcept = default;
+
+    template<bool OtherConst>
+        requires(Const && !OtherConst)
+    Iterator(const Iterator<OtherConst>& other) noexcept
+        : leaf_(other.leaf_), index_(other.index_) {}
+
+    reference operator*() const noexcept {
+        return {leaf_->keys.items[index_], leaf_->values.items[index_]};
+    }
+    pointer operator->() const noexcept { return pointer{**this}; }
+
+    Iterator& operator++() noexcept {
+        if (++index_ == leaf_->count && leaf_->next != nullptr) {
+            leaf_ = leaf_->next;
+            index_ = 0;
+        }
+        return *this;
+    }
+    Iterator operator++(int) noexcept {
+        Iterator old = *this;
+        ++*this;
+        return old;
+    }
+    Iterator& operator--() noexcept {
+        if (index_ == 0) {
+            leaf_ = leaf_->prev;
+            index_ = leaf_->count;
+        }
+        --index_;
+        return *this;
+    }
+    Iterator operator--(int) noexcept {
+        Iterator old = *this;
+        --*this;
+        return old;
+    }
+
+    friend bool operator==(const Iterator& a, const Iterator& b) noexcept {
+        return a.leaf_ == b.leaf_ && a.index_ == b.index_;
+    }
+
+private:
+    friend class BTreeMap;
+    friend class Iterator<!Const>;
+
+    Iterator(Leaf* leaf, size_type index) noexcept : leaf_(leaf), index_(index) {}
+
+    Leaf* leaf_ = nullptr;
+    size_type index_ = 0;
+};
+
+}  // namespace core
@@ -0,0 +1,444 @@
+/**
+ * @file channel.hpp
+ * @brief Go-style channels with awaitable send/receive and select
+ *
+ * core::Channel<T> connects coroutines (see core::Task). A full channel
+ * suspends the sending coroutine and an empty one suspends the receiver;
+ * no thread ever blocks. Capacity 0 gives an unbuffered (rendezvous)
+ * channel where every send waits for its receiver.
+ *
+ * When an operation completes a waiting counterpart, that coroutine is
+ * resumed inline on the completing thread, just before the completing
+ * operation itself returns. A producer/consumer pair therefore ping-pongs on
+ * one thread without context switches or syscalls.
+ *
+ * core::select() waits on several channels at once and completes with the
+ * first one that has a value (or is closed).
+ *
+ * @author Modern C++ Starter Template
+ * @date 2025
+ */
+
+#pragma once
+
+#include "core/stress_point.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <coroutine>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace core {
+
+template<typename... Ts>
+class SelectAwaiter;
+
+namespace detail {
+
+/// Decides which channel completes a pending select (first one wins).
+struct SelectState {
+    static constexpr int kRegistering = 0;  // select still adding itself to channels
+    static constexpr int kWaiting = 1;      // coroutine suspended
+    static constexpr int kFired = 2;        // a channel has delivered
+
+    std::atomic<int> state{kRegistering};
+    std::size_t index = 0;
+};
+
+enum class Claim {
+    Failed,    // another channel already completed the select
+    Resume,    // caller delivers and must resume the waiter
+    NoResume   // caller delivers; the select has not suspended yet
+};
+
+/// Claims a receive waiter; plain (non-select) waiters always succeed.
+inline Claim claim(SelectState* select, std::size_t index) {
+    if (select == nullptr) {
+        return Claim::Resume;
+    }
+    int expected = select->state.load(std::memory_order_acquire);
+    while (expected != SelectState::kFired) {
+        if (select->state.compare_exchange_weak(expected, SelectState::kFired,
+                                                std::memory_order_acq_rel)) {
+            select->index = index;
+            return expected == SelectState::kWaiting ? Claim::Resume : Claim::NoResume;
+        }
+    }
+    return Claim::Failed;
+}
+
+}  // namespace detail
+
+/**
+ * @brief Thread-safe channel whose send/receive are awaited from coroutines
+ *
+ * Example usage:
+ * core::Channel<int> ch(16);                     // buffered; Channel<int>(0) is unbuffered
+ * bool sent = co_await ch.send(42);              // false if the channel is closed
+ * std::optional<int> v = co_await ch.receive();  // std::nullopt once closed and drained
+ * ch.close();
+ */
+template<typename T>
+class Channel {
+    struct SendWaiter {
+        std::coroutine_handle<> handle;
+        T* value = nullptr;
+        bool* sent = nullptr;
+    };
+
+    struct ReceiveWaiter {
+        std::coroutine_handle<> handle;
+        std::optional<T>* slot = nullptr;
+        detail::SelectState* select = nullptr;
+        std::size_t index = 0;
+    };
+
+public:
+    /// Awaitable returned by send(); yields true if the value was delivered.
+    class SendAwaiter {
+    public:
+        SendAwaiter(Channel& channel, T value) : channel_(channel), value_(std::move(value)) {}
+        SendAwaiter(const SendAwaiter&) = delete;
+        SendAwaiter& operator=(const SendAwaiter&) = delete;
+
+        bool await_ready() const noexcept { return false; }
+
+        bool await_suspend(std::coroutine_handle<> handle) {
+            CORE_STRESS_POINT("channel.send");
+            std::coroutine_handle<> wake;
+            {
+                std::lock_guard<std::mutex> lock(channel_.mutex_);
+                if (channel_.closed_) {
+                    sent_ = false;
+                } else if (channel_.sendLocked(value_, wake)) {
+                    sent_ = true;
+                } else {
+                    waiter_ = SendWaiter{handle, &value_, &sent_};
+                    channel_.senders_.push_back(&waiter_);
+                    return true;  // may already be resumed elsewhere: touch nothing after unlock
+                }
+            }
+            if (wake) {
+                wake.resume();
+            }
+            return false;
+        }
+
+        bool await_resume() const noexcept { return sent_; }
+
+    private:
+        Channel& channel_;
+        T value_;
+        bool sent_ = false;
+        SendWaiter waiter_;
+    };
+
+    /// Awaitable returned by receive(); yields std::nullopt once closed and drained.
+    class ReceiveAwaiter {
+    public:
+        explicit ReceiveAwaiter(Channel& channel) : channel_(channel) {}
+        ReceiveAwaiter(const ReceiveAwaiter&) = delete;
+        ReceiveAwaiter& operator=(const ReceiveAwaiter&) = delete;
+
+        bool await_ready() const noexcept { return false; }
+
+        bool await_suspend(std::coroutine_handle<> handle) {
+            CORE_STRESS_POINT("channel.receive");
+            std::coroutine_handle<> wake;
+            {
+                std::lock_guard<std::mutex> lock(channel_.mutex_);
+                if (!channel_.receiveLocked(result_, wake)) {
+                    waiter_ = ReceiveWaiter{handle, &result_, nullptr, 0};
+                    channel_.receivers_.push_back(&waiter_);
+                    return true;
+                }
+            }
+            if (wake) {
+                wake.resume();
+            }
+            return false;
+        }
+
+        std::optional<T> await_resume() { return std::move(result_); }
+
+    private:
+        Channel& channel_;
+        std::optional<T> result_;
+        ReceiveWaiter waiter_;
+    };
+
+    /// @param capacity buffered slots; 0 makes every send a rendezvous
+    explicit Channel(std::size_t capacity = 0) : capacity_(capacity) {}
+
+    Channel(const Channel&) = delete;
+    Channel& operator=(const Channel&) = delete;
+
+    SendAwaiter send(T value) { return SendAwaiter(*this, std::move(value)); }
+
+    ReceiveAwaiter receive() { return ReceiveAwaiter(*this); }
+
+    /// Non-suspending send; @p value is moved from only on success.
+    bool trySend(T& value) {
+        std::coroutine_handle<> wake;
+        bool sent = false;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            sent = !closed_ && sendLocked(value, wake);
+        }
+        if (wake) {
+            wake.resume();
+        }
+        return sent;
+    }
+
+    /// Non-suspending receive; std::nullopt if nothing is available right now.
+    std::optional<T> tryReceive() {
+        std::optional<T> result;
+        std::coroutine_handle<> wake;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (buffer_.empty() && senders_.empty()) {
+                return std::nullopt;
+            }
+            receiveLocked(result, wake);
+        }
+        if (wake) {
+            wake.resume();
+        }
+        return result;
+    }
+
+    /**
+     * @brief Closes the channel
+     *
+     * Pending and future sends yield false. Receivers drain the buffer and
+     * then get std::nullopt.
+     */
+    void close() {
+        std::vector<std::coroutine_handle<>> wake;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (closed_) {
+                return;
+            }
+            closed_ = true;
+            for (ReceiveWaiter* receiver : receivers_) {
+                const auto claim = detail::claim(receiver->select, receiver->index);
+                if (claim != detail::Claim::Failed) {
+                    receiver->slot->reset();
+                    if (claim == detail::Claim::Resume) {
+                        wake.push_back(receiver->handle);
+                    }
+                }
+            }
+            receivers_.clear();
+            for (SendWaiter* sender : senders_) {
+                *sender->sent = false;
+                wake.push_back(sender->handle);
+            }
+            senders_.clear();
+        }
+        for (auto handle : wake) {
+            handle.resume();
+        }
+    }
+
+    bool closed() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return closed_;
+    }
+
+    std::size_t capacity() const { return capacity_; }
+
+    /// Buffered values not yet received.
+    std::size_t size() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return buffer_.size();
+    }
+
+private:
+    template<typename... Ts>
+    friend class SelectAwaiter;
+
+    // Hands @p value to a waiting receiver or the buffer; requires mutex_
+    bool sendLocked(T& value, std::coroutine_handle<>& wake) {
+        while (!receivers_.empty()) {
+            ReceiveWaiter* receiver = receivers_.front();
+            receivers_.pop_front();
+            const auto claim = detail::claim(receiver->select, receiver->index);
+            if (claim == detail::Claim::Failed) {
+                continue;  // that select already completed on another channel
+            }
+            receiver->slot->emplace(std::move(value));
+            if (claim == detail::Claim::Resume) {
+                wake = receiver->handle;
+            }
+            return true;
+        }
+        if (buffer_.size() < capacity_) {
+            buffer_.push_back(std::move(value));
+            return true;
+        }
+        return false;
+    }
+
+    // Takes the next value (or the closed marker) if one is ready; requires mutex_
+    bool receiveLocked(std::optional<T>& out, std::coroutine_handle<>& wake) {
+        if (!buffer_.empty()) {
+            out.emplace(std::move(buffer_.front()));
+            buffer_.pop_front();
+            if (!senders_.empty()) {
+                SendWaiter* sender = senders_.front();
+                senders_.pop_front();
+                buffer_.push_back(std::move(*sender->value));
+                *sender->sent = true;
+                wake = sender->handle;
+            }
+            return true;
+        }
+        if (!senders_.empty()) {
+            SendWaiter* sender = senders_.front();
+            senders_.pop_front();
+            out.emplace(std::move(*sender->value));
+            *sender->sent = true;
+            wake = sender->handle;
+            return true;
+        }
+        if (closed_) {
+            out.reset();
+            return true;
+        }
+        return false;
+    }
+
+    bool readyLocked() const { return !buffer_.empty() || !senders_.empty() || closed_; }
+
+    mutable std::mutex mutex_;
+    const std::size_t capacity_;
+    std::deque<T> buffer_;
+    std::deque<SendWaiter*> senders_;
+    std::deque<ReceiveWaiter*> receivers_;
+    bool closed_ = false;
+};
+
+/// Outcome of co_await core::select(...).
+template<typename... Ts>
+struct SelectResult {
+    std::size_t index = 0;                    ///< which channel completed
+    std::tuple<std::optional<Ts>...> values;  ///< only values[index] is set; nullopt = closed
+
+    template<std::size_t I>
+    auto& get() {
+        return std::get<I>(values);
+    }
+};
+
+/**
+ * @brief Awaitable that receives from whichever channel is ready first
+ *
+ * Channels are tried in argument order, so an earlier channel wins when
+ * several are ready at the moment of the call.
+ */
+template<typename... Ts>
+class SelectAwaiter {
+public:
+    explicit SelectAwaiter(Channel<Ts>&... channels) : channels_(&channels...) {}
+    SelectAwaiter(const SelectAwaiter&) = delete;
+    SelectAwaiter& operator=(const SelectAwaiter&) = delete;
+
+    bool await_ready() const noexcept { return false; }
+
+    bool await_suspend(std::coroutine_handle<> handle) {
+        state_.state.store(detail::SelectState::kRegistering, std::memory_order_relaxed);
+        bool fired = false;
+        std::coroutine_handle<> wake;
+        registerAll(handle, fired, wake, std::index_sequence_for<Ts...>{});
+
+        if (!fired) {
+            int expected = detail::SelectState::kRegistering;
+            if (state_.state.compare_exchange_strong(expected, detail::SelectState::kWaiting,
+                                                     std::memory_order_acq_rel)) {
+                return true;  // suspended; a channel will resume us
+            }
+            // A channel fired while we were still registering
+        }
+        unregisterAll(std::index_sequence_for<Ts...>{});
+        if (wake) {
+            wake.resume();
+        }
+        return false;
+    }
+
+    SelectResult<Ts...> await_resume() {
+        if (!unregistered_) {
+            unregisterAll(std::index_sequence_for<Ts...>{});
+        }
+        return SelectResult<Ts...>{state_.index, std::move(slots_)};
+    }
+
+private:
+    template<std::size_t... I>
+    void registerAll(std::coroutine_handle<> handle, bool& fired, std::coroutine_handle<>& wake,
+                     std::index_sequence<I...>) {
+        ((fired || (registerOne<I>(handle, fired, wake), true)), ...);
+    }
+
+    template<std::size_t I>
+    void registerOne(std::coroutine_handle<> handle, bool& fired, std::coroutine_handle<>& wake) {
+        CORE_STRESS_POINT("channel.select.register");
+        auto& channel = *std::get<I>(channels_);
+        std::lock_guard<std::mutex> lock(channel.mutex_);
+        if (channel.readyLocked()) {
+            if (detail::claim(&state_, I) != detail::Claim::Failed) {
+                channel.receiveLocked(std::get<I>(slots_), wake);
+            }
+            fired = true;  // by us, or by a channel registered earlier
+            return;
+        }
+        auto& waiter = std::get<I>(waiters_);
+        waiter = {handle, &std::get<I>(slots_), &state_, I};
+        channel.receivers_.push_back(&waiter);
+    }
+
+    // Locking each channel also orders us after the winning channel's delivery
+    template<std::size_t... I>
+    void unregisterAll(std::index_sequence<I...>) {
+        (unregisterOne<I>(), ...);
+        unregistered_ = true;
+    }
+
+    template<std::size_t I>
+    void unregisterOne() {
+        auto& channel = *std::get<I>(channels_);
+        std::lock_guard<std::mutex> lock(channel.mutex_);
+        auto& receivers = channel.receivers_;
+        receivers.erase(std::remove(receivers.begin(), receivers.end(), &std::get<I>(waiters_)),
+                        receivers.end());
+    }
+
+    std::tuple<Channel<Ts>*...> channels_;
+    std::tuple<std::optional<Ts>...> slots_;
+    std::tuple<typename Channel<Ts>::ReceiveWaiter...> waiters_;
+    detail::SelectState state_;
+    bool unregistered_ = false;
+};
+
+/**
+ * @brief Waits until one of @p channels can be received from
+ *
+ * Example usage:
+ * auto result = co_await core::select(orders, cancellations);
+ * if (result.index == 0 && result.get<0>()) handle(*result.get<0>());
+ */
+template<typename... Ts>
+SelectAwaiter<Ts...> select(Channel<Ts>&... channels) {
+    return SelectAwaiter<Ts...>(channels...);
+}
+
+}  // namespace core
@@ -0,0 +1,33 @@
+/**
+ * @file cpu_relax.hpp
+ * @brief Spin-wait hint for busy loops
+ *
+ * @author Modern C++ Starter Template
+ * @date 2025
+ */
+
+#pragma once
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#endif
+
+namespace core {
+
+/**
+ * @brief Tells the CPU the caller is spinning (x86 `pause`, ARM `yield`)
+ *
+ * Reduces power use and the memory-order mis-speculation penalty when the
+ * spin ends; compiles to nothing on other architectures.
+ */
+inline void cpuRelax() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    _mm_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    asm volatile("yield" ::: "memory");
+#endif
+}
+
+}  // namespace core
@@ -0,0 +1,120 @@
+/**
+ * @file cuckoo_filter.hpp
+ * @brief Cuckoo filter: an approximate set that supports deletion
+ *
+ * core::CuckooFilter answers the same "definitely absent / maybe present"
+ * question as core::BloomFilter, but stores a short fingerprint per key
+ * instead of setting bits, so keys can be erased again. Each key has two
+ * candidate buckets of four fingerprint slots; the second bucket is
+ * derived from the first and the fingerprint alone, which lets a full
+ * bucket evict a resident fingerprint to its other bucket ("cuckoo"
+ * insertion). A query reads at most two buckets and compares four
+ * fingerprints in each with one word-wide (SWAR) test.
+ *
+ * The fingerprint width is 8, 16 or 32 bits, the smallest that meets the
+ * requested false-positive rate (a query compares against 8 slots, so the
+ * rate is about 8 / 2^bits). The table is sized so @p capacity keys fit
+ * at no more than 96% load. Once the table is truly full, insert returns
+ * false and leaves the filter unchanged.
+ *
+ * Inserting the same key twice stores two copies; erase removes one.
+ * Erasing a key that was never inserted can remove another key's
+ * matching fingerprint, so only erase keys known to be present.
+ *
+ * @author Modern C++ Starter Template
+ * @date 2025
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace core {
+
+/**
+ * @brief Approximate set with deletion, two buckets of four fingerprints per key
+ *
+ * Example usage:
+ * core::CuckooFilter sessions(100'000, 0.001);   // 16-bit fingerprints
+ * sessions.insert(sessionId);
+ * if (sessions.contains(sessionId)) { ... }        // maybe present
+ * sessions.erase(sessionId);                       // gone again
+ */
+class CuckooFilter {
+public:
+    /// @throws std::invalid_argument unless 0 < falsePositiveRate < 1
+    CuckooFilter(std::size_t capacity, double falsePositiveRate);
+
+    /// Adds a key hashed with @p Hash; false if the filter is full.
+    template<typename Key, typename Hash = std::hash<Key>>
+    bool insert(const Key& key) {
+        return insertHash(static_cast<std::uint64_t>(Hash{}(key)));
+    }
+
+    /// False means the key is absent; true means it probably is present.
+    template<typename Key, typename Hash = std::hash<Key>>
+    bool contains(const Key& key) const {
+        return containsHash(static_cast<std::uint64_t>(Hash{}(key)));
+    }
+
+    /// Removes one copy of a previously inserted key; false if none was found.
+    template<typename Key, typename Hash = std::hash<Key>>
+    bool erase(const Key& key) {
+        return eraseHash(static_cast<std::uint64_t>(Hash{}(key)));
+    }
+
+    /// Hash-level interface; weak hashes (such as identity hashes) are remixed.
+    bool insertHash(std::uint64_t hash);
+    bool containsHash(std::uint64_t hash) const noexcept;
+    bool eraseHash(std::uint64_t hash) noexcept;
+
+    void clear() noexcept;
+
+    std::size_t size() const noexcept { return size_; }
+    std::size_t bucketCount() const noexcept { return mask_ + 1; }
+    std::size_t slotCount() const noexcept { return bucketCount() * kSlotsPerBucket; }
+    double loadFactor() const noexcept {
+        return static_cast<double>(size_) / static_cast<double>(slotCount());
+    }
+    unsigned fingerprintBits() const noexcept { return fingerprintBytes_ * 8; }
+    /// False-positive rate once every slot is occupied.
+    double expectedFalsePositiveRate() const noexcept;
+    std::size_t memoryBytes() const noexcept { return table_.size(); }
+
+private:
+    static constexpr std::size_t kSlotsPerBucket = 4;
+
+    struct Victim {
+        std::size_t bucket = 0;
+        std::uint32_t fingerprint = 0;
+        bool used = false;
+    };
+
+    std::uint8_t* bucket(std::size_t index) noexcept {
+        return table_.data() + index * kSlotsPerBucket * fingerprintBytes_;
+    }
+    const std::uint8_t* bucket(std::size_t index) const noexcept {
+        return table_.data() + index * kSlotsPerBucket * fingerprintBytes_;
+    }
+
+    /// First bucket and fingerprint of a key hash.
+    std::pair<std::size_t, std::uint32_t> locate(std::uint64_t hash) const noexcept;
+    std::size_t alternate(std::size_t index, std::uint32_t fingerprint) const noexcept;
+    bool bucketHas(std::size_t index, std::uint32_t fingerprint) const noexcept;
+    bool bucketAdd(std::size_t index, std::uint32_t fingerprint) noexcept;
+    bool bucketRemove(std::size_t index, std::uint32_t fingerprint) noexcept;
+    void relocate(std::size_t index, std::uint32_t fingerprint) noexcept;
+
+    std::vector<std::uint8_t> table_;
+    std::size_t mask_;
+    unsigned fingerprintBytes_;
+    std::size_t size_ = 0;
+    Victim victim_;
+    std::uint64_t rng_ = 0x9e3779b97f4a7c15ULL;
+};
+
+}  // namespace core
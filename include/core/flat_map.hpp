@@ -0,0 +1,717 @@
+/**
+ * @file flat_map.hpp
+ * @brief Sorted-vector associative containers: FlatMap and FlatSet
+ *
+ * core::FlatMap<K, V> keeps its keys in one sorted std::vector<K> and its
+ * values in a parallel std::vector<V>; core::FlatSet<K> is the key array
+ * alone. Lookups are binary searches over contiguous keys, so they touch
+ * few cache lines, and iteration is a linear walk. Inserting or erasing in
+ * the middle shifts elements (O(n)), so these suit tables that are built
+ * once, or in bulk, and then read many times.
+ *
+ * Bulk construction from unsorted input does one sort and one dedupe pass.
+ * When keys repeat, the first occurrence wins, as with std::map::insert.
+ *
+ * The default comparator is std::less<>, which is transparent: a
+ * FlatMap<std::string, V> can be searched with a string_view or a string
+ * literal without building a std::string.
+ *
+ * @author Modern C++ Starter Template
+ * @date 2025
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <compare>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace core {
+
+/// Tag: the input is already sorted and free of duplicates; skip the sort.
+struct sorted_unique_t {
+    explicit sorted_unique_t() = default;
+};
+inline constexpr sorted_unique_t sorted_unique{};
+
+namespace detail {
+
+/// True when Compare can compare Key against K without converting K.
+template<typename Compare, typename Key, typename K>
+inline constexpr bool kFlatLookup =
+    std::is_same_v<K, Key> || requires { typename Compare::is_transparent; };
+
+template<typename Key, typename Compare>
+bool flatSortedUnique(const std::vector<Key>& keys, const Compare& compare) {
+    return std::adjacent_find(keys.begin(), keys.end(), [&](const Key& a, const Key& b) {
+               return !compare(a, b);
+           }) == keys.end();
+}
+
+/**
+ * @brief What FlatMap iterators dereference to: references into both arrays
+ *
+ * A std::pair<const Key&, Mapped&> under its own name, so it can declare a
+ * common reference with the map's value_type; C++20 iterator concepts
+ * need one, and for two std::pairs of references it is ambiguous.
+ */
+template<typename Key, typename Mapped>
+struct FlatMapReference : std::pair<const Key&, Mapped&> {
+    using Base = std::pair<const Key&, Mapped&>;
+    using Base::Base;
+
+    /// Mutable to const.
+    template<typename Other>
+        requires(!std::is_same_v<Other, Mapped> && std::is_convertible_v<Other&, Mapped&>)
+    FlatMapReference(const FlatMapReference<Key, Other>& other) noexcept
+        : Base(other.first, other.second) {}
+
+    /// Binds to a materialized value_type.
+    template<typename Pair>
+        requires std::is_same_v<std::remove_cvref_t<Pair>,
+                                std::pair<Key, std::remove_const_t<Mapped>>> &&
+                 std::is_convertible_v<decltype((std::declval<Pair&>().second)), Mapped&>
+    FlatMapReference(Pair&& pair) noexcept : Base(pair.first, pair.second) {}
+};
+
+}  // namespace detail
+
+/**
+ * @brief Sorted set of unique keys in one contiguous array
+ *
+ * Example usage:
+ * core::FlatSet<int> primes{7, 2, 5, 3, 2};   // {2, 3, 5, 7}
+ * primes.contains(5);                         // binary search
+ * const std::vector<int>& raw = primes.keys();
+ */
+template<typename Key, typename Compare = std::less<>>
+class FlatSet {
+public:
+    using key_type = Key;
+    using value_type = Key;
+    using key_compare = Compare;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = const Key&;
+    using const_reference = const Key&;
+    using const_iterator = typename std::vector<Key>::const_iterator;
+    using iterator = const_iterator;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+    using reverse_iterator = const_reverse_iterator;
+
+    FlatSet() = default;
+    explicit FlatSet(const Compare& compare) : compare_(compare) {}
+
+    /// Takes ownership of @p keys, then sorts and dedupes them.
+    explicit FlatSet(std::vector<Key> keys, const Compare& compare = Compare())
+        : keys_(std::move(keys)), compare_(compare) {
+        normalize();
+    }
+
+    /// Adopts keys that are already sorted and unique.
+    FlatSet(sorted_unique_t, std::vector<Key> keys, const Compare& compare = Compare())
+        : keys_(std::move(keys)), compare_(compare) {}
+
+    template<std::input_iterator It>
+    FlatSet(It first, It last, const Compare& compare = Compare())
+        : FlatSet(std::vector<Key>(first, last), compare) {}
+
+    FlatSet(std::initializer_list<Key> init, const Compare& compare = Compare())
+        : FlatSet(std::vector<Key>(init), compare) {}
+
+    const_iterator begin() const noexcept { return keys_.begin(); }
+    const_iterator end() const noexcept { return keys_.end(); }
+    const_iterator cbegin() const noexcept { return keys_.begin(); }
+    const_iterator cend() const noexcept { return keys_.end(); }
+    const_reverse_iterator rbegin() const noexcept { return keys_.rbegin(); }
+    const_reverse_iterator rend() const noexcept { return keys_.rend(); }
+
+    bool empty() const noexcept { return keys_.empty(); }
+    size_type size() const noexcept { return keys_.size(); }
+    void reserve(size_type count) { keys_.reserve(count); }
+    void shrink_to_fit() { keys_.shrink_to_fit(); }
+    void clear() noexcept { keys_.clear(); }
+
+    /// The sorted key array.
+    const std::vector<Key>& keys() const noexcept { return keys_; }
+    /// Moves the sorted key array out, leaving the set empty.
+    std::vector<Key> extract() && { return std::move(keys_); }
+
+    key_compare key_comp() const { return compare_; }
+
+    template<typename... Args>
+    std::pair<iterator, bool> emplace(Args&&... args) {
+        return insert(Key(std::forward<Args>(args)...));
+    }
+
+    std::pair<iterator, bool> insert(const Key& key) { return insertKey(key); }
+    std::pair<iterator, bool> insert(Key&& key) { return insertKey(std::move(key)); }
+
+    /// Appends the range, sorts the new tail and merges it in; existing keys win.
+    template<std::input_iterator It>
+    void insert(It first, It last) {
+        const auto oldSize = static_cast<difference_type>(keys_.size());
+        keys_.insert(keys_.end(), first, last);
+        std::stable_sort(keys_.begin() + oldSize, keys_.end(), compare_);
+        std::inplace_merge(keys_.begin(), keys_.begin() + oldSize, keys_.end(), compare_);
+        dedupe();
+    }
+
+    void insert(std::initializer_list<Key> init) { insert(init.begin(), init.end()); }
+
+    iterator erase(const_iterator position) { return keys_.erase(position); }
+    iterator erase(const_iterator first, const_iterator last) { return keys_.erase(first, last); }
+
+    template<typename K>
+        requires(detail::kFlatLookup<Compare, Key, K> && !std::is_convertible_v<K, const_iterator>)
+    size_type erase(const K& key) {
+        auto it = find(key);
+        if (it == end()) {
+            return 0;
+        }
+        keys_.erase(it);
+        return 1;
+    }
+    size_type erase(const Key& key) { return erase<Key>(key); }
+
+    template<typename K>
+        requires detail::kFlatLookup<Compare, Key, K>
+    const_iterator lower_bound(const K& key) const {
+        return std::lower_bound(keys_.begin(), keys_.end(), key, compare_);
+    }
+    const_iterator lower_bound(const Key& key) const { return lower_bound<Key>(key); }
+
+    template<typename K>
+        requires detail::kFlatLookup<Compare, Key, K>
+    const_iterator upper_bound(const K& key) const {
+        return std::upper_bound(keys_.begin(), keys_.end(), key, compare_);
+    }
+    const_iterator upper_bound(const Key& key) const { return upper_bound<Key>(key); }
+
+    template<typename K>
+        requires detail::kFlatLookup<Compare, Key, K>
+    std::pair<const_iterator, const_iterator> equal_range(const K& key) const {
+        return std::equal_range(keys_.begin(), keys_.end(), key, compare_);
+    }
+    std::pair<const_iterator, const_iterator> equal_range(const Key& key) const {
+        return equal_range<Key>(key);
+    }
+
+    template<typename K>
+        requires detail::kFlatLookup<Compare, Key, K>
+    const_iterator find(const K& key) const {
+        auto it = lower_bound(key);
+        return (it != keys_.end() && !compare_(key, *it)) ? it : keys_.end();
+    }
+    const_iterator find(const Key& key) const { return find<Key>(key); }
+
+    template<typename K>
+        requires detail::kFlatLookup<Compare, Key, K>
+    bool contains(const K& key) const {
+        return find(key) != end();
+    }
+    bool contains(const Key& key) const { return contains<Key>(key); }
+
+    template<typename K>
+        requires detail::kFlatLookup<Compare, Key, K>
+    size_type count(const K& key) const {
+        return contains(key) ? 1 : 0;
+    }
+    size_type count(const Key& key) const { return count<Key>(key); }
+
+    friend bool operator==(const FlatSet& a, const FlatSet& b) { return a.keys_ == b.keys_; }
+
+    void swap(FlatSet& other) noexcept {
+        using std::swap;
+        swap(keys_, other.keys_);
+        swap(compare_, other.compare_);
+    }
+    friend void swap(FlatSet& a, FlatSet& b) noexcept { a.swap(b); }
+
+private:
+    template<typename K>
+    std::pair<iterator, bool> insertKey(K&& key) {
+        auto it = lower_bound(key);
+        if (it != keys_.end() && !compare_(key, *it)) {
+            return {it, false};
+        }
+        return {keys_.insert(it, std::forward<K>(key)), true};
+    }
+
+    void normalize() {
+        if (!detail::flatSortedUnique(keys_, compare_)) {
+            std::stable_sort(keys_.begin(), keys_.end(), compare_);
+            dedupe();
+        }
+    }
+
+    void dedupe() {
+        auto last = std::unique(keys_.begin(), keys_.end(), [&](const Key& a, const Key& b) {
+            return !compare_(a, b);
+        });
+        keys_.erase(last, keys_.end());
+    }
+
+    std::vector<Key> keys_;
+    [[no_unique_address]] Compare compare_;
+};
+
+/**
+ * @brief Sorted map with separate contiguous key and value arrays
+ *
+ * Iterators model std::random_access_iterator and dereference to a proxy
+ * pair of references (detail::FlatMapReference, a std::pair<const Key&, T&>),
+ * so `for (const auto& [key, value] : map)` works as with std::map, but
+ * `auto& [key, value]` does not. Like other proxy iterators (std::views::zip)
+ * they only claim std::input_iterator_tag to pre-C++20 algorithms: use
+ * std::ranges::prev and friends rather than std::prev.
+ *
+ * Example usage:
+ * core::FlatMap<std::string, int> ages{{"Bob", 25}, {"Alice", 30}};
+ * ages["Carol"] = 41;
+ * if (auto it = ages.find(std::string_view("Alice")); it != ages.end()) { ... }
+ * const std::vector<int>& all = ages.values();   // scan values only
+ */
+template<typename Key, typename T, typename Compare = std::less<>>
+class FlatMap {
+    static_assert(!std::is_same_v<T, bool>,
+                  "FlatMap<K, bool>: std::vector<bool> has no data(); use FlatSet<K> or char");
+    template<bool Const>
+    class Iterator;
+
+public:
+    using key_type = Key;
+    using mapped_type = T;
+    using value_type = std::pair<Key, T>;
+    using key_compare = Compare;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = detail::FlatMapReference<Key, T>;
+    using const_reference = detail::FlatMapReference<Key, const T>;
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    FlatMap() = default;
+    explicit FlatMap(const Compare& compare) : compare_(compare) {}
+
+    /**
+     * @brief Bulk construction from parallel arrays
+     *
+     * Sorts a permutation once (stable, so the first of equal keys wins),
+     * drops duplicates and moves each element into place.
+     * @throws std::invalid_argument if the arrays differ in length
+     */
+    FlatMap(std::vector<Key> keys, std::vector<T> values, const Compare& compare = Compare())
+        : keys_(std::move(keys)), values_(std::move(values)), compare_(compare) {
+        if (keys_.size() != values_.size()) {
+            throw std::invalid_argument("FlatMap: key and value counts differ");
+        }
+        normalize();
+    }
+
+    /// Adopts arrays whose keys are already sorted and unique.
+    FlatMap(sorted_unique_t, std::vector<Key> keys, std::vector<T> values,
+            const Compare& compare = Compare())
+        : keys_(std::move(keys)), values_(std::move(values)), compare_(compare) {
+        if (keys_.size() != values_.size()) {
+            throw std::invalid_argument("FlatMap: key and value counts differ");
+        }
+    }
+
+    template<std::input_iterator It>
+    FlatMap(It first, It last, const Compare& compare = Compare()) : compare_(compare) {
+        for (; first != last; ++first) {
+            keys_.push_back((*first).first);
+            values_.push_back((*first).second);
+        }
+        normalize();
+    }
+
+    FlatMap(std::initializer_list<value_type> init, const Compare& compare = Compare())
+        : FlatMap(init.begin(), init.end(), compare) {}
+
+    iterator begin() noexcept { return iterator(keys_.data(), values_.data()); }
+    iterator end() noexcept { return begin() + static_cast<difference_type>(size()); }
+    const_iterator begin() const noexcept { return const_iterator(keys_.data(), values_.data()); }
+    const_iterator end() const noexcept { return begin() + static_cast<difference_type>(size()); }
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+    reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+    reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+    const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+    const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+
+    bool empty() const noexcept { return keys_.empty(); }
+    size_type size() const noexcept { return keys_.size(); }
+
+    void reserve(size_type count) {
+        keys_.reserve(count);
+        values_.reserve(count);
+    }
+
+    void shrink_to_fit() {
+        keys_.shrink_to_fit();
+        values_.shrink_to_fit();
+    }
+
+    void clear() noexcept {
+        keys_.clear();
+        values_.clear();
+    }
+
+    /// The sorted key array.
+    const std::vector<Key>& keys() const noexcept { return keys_; }
+    /// Values in key order, parallel to keys().
+    const std::vector<T>& values() const noexcept { return values_; }
+
+    key_compare key_comp() const { return compare_; }
+
+    template<typename K>
+        requires detail::kFlatLookup<Compare, Key, K>
+    T& at(const K& key) {
+        return values_[checkedIndex(key)];
+    }
+    T& at(const Key& key) { return at<Key>(key); }
+
+    template<typename K>
+        requires detail::kFlatLookup<Compare, Key, K>
+    const T& at(const K& key) const {
+        return values_[checkedIndex(key)];
+    }
+    const T& at(const Key& key) const { return at<Key>(key); }
+
+    T& operator[](const Key& key) { return try_emplace(key).first->second; }
+    T& operator[](Key&& key) { return try_emplace(std::move(key)).first->second; }
+
+    template<typename... Args>
+    std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args) {
+        return emplaceKey(key, std::forward<Args>(args)...);
+    }
+
+    template<typename... Args>
+    std::pair<iterator, bool> try_emplace(Key&& key, Args&&... args) {
+        return emplaceKey(std::move(key), std::forward<Args>(args)...);
+    }
+
+    template<typename M>
+    std::pair<iterator, bool> insert_or_assign(const Key& key, M&& value) {
+        auto result = emplaceKey(key, std::forward<M>(value));
+        if (!result.second) {
+            result.first->second = std::forward<M>(value);
+        }
+        return result;
+    }
+
+    std::pair<iterator, bool> insert(const value_type& value) {
+        return emplaceKey(value.first, value.second);
+    }
+
+    std::pair<iterator, bool> insert(value_type&& value) {
+        return emplaceKey(std::move(value.first), std::move(value.second));
+    }
+
+    template<typename... Args>
+    std::pair<iterator, bool> emplace(Args&&... args) {
+        return insert(value_type(std::forward<Args>(args)...));
+    }
+
+    /// Appends the range and re-sorts once; keys already present win.
+    template<std::input_iterator It>
+    void insert(It first, It last) {
+        for (; first != last; ++first) {
+            keys_.push_back((*first).first);
+            values_.push_back((*first).second);
+        }
+        normalize();
+    }
+
+    void insert(std::initializer_list<value_type> init) { insert(init.begin(), init.end()); }
+
+    iterator erase(const_iterator position) { return erase(position, position + 1); }
+
+    iterator erase(const_iterator first, const_iterator last) {
+        const auto from = first - cbegin();
+        const auto to = last - cbegin();
+        keys_.erase(keys_.begin() + from, keys_.begin() + to);
+        values_.erase(values_.begin() + from, values_.begin() + to);
+        return begin() + from;
+    }
+
+    template<typename K>
+        requires(detail::kFlatLookup<Compare, Key, K> && !std::is_convertible_v<K, const_iterator>)
+    size_type erase(const K& key) {
+        auto it = find(key);
+        if (it == end()) {
+            return 0;
+        }
+        erase(const_iterator(it));
+        return 1;
+    }
+    size_type erase(const Key& key) { return erase<Key>(key); }
+
+    template<typename K>
+        requires detail::kFlatLookup<Compare, Key, K>
+    iterator lower_bound(const K& key) {
+        return begin() + lowerIndex(key);
+    }
+    iterator lower_bound(const Key& key) { return lower_bound<Key>(key); }
+
+    template<typename K>
+        requires detail::kFlatLookup<Compare, Key, K>
+    const_iterator lower_bound(const K& key) const {
+        return begin() + lowerIndex(key);
+    }
+    const_iterator lower_bound(const Key& key) const { return lower_bound<Key>(key); }
+
+    template<typename K>
+        requires detail::kFlatLookup<Compare, Key, K>
+    iterator upper_bound(const K& key) {
+        return begin() + upperIndex(key);
+    }
+    iterator upper_bound(const Key& key) { return upper_bound<Key>(key); }
+
+    template<typename K>
+        requires detail::kFlatLookup<Compare, Key, K>
+    const_iterator upper_bound(const K& key) const {
+        return begin() + upperIndex(key);
+    }
+    const_iterator upper_bound(const Key& key) const { return upper_bound<Key>(key); }
+
+    template<typename K>
+        requires detail::kFlatLookup<Compare, Key, K>
+    iterator find(const K& key) {
+        return begin() + findIndex(key);
+    }
+    iterator find(const Key& key) { return find<Key>(key); }
+
+    template<typename K>
+        requires detail::kFlatLookup<Compare, Key, K>
+    const_iterator find(const K& key) const {
+        return begin() + findIndex(key);
+    }
+    const_iterator find(const Key& key) const { return find<Key>(key); }
+
+    template<typename K>
+        requires detail::kFlatLookup<Compare, Key, K>
+    bool contains(const K& key) const {
+        return findIndex(key) != static_cast<difference_type>(size());
+    }
+    bool contains(const Key& key) const { return contains<Key>(key); }
+
+    template<typename K>
+        requires detail::kFlatLookup<Compare, Key, K>
+    size_type count(const K& key) const {
+        return contains(key) ? 1 : 0;
+    }
+    size_type count(const Key& key) const { return count<Key>(key); }
+
+    friend bool operator==(const FlatMap& a, const FlatMap& b) {
+        return a.keys_ == b.keys_ && a.values_ == b.values_;
+    }
+
+    void swap(FlatMap& other) noexcept {
+        using std::swap;
+        swap(keys_, other.keys_);
+        swap(values_, other.values_);
+        swap(compare_, other.compare_);
+    }
+    friend void swap(FlatMap& a, FlatMap& b) noexcept { a.swap(b); }
+
+private:
+    template<typename K>
+    difference_type lowerIndex(const K& key) const {
+        return std::lower_bound(keys_.begin(), keys_.end(), key, compare_) - keys_.begin();
+    }
+
+    template<typename K>
+    difference_type upperIndex(const K& key) const {
+        return std::upper_bound(keys_.begin(), keys_.end(), key, compare_) - keys_.begin();
+    }
+
+    /// Index of @p key, or size() when absent.
+    template<typename K>
+    difference_type findIndex(const K& key) const {
+        const difference_type index = lowerIndex(key);
+        const auto count = static_cast<difference_type>(size());
+        if (index != count && !compare_(key, keys_[static_cast<size_type>(index)])) {
+            return index;
+        }
+        return count;
+    }
+
+    template<typename K>
+    size_type checkedIndex(const K& key) const {
+        const difference_type index = findIndex(key);
+        if (index == static_cast<difference_type>(size())) {
+            throw std::out_of_range("FlatMap::at: key not found");
+        }
+        return static_cast<size_type>(index);
+    }
+
+    template<typename K, typename... Args>
+    std::pair<iterator, bool> emplaceKey(K&& key, Args&&... args) {
+        const difference_type index = lowerIndex(key);
+        if (index != static_cast<difference_type>(size()) &&
+            !compare_(key, keys_[static_cast<size_type>(index)])) {
+            return {begin() + index, false};
+        }
+        keys_.insert(keys_.begin() + index, std::forward<K>(key));
+        try {
+            values_.emplace(values_.begin() + index, std::forward<Args>(args)...);
+        } catch (...) {
+            keys_.erase(keys_.begin() + index);  // keep the arrays parallel
+            throw;
+        }
+        return {begin() + index, true};
+    }
+
+    void normalize() {
+        if (detail::flatSortedUnique(keys_, compare_)) {
+            return;
+        }
+        // Sort (key, original index) pairs: keys stay contiguous for the sort,
+        // the index breaks ties so the first of equal keys wins, and each
+        // value moves only once afterwards
+        std::vector<std::pair<Key, size_type>> order;
+        order.reserve(keys_.size());
+        for (size_type i = 0; i < keys_.size(); ++i) {
+            order.emplace_back(std::move(keys_[i]), i);
+        }
+        std::sort(order.begin(), order.end(), [&](const auto& a, const auto& b) {
+            if (compare_(a.first, b.first)) {
+                return true;
+            }
+            return !compare_(b.first, a.first) && a.second < b.second;
+        });
+
+        std::vector<Key> sortedKeys;
+        std::vector<T> sortedValues;
+        sortedKeys.reserve(order.size());
+        sortedValues.reserve(order.size());
+        for (auto& [key, index] : order) {
+            if (!sortedKeys.empty() && !compare_(sortedKeys.back(), key)) {
+                continue;  // duplicate of the previous key; the earlier one wins
+            }
+            sortedKeys.push_back(std::move(key));
+            sortedValues.push_back(std::move(values_[index]));
+        }
+        keys_ = std::move(sortedKeys);
+        values_ = std::move(sortedValues);
+    }
+
+    std::vector<Key> keys_;
+    std::vector<T> values_;
+    [[no_unique_address]] Compare compare_;
+};
+
+/// Random-access iterator over the parallel arrays of a FlatMap.
+template<typename Key, typename T, typename Compare>
+template<bool Const>
+class FlatMap<Key, T, Compare>::Iterator {
+    using Mapped = std::conditional_t<Const, const T, T>;
+
+public:
+    // Dereferencing yields a prvalue proxy, which a Cpp17ForwardIterator may not
+    using iterator_concept = std::random_access_iterator_tag;
+    using iterator_category = std::input_iterator_tag;
+    using value_type = std::pair<Key, T>;
+    using difference_type = std::ptrdiff_t;
+    using reference = detail::FlatMapReference<Key, Mapped>;
+
+    /// Makes `it->first` and `it->second` work on the proxy reference.
+    struct pointer {
+        reference ref;
+        const reference* operator->() const noexcept { return &ref; }
+    };
+
+    Iterator() noexcept = default;
+
+    template<bool OtherConst>
+        requires(Const && !OtherConst)
+    Iterator(const Iterator<OtherConst>& other) noexcept
+        : key_(other.key_), value_(other.value_) {}
+
+    reference operator*() const noexcept { return reference(*key_, *value_); }
+    pointer operator->() const noexcept { return pointer{**this}; }
+    reference operator[](difference_type n) const noexcept {
+        return reference(key_[n], value_[n]);
+    }
+
+    Iterator& operator++() noexcept {
+        ++key_;
+        ++value_;
+        return *this;
+    }
+    Iterator operator++(int) noexcept {
+        Iterator old = *this;
+        ++*this;
+        return old;
+    }
+    Iterator& operator--() noexcept {
+        --key_;
+        --value_;
+        return *this;
+    }
+    Iterator operator--(int) noexcept {
+        Iterator old = *this;
+        --*this;
+        return old;
+    }
+    Iterator& operator+=(difference_type n) noexcept {
+        key_ += n;
+        value_ += n;
+        return *this;
+    }
+    Iterator& operator-=(difference_type n) noexcept { return *this += -n; }
+
+    friend Iterator operator+(Iterator it, difference_type n) noexcept { return it += n; }
+    friend Iterator operator+(difference_type n, Iterator it) noexcept { return it += n; }
+    friend Iterator operator-(Iterator it, difference_type n) noexcept { return it -= n; }
+    friend difference_type operator-(const Iterator& a, const Iterator& b) noexcept {
+        return a.key_ - b.key_;
+    }
+
+    friend bool operator==(const Iterator& a, const Iterator& b) noexcept {
+        return a.key_ == b.key_;
+    }
+    friend auto operator<=>(const Iterator& a, const Iterator& b) noexcept {
+        return std::compare_three_way{}(a.key_, b.key_);
+    }
+
+private:
+    friend class FlatMap;
+    friend class Iterator<!Const>;
+
+    Iterator(const Key* key, Mapped* value) noexcept : key_(key), value_(value) {}
+
+    const Key* key_ = nullptr;
+    Mapped* value_ = nullptr;
+};
+
+}  // namespace core
+
+// The common reference of a FlatMap proxy and its value_type, for std::indirectly_readable.
+template<typename Key, typename Mapped, typename T, template<typename> class RQual,
+         template<typename> class PQual>
+    requires std::is_same_v<std::remove_const_t<Mapped>, T>
+struct std::basic_common_reference<core::detail::FlatMapReference<Key, Mapped>,
+                                   std::pair<Key, T>, RQual, PQual> {
+    using type = core::detail::FlatMapReference<Key, const T>;
+};
+
+template<typename Key, typename Mapped, typename T, template<typename> class PQual,
+         template<typename> class RQual>
+    requires std::is_same_v<std::remove_const_t<Mapped>, T>
+struct std::basic_common_reference<std::pair<Key, T>,
+                                   core::detail::FlatMapReference<Key, Mapped>, PQual, RQual> {
+    using type = core::detail::FlatMapReference<Key, const T>;
+};
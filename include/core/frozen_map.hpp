@@ -0,0 +1,325 @@
+/**
+ * @file frozen_map.hpp
+ * @brief Immutable maps and sets built at compile time with a perfect hash
+ *
+ * core::FrozenMap<K, V, N> and core::FrozenSet<K, N> are for the fixed
+ * tables every program has: keyword → token, name → enum, enum → label.
+ * They are usually written as a switch or filled into an unordered_map at
+ * startup. Here they are built in a constexpr context, so the table is
+ * part of the binary and costs nothing at startup. A lookup never probes
+ * a chain or a cluster.
+ *
+ * The table uses a two-level perfect hash (hash-and-displace):
+ * - A first hash, with a seed chosen at build time, spreads the keys over
+ *   power-of-two buckets.
+ * - For each bucket, the builder picks a displacement: a second seed that
+ *   sends every key of the bucket to a free slot, largest buckets first.
+ *   Buckets holding a single key store their slot directly.
+ * - A lookup is one hash, one displacement load, a second hash, and one
+ *   key compare that rejects keys not in the table. For integer and enum
+ *   keys each hash is two multiplies and two shifts.
+ *
+ * Keys need a core::FrozenHash specialization. Integers, enums and
+ * std::string_view are provided. Build from string literals as
+ * string_view; std::string cannot live in a constexpr table, but it
+ * converts to string_view for lookups. Duplicate keys are rejected with
+ * std::invalid_argument, which is a compile error when the table is
+ * constexpr.
+ *
+ * @author Modern C++ Starter Template
+ * @date 2025
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace core {
+
+/// Seeded constexpr hash used by FrozenMap/FrozenSet; specialize for new key types.
+template<typename K, typename Enable = void>
+struct FrozenHash;
+
+namespace detail {
+
+constexpr std::uint64_t frozenMix(std::uint64_t x) noexcept {
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 31;
+    x *= 0x94d049bb133111ebULL;
+    return x ^ (x >> 29);
+}
+
+}  // namespace detail
+
+template<typename K>
+struct FrozenHash<K, std::enable_if_t<std::is_integral_v<K> || std::is_enum_v<K>>> {
+    constexpr std::uint64_t operator()(K key, std::uint64_t seed) const noexcept {
+        return detail::frozenMix(static_cast<std::uint64_t>(key) ^ seed);
+    }
+};
+
+template<>
+struct FrozenHash<std::string_view> {
+    constexpr std::uint64_t operator()(std::string_view key, std::uint64_t seed) const noexcept {
+        // FNV-1a over the bytes, then a finalizer so every bit reaches the mask
+        std::uint64_t h = 0xcbf29ce484222325ULL ^ seed;
+        for (char c : key) {
+            h = (h ^ static_cast<unsigned char>(c)) * 0x100000001b3ULL;
+        }
+        return detail::frozenMix(h);
+    }
+};
+
+namespace detail {
+
+/**
+ * @brief Slot assignment shared by FrozenMap and FrozenSet
+ *
+ * Maps each of N keys to a distinct slot in [0, kSlots), and records
+ * which key owns each slot.
+ */
+template<typename K, std::size_t N, typename Hash>
+class PerfectHash {
+public:
+    static constexpr std::size_t kSlots = std::bit_ceil(N);
+    static constexpr std::uint32_t kEmpty = static_cast<std::uint32_t>(N);
+
+    template<typename KeyAt>
+    constexpr explicit PerfectHash(KeyAt keyAt) {
+        for (std::uint64_t attempt = 0; attempt < kMaxSeeds; ++attempt) {
+            seed_ = frozenMix(attempt + 1);
+            if (tryBuild(keyAt)) {
+                return;
+            }
+        }
+        throw std::logic_error("FrozenMap: no perfect hash found");
+    }
+
+    /// Index of the only key that can equal @p key; the caller compares.
+    constexpr std::uint32_t candidate(const K& key) const noexcept {
+        const Hash hash{};
+        const std::int64_t displacement =
+            displacements_[static_cast<std::size_t>(hash(key, seed_) & kMask)];
+        const std::size_t slot =
+            displacement < 0 ? static_cast<std::size_t>(-displacement - 1)
+                             : static_cast<std::size_t>(
+                                   hash(key, static_cast<std::uint64_t>(displacement)) & kMask);
+        return slotIndex_[slot];
+    }
+
+private:
+    static constexpr std::uint64_t kMask = kSlots - 1;
+    static constexpr std::uint64_t kMaxSeeds = 64;
+    static constexpr std::int64_t kMaxDisplacement = 1 << 16;
+
+    template<typename KeyAt>
+    constexpr bool tryBuild(KeyAt keyAt) {
+        const Hash hash{};
+        // Counting sort of key indices by first-level bucket
+        std::array<std::uint32_t, kSlots + 1> offsets{};
+        std::array<std::uint32_t, N> bucketOf{};
+        for (std::size_t i = 0; i < N; ++i) {
+            bucketOf[i] = static_cast<std::uint32_t>(hash(keyAt(i), seed_) & kMask);
+            ++offsets[bucketOf[i] + 1];
+        }
+        for (std::size_t b = 0; b < kSlots; ++b) {
+            offsets[b + 1] += offsets[b];
+        }
+        std::array<std::uint32_t, N> members{};
+        std::array<std::uint32_t, kSlots> fill{};
+        for (std::size_t i = 0; i < N; ++i) {
+            members[offsets[bucketOf[i]] + fill[bucketOf[i]]++] = static_cast<std::uint32_t>(i);
+        }
+
+        std::array<std::uint32_t, kSlots> order{};
+        for (std::size_t b = 0; b < kSlots; ++b) {
+            order[b] = static_cast<std::uint32_t>(b);
+        }
+        std::sort(order.begin(), order.end(), [&](std::uint32_t x, std::uint32_t y) {
+            return offsets[x + 1] - offsets[x] > offsets[y + 1] - offsets[y];
+        });
+
+        std::array<bool, kSlots> used{};
+        displacements_.fill(0);
+        slotIndex_.fill(kEmpty);
+        std::size_t nextFree = 0;
+        for (std::uint32_t b : order) {
+            const std::uint32_t begin = offsets[b];
+            const std::uint32_t count = offsets[b + 1] - begin;
+            if (count == 0) {
+                break;
+            }
+            if (count == 1) {
+                while (used[nextFree]) {
+                    ++nextFree;
+                }
+                used[nextFree] = true;
+                slotIndex_[nextFree] = members[begin];
+                displacements_[b] = -static_cast<std::int64_t>(nextFree) - 1;
+                continue;
+            }
+            // Keys sharing a bucket share a first-level hash; equal keys
+            // would never separate, so catch them here
+            for (std::uint32_t i = begin; i < begin + count; ++i) {
+                for (std::uint32_t j = i + 1; j < begin + count; ++j) {
+                    if (keyAt(members[i]) == keyAt(members[j])) {
+                        throw std::invalid_argument("FrozenMap: duplicate key");
+                    }
+                }
+            }
+            std::array<std::size_t, N> slots{};
+            bool placed = false;
+            for (std::int64_t d = 1; d < kMaxDisplacement && !placed; ++d) {
+                placed = true;
+                for (std::uint32_t i = 0; i < count && placed; ++i) {
+                    slots[i] = static_cast<std::size_t>(
+                        hash(keyAt(members[begin + i]), static_cast<std::uint64_t>(d)) & kMask);
+                    placed = !used[slots[i]] &&
+                             std::find(slots.begin(), slots.begin() + i, slots[i]) ==
+                                 slots.begin() + i;
+                }
+                if (placed) {
+                    for (std::uint32_t i = 0; i < count; ++i) {
+                        used[slots[i]] = true;
+                        slotIndex_[slots[i]] = members[begin + i];
+                    }
+                    displacements_[b] = d;
+                }
+            }
+            if (!placed) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    std::uint64_t seed_ = 0;
+    std::array<std::int64_t, kSlots> displacements_{};
+    std::array<std::uint32_t, kSlots> slotIndex_{};
+};
+
+}  // namespace detail
+
+/**
+ * @brief Immutable key → value table with a compile-time perfect hash
+ *
+ * Example usage:
+ * constexpr auto kTokens = core::makeFrozenMap<std::string_view, Token>({
+ *     {"if", Token::If}, {"else", Token::Else}, {"while", Token::While}});
+ * static_assert(kTokens.at("else") == Token::Else);   // resolved at compile time
+ * if (auto it = kTokens.find(word); it != kTokens.end()) { ... }
+ */
+template<typename K, typename V, std::size_t N, typename Hash = FrozenHash<K>>
+class FrozenMap {
+    static_assert(N > 0, "FrozenMap needs at least one entry");
+
+public:
+    using key_type = K;
+    using mapped_type = V;
+    using value_type = std::pair<K, V>;
+    using size_type = std::size_t;
+    using const_iterator = const value_type*;
+    using iterator = const_iterator;
+
+    /// @throws std::invalid_argument on duplicate keys
+    constexpr explicit FrozenMap(const std::array<value_type, N>& entries)
+        : entries_(entries), hash_([this](std::size_t i) { return entries_[i].first; }) {}
+
+    constexpr const_iterator find(const K& key) const noexcept {
+        const std::uint32_t index = hash_.candidate(key);
+        if (index != N && entries_[index].first == key) {
+            return entries_.data() + index;
+        }
+        return end();
+    }
+
+    constexpr bool contains(const K& key) const noexcept { return find(key) != end(); }
+    constexpr size_type count(const K& key) const noexcept { return contains(key) ? 1 : 0; }
+
+    /// @throws std::out_of_range if @p key is not in the table
+    constexpr const V& at(const K& key) const {
+        const auto it = find(key);
+        if (it == end()) {
+            throw std::out_of_range("FrozenMap::at key not found");
+        }
+        return it->second;
+    }
+
+    /// Entries in the order they were given.
+    constexpr const_iterator begin() const noexcept { return entries_.data(); }
+    constexpr const_iterator end() const noexcept { return entries_.data() + N; }
+
+    static constexpr size_type size() noexcept { return N; }
+    static constexpr bool empty() noexcept { return false; }
+
+private:
+    std::array<value_type, N> entries_;
+    detail::PerfectHash<K, N, Hash> hash_;
+};
+
+/**
+ * @brief Immutable set with a compile-time perfect hash
+ *
+ * Example usage:
+ * constexpr auto kReserved = core::makeFrozenSet<std::string_view>({"class", "enum", "struct"});
+ * static_assert(kReserved.contains("enum"));
+ */
+template<typename K, std::size_t N, typename Hash = FrozenHash<K>>
+class FrozenSet {
+    static_assert(N > 0, "FrozenSet needs at least one key");
+
+public:
+    using key_type = K;
+    using value_type = K;
+    using size_type = std::size_t;
+    using const_iterator = const K*;
+    using iterator = const_iterator;
+
+    /// @throws std::invalid_argument on duplicate keys
+    constexpr explicit FrozenSet(const std::array<K, N>& keys)
+        : keys_(keys), hash_([this](std::size_t i) { return keys_[i]; }) {}
+
+    constexpr const_iterator find(const K& key) const noexcept {
+        const std::uint32_t index = hash_.candidate(key);
+        if (index != N && keys_[index] == key) {
+            return keys_.data() + index;
+        }
+        return end();
+    }
+
+    constexpr bool contains(const K& key) const noexcept { return find(key) != end(); }
+    constexpr size_type count(const K& key) const noexcept { return contains(key) ? 1 : 0; }
+
+    constexpr const_iterator begin() const noexcept { return keys_.data(); }
+    constexpr const_iterator end() const noexcept { return keys_.data() + N; }
+
+    static constexpr size_type size() noexcept { return N; }
+    static constexpr bool empty() noexcept { return false; }
+
+private:
+    std::array<K, N> keys_;
+    detail::PerfectHash<K, N, Hash> hash_;
+};
+
+/// Builds a FrozenMap from a braced list of {key, value} pairs; N is deduced.
+template<typename K, typename V, typename Hash = FrozenHash<K>, std::size_t N>
+constexpr FrozenMap<K, V, N, Hash> makeFrozenMap(const std::pair<K, V> (&entries)[N]) {
+    return FrozenMap<K, V, N, Hash>(std::to_array(entries));
+}
+
+/// Builds a FrozenSet from a braced list of keys; N is deduced.
+template<typename K, typename Hash = FrozenHash<K>, std::size_t N>
+constexpr FrozenSet<K, N, Hash> makeFrozenSet(const K (&keys)[N]) {
+    return FrozenSet<K, N, Hash>(std::to_array(keys));
+}
+
+}  // namespace core
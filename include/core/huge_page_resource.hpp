@@ -0,0 +1,110 @@
+/**
+ * @file huge_page_resource.hpp
+ * @brief Polymorphic memory resource backed by 2 MiB pages
+ *
+ * core::HugePageResource maps every request straight from the kernel,
+ * rounded up to a 2 MiB multiple and 2 MiB aligned. It tries, in order:
+ *   1. mmap(MAP_HUGETLB): reserved huge pages (needs vm.nr_hugepages > 0)
+ *   2. mmap + madvise(MADV_HUGEPAGE): transparent huge pages
+ *   3. plain pages, when THP is disabled as well
+ * Each allocation is counted under the backing it actually got, so callers
+ * can report whether the huge-page path was taken. Only Linux has the first
+ * two steps; elsewhere every request is a plain aligned operator new.
+ *
+ * Each request costs at least 2 MiB, so give this resource a few large
+ * buffers or put a std::pmr::monotonic_buffer_resource on top of it.
+ *
+ * @author Modern C++ Starter Template
+ * @date 2025
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <memory_resource>
+#include <string>
+
+namespace core {
+
+/**
+ * @brief std::pmr::memory_resource handing out 2 MiB-aligned huge-page mappings
+ *
+ * Example usage:
+ * core::HugePageResource hugePages;
+ * std::pmr::vector<std::uint64_t> table(&hugePages);
+ * table.resize(64 << 20);
+ * hugePages.stats().hugetlb + hugePages.stats().transparent;  // huge-page backed
+ */
+class HugePageResource : public std::pmr::memory_resource {
+public:
+    static constexpr std::size_t kHugePageSize = std::size_t{2} << 20;
+
+    enum class Policy {
+        Auto,            ///< MAP_HUGETLB, then transparent huge pages, then plain pages
+        TransparentOnly  ///< skip MAP_HUGETLB (no reserved pool needed)
+    };
+
+    /// Allocation counts per backing, plus currently mapped bytes.
+    struct Stats {
+        std::uint64_t hugetlb = 0;
+        std::uint64_t transparent = 0;  ///< THP requested; the kernel decides at fault time
+        std::uint64_t regular = 0;  ///< huge pages unavailable; plain pages used
+        std::uint64_t bytesMapped = 0;
+    };
+
+    /// Kernel huge-page configuration, read from /proc and /sys.
+    struct SystemInfo {
+        std::string transparentMode;  ///< "always", "madvise", "never" or "unsupported"
+        std::uint64_t reservedFree = 0;  ///< free MAP_HUGETLB pages (HugePages_Free)
+        std::uint64_t reservedPageBytes = 0;  ///< Hugepagesize
+    };
+
+    /// Reads the transparent huge page mode once, so allocations do no file I/O.
+    explicit HugePageResource(Policy policy = Policy::Auto);
+
+    HugePageResource(const HugePageResource&) = delete;
+    HugePageResource& operator=(const HugePageResource&) = delete;
+
+    Policy policy() const noexcept { return policy_; }
+    Stats stats() const noexcept;
+
+    /**
+     * @brief Bytes of the mapping containing @p pointer that sit on huge pages
+     *
+     * Reads /proc/self/smaps (AnonHugePages + Private_Hugetlb), so it reflects
+     * what the kernel actually faulted in, not what was requested. Returns 0
+     * off Linux or when the mapping is not found.
+     */
+    static std::size_t hugeBytesAt(const void* pointer);
+
+    static SystemInfo systemInfo();
+
+    /// Writes the system state and this resource's counters, one item per line.
+    void writeReport(std::ostream& out) const;
+
+    static constexpr std::size_t roundUp(std::size_t bytes) noexcept {
+        return (bytes + kHugePageSize - 1) & ~(kHugePageSize - 1);
+    }
+
+protected:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+    void do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+private:
+    enum class Backing { Hugetlb, Transparent, Regular };
+
+    void count(Backing backing, std::size_t bytes) noexcept;
+
+    Policy policy_;
+    bool transparentEnabled_;  ///< THP mode is not "never"
+    std::atomic<std::uint64_t> hugetlb_{0};
+    std::atomic<std::uint64_t> transparent_{0};
+    std::atomic<std::uint64_t> regular_{0};
+    std::atomic<std::uint64_t> bytesMapped_{0};
+};
+
+}  // namespace core
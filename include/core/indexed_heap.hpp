@@ -0,0 +1,256 @@
+/**
+ * @file indexed_heap.hpp
+ * @brief D-ary heap with a position index, for update and erase by handle
+ *
+ * core::IndexedHeap<Key, Priority, D> is a priority queue whose entries can
+ * be reprioritized or removed after insertion. push() returns a Handle, a
+ * small integer that stays valid until that entry is popped or erased. A
+ * slot table maps every handle to the entry's current heap position, so
+ * update() and erase() locate the entry in O(1) and restore the heap in
+ * O(log n). std::priority_queue has neither, which forces schedulers to
+ * push duplicates and skip stale entries on pop.
+ *
+ * The heap array holds only (priority, handle) pairs. Keys stay in the
+ * slot table and never move while the heap reorders. Each node has D
+ * children (4 by default). That halves the tree height of a binary heap,
+ * and the D children of a node sit next to each other in memory, so a
+ * sift-down compares them within one or two cache lines.
+ *
+ * Ordering follows std::priority_queue: with the default std::less the
+ * entry with the largest priority is on top. Use std::greater<> for a
+ * min-heap (deadlines, distances).
+ *
+ * @author Modern C++ Starter Template
+ * @date 2025
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace core {
+
+/**
+ * @brief D-ary priority queue with O(log n) update and erase by handle
+ *
+ * Example usage:
+ * core::IndexedHeap<TaskId, Deadline, 4, std::greater<>> ready;  // earliest first
+ * auto handle = ready.push(task, deadline);
+ * ready.update(handle, sooner);          // decrease-key: no duplicate entries
+ * ready.erase(other);                    // cancelled task
+ * auto [next, when] = ready.pop();
+ */
+template<typename Key, typename Priority, std::size_t D = 4,
+         typename Compare = std::less<Priority>>
+class IndexedHeap {
+    static_assert(D >= 2, "IndexedHeap needs at least two children per node");
+    static_assert(std::is_nothrow_move_constructible_v<Priority> &&
+                      std::is_nothrow_move_assignable_v<Priority>,
+                  "IndexedHeap priorities must be nothrow movable");
+
+public:
+    using key_type = Key;
+    using priority_type = Priority;
+    using size_type = std::size_t;
+    using Handle = std::uint32_t;
+
+    IndexedHeap() = default;
+    explicit IndexedHeap(const Compare& compare) : compare_(compare) {}
+
+    bool empty() const noexcept { return heap_.empty(); }
+    size_type size() const noexcept { return heap_.size(); }
+
+    void reserve(size_type count) {
+        heap_.reserve(count);
+        keys_.reserve(count);
+        positions_.reserve(count);
+    }
+
+    /// Removes every entry; all handles become invalid.
+    void clear() noexcept {
+        heap_.clear();
+        keys_.clear();
+        positions_.clear();
+        free_ = kNone;
+    }
+
+    /// Adds an entry and returns its handle. Handles of erased entries are reused.
+    Handle push(Key key, Priority priority) {
+        if (free_ == kNone && keys_.size() >= kNone) {
+            throw std::length_error("IndexedHeap: too many entries");
+        }
+        // Grow the heap first so nothing can throw once the slot is taken
+        if (heap_.size() == heap_.capacity()) {
+            heap_.reserve(std::max<size_type>(16, 2 * heap_.capacity()));
+        }
+        Handle handle;
+        if (free_ != kNone) {
+            handle = free_;
+            keys_[handle].emplace(std::move(key));
+            free_ = positions_[handle];
+        } else {
+            positions_.push_back(0);
+            try {
+                keys_.emplace_back(std::move(key));
+            } catch (...) {
+                positions_.pop_back();
+                throw;
+            }
+            handle = static_cast<Handle>(keys_.size() - 1);
+        }
+        heap_.push_back(Node{std::move(priority), handle});
+        siftUp(heap_.size() - 1);
+        return handle;
+    }
+
+    /// Top entry (largest under Compare); the heap must not be empty.
+    Handle topHandle() const noexcept { return heap_.front().handle; }
+    const Key& topKey() const noexcept { return *keys_[heap_.front().handle]; }
+    const Priority& topPriority() const noexcept { return heap_.front().priority; }
+
+    /// Removes the top entry and returns its key and priority.
+    std::pair<Key, Priority> pop() {
+        Node& top = heap_.front();
+        std::pair<Key, Priority> result{std::move(*keys_[top.handle]),
+                                        std::move(top.priority)};
+        removeAt(0);
+        return result;
+    }
+
+    /// True if @p handle refers to an entry that is still in the heap.
+    bool contains(Handle handle) const noexcept {
+        return handle < keys_.size() && keys_[handle].has_value();
+    }
+
+    const Key& key(Handle handle) const { return *keys_[checked(handle)]; }
+    const Priority& priority(Handle handle) const {
+        return heap_[positions_[checked(handle)]].priority;
+    }
+
+    /// Sets a new priority and moves the entry up or down as needed.
+    void update(Handle handle, Priority priority) {
+        const std::size_t position = positions_[checked(handle)];
+        const bool raised = compare_(heap_[position].priority, priority);
+        heap_[position].priority = std::move(priority);
+        if (raised) {
+            siftUp(position);
+        } else {
+            siftDown(position);
+        }
+    }
+
+    /// Removes the entry; @p handle becomes invalid.
+    void erase(Handle handle) { removeAt(positions_[checked(handle)]); }
+
+private:
+    static constexpr Handle kNone = std::numeric_limits<Handle>::max();
+
+    struct Node {
+        Priority priority;
+        Handle handle;
+    };
+
+    Handle checked(Handle handle) const {
+        if (!contains(handle)) {
+            throw std::out_of_range("IndexedHeap: invalid handle");
+        }
+        return handle;
+    }
+
+    void place(std::size_t position, Node&& node) noexcept {
+        positions_[node.handle] = static_cast<std::uint32_t>(position);
+        heap_[position] = std::move(node);
+    }
+
+    // Both sifts carry the moving node in a local and shift the others into
+    // the hole, writing each node once instead of swapping pairs.
+    void siftUp(std::size_t position) noexcept {
+        Node node = std::move(heap_[position]);
+        while (position > 0) {
+            const std::size_t parent = (position - 1) / D;
+            if (!compare_(heap_[parent].priority, node.priority)) {
+                break;
+            }
+            place(position, std::move(heap_[parent]));
+            position = parent;
+        }
+        place(position, std::move(node));
+    }
+
+    void siftDown(std::size_t position) noexcept {
+        const std::size_t count = heap_.size();
+        Node node = std::move(heap_[position]);
+        while (true) {
+            const std::size_t first = D * position + 1;
+            if (first >= count) {
+                break;
+            }
+            const std::size_t last = std::min(first + D, count);
+            std::size_t best = first;
+            for (std::size_t child = first + 1; child < last; ++child) {
+                if (compare_(heap_[best].priority, heap_[child].priority)) {
+                    best = child;
+                }
+            }
+            if (!compare_(node.priority, heap_[best].priority)) {
+                break;
+            }
+            place(position, std::move(heap_[best]));
+            position = best;
+        }
+        place(position, std::move(node));
+    }
+
+    // Removal sends the hole straight down along the best children, then
+    // lets the last leaf sift up from the bottom (Floyd's method). The leaf
+    // usually belongs near the bottom, so this costs D - 1 compares per level
+    // instead of D, and the climb back is short.
+    void removeAt(std::size_t position) noexcept {
+        const Handle handle = heap_[position].handle;
+        Node tail = std::move(heap_.back());
+        heap_.pop_back();
+        const std::size_t count = heap_.size();
+        if (position != count) {
+            while (true) {
+                const std::size_t first = D * position + 1;
+                if (first >= count) {
+                    break;
+                }
+                const std::size_t last = std::min(first + D, count);
+                std::size_t best = first;
+                for (std::size_t child = first + 1; child < last; ++child) {
+                    if (compare_(heap_[best].priority, heap_[child].priority)) {
+                        best = child;
+                    }
+                }
+                place(position, std::move(heap_[best]));
+                position = best;
+            }
+            place(position, std::move(tail));
+            siftUp(position);
+        }
+        keys_[handle].reset();
+        positions_[handle] = free_;
+        free_ = handle;
+    }
+
+    std::vector<Node> heap_;
+    // Indexed by handle. Positions are kept apart from the keys because every
+    // sift step writes one, so they should be as dense as possible. A free
+    // handle's position links to the next free handle.
+    std::vector<std::optional<Key>> keys_;
+    std::vector<std::uint32_t> positions_;
+    Handle free_ = kNone;
+    [[no_unique_address]] Compare compare_;
+};
+
+}  // namespace core
@@ -0,0 +1,153 @@
+/**
+ * @file intern_pool.hpp
+ * @brief String interning with 32-bit symbol handles
+ *
+ * core::InternPool stores each distinct string once, in arena chunks that
+ * never move, and hands out a core::Symbol for it. Two symbols from the same
+ * pool are equal exactly when their strings are, so comparing and hashing a
+ * symbol is a single integer operation.
+ *
+ * Lookups of strings that are already interned (find(), view() and the fast
+ * path of intern()) are lock-free: they read an open-addressing table of
+ * atomic slots and never block writers. Adding a new string takes a mutex.
+ * Strings live as long as the pool; the process-wide pool returned by
+ * InternPool::global() lives until exit.
+ *
+ * @author Modern C++ Starter Template
+ * @date 2025
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+namespace core {
+
+/**
+ * @brief Handle to an interned string
+ *
+ * A default-constructed Symbol is invalid and names no string.
+ */
+class Symbol {
+public:
+    constexpr Symbol() noexcept = default;
+
+    constexpr std::uint32_t id() const noexcept { return id_; }
+    constexpr bool valid() const noexcept { return id_ != 0; }
+    constexpr explicit operator bool() const noexcept { return valid(); }
+
+    friend constexpr bool operator==(Symbol, Symbol) noexcept = default;
+    friend constexpr auto operator<=>(Symbol, Symbol) noexcept = default;
+
+private:
+    friend class InternPool;
+    constexpr explicit Symbol(std::uint32_t id) noexcept : id_(id) {}
+
+    std::uint32_t id_ = 0;
+};
+
+/**
+ * @brief Arena-backed string table with lock-free lookup
+ *
+ * Example usage:
+ * core::InternPool pool;
+ * core::Symbol a = pool.intern("window.width");
+ * core::Symbol b = pool.intern(std::string("window.") + "width");
+ * a == b;                     // true, one integer compare
+ * pool.view(a);               // "window.width", NUL-terminated
+ * pool.find("window.height"); // invalid Symbol, nothing inserted
+ */
+class InternPool {
+public:
+    InternPool();
+    ~InternPool();
+
+    InternPool(const InternPool&) = delete;
+    InternPool& operator=(const InternPool&) = delete;
+
+    /// Process-wide pool used by Config, Logger and core::intern().
+    static InternPool& global();
+
+    /// Returns the symbol for @p text, adding it on first use.
+    Symbol intern(std::string_view text);
+
+    /// Returns the symbol for @p text if it was interned, otherwise an invalid one.
+    Symbol find(std::string_view text) const noexcept;
+
+    /// Text of @p symbol ("" for an invalid one); valid for the pool's lifetime.
+    std::string_view view(Symbol symbol) const noexcept;
+
+    /// Number of distinct strings interned so far.
+    std::size_t size() const noexcept { return count_.load(std::memory_order_acquire); }
+
+    /// Bytes held by the string arena.
+    std::size_t arenaBytes() const;
+
+private:
+    struct Entry {
+        const char* data;
+        std::uint32_t length;
+        std::uint64_t hash;
+    };
+
+    // Open-addressing table; each slot packs (hash tag << 32 | symbol id), 0 = empty
+    struct Table {
+        explicit Table(std::size_t capacity);
+        std::size_t mask;
+        std::unique_ptr<std::atomic<std::uint64_t>[]> slots;
+    };
+
+    // Entries live in segments of doubling size so they never move
+    static constexpr std::size_t kFirstSegmentBits = 6;
+    static constexpr std::size_t kSegments = 32 - kFirstSegmentBits + 1;
+
+    const Entry* entry(std::uint32_t id) const noexcept;
+    Symbol findIn(const Table& table, std::string_view text, std::uint64_t hash) const noexcept;
+    void insertSlot(Table& table, std::uint64_t hash, std::uint32_t id) noexcept;
+    const char* storeText(std::string_view text);
+
+    std::atomic<Table*> table_;
+    std::array<std::atomic<Entry*>, kSegments> segments_{};
+    std::atomic<std::uint32_t> count_{0};
+
+    // Writer-side state, guarded by mutex_
+    mutable std::mutex mutex_;
+    std::vector<std::unique_ptr<Table>> tables_;  // current one last; retired ones kept for readers
+    std::vector<std::unique_ptr<char[]>> chunks_;
+    char* chunkCursor_ = nullptr;
+    std::size_t chunkRemaining_ = 0;
+    std::size_t arenaBytes_ = 0;
+};
+
+/// Interns @p text in the global pool.
+inline Symbol intern(std::string_view text) {
+    return InternPool::global().intern(text);
+}
+
+/// Text of a symbol from the global pool.
+inline std::string_view symbolName(Symbol symbol) noexcept {
+    return InternPool::global().view(symbol);
+}
+
+}  // namespace core
+
+namespace std {
+
+template<>
+struct hash<core::Symbol> {
+    std::size_t operator()(core::Symbol symbol) const noexcept {
+        // Ids are dense small integers; spread them for power-of-two tables
+        return static_cast<std::size_t>(symbol.id() * 0x9E3779B97F4A7C15ull);
+    }
+};
+
+}  // namespace std
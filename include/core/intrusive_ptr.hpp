@@ -0,0 +1,223 @@
+/**
+ * @file intrusive_ptr.hpp
+ * @brief Reference-counted pointer with the count stored in the object
+ *
+ * core::IntrusivePtr<T> is a single pointer wide. The reference count lives
+ * inside T (usually by deriving from core::RefCounted), so there is no
+ * separate control block and no weak count. The counting policy is chosen
+ * per type: AtomicRefCount for objects shared between threads,
+ * NonAtomicRefCount for objects that stay on one thread.
+ *
+ * Any type works with IntrusivePtr if these functions are found by
+ * argument-dependent lookup:
+ *   void intrusivePtrAddRef(const T*) noexcept;
+ *   void intrusivePtrRelease(const T*) noexcept;  // deletes at zero
+ * and optionally, to let make_intrusive skip the first atomic increment:
+ *   void intrusivePtrAdoptNew(const T*) noexcept; // count = 1
+ *
+ * @author Modern C++ Starter Template
+ * @date 2025
+ */
+
+#pragma once
+
+#include <atomic>
+#include <compare>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+namespace core {
+
+/// Thread-safe count: relaxed increments, acq_rel decrements.
+class AtomicRefCount {
+public:
+    /// First reference to an object no other thread can see yet.
+    void initialize() noexcept { count_.store(1, std::memory_order_relaxed); }
+
+    void increment() noexcept { count_.fetch_add(1, std::memory_order_relaxed); }
+
+    /// Returns true when the count dropped to zero.
+    bool decrement() noexcept {
+        // The sole owner cannot race with a copy (there is nothing left to copy
+        // from), so the last release skips the read-modify-write
+        if (count_.load(std::memory_order_acquire) == 1) {
+            return true;
+        }
+        return count_.fetch_sub(1, std::memory_order_acq_rel) == 1;
+    }
+
+    std::size_t load() const noexcept { return count_.load(std::memory_order_relaxed); }
+
+private:
+    std::atomic<std::size_t> count_{0};
+};
+
+/// Plain integer count for objects confined to a single thread.
+class NonAtomicRefCount {
+public:
+    void initialize() noexcept { count_ = 1; }
+    void increment() noexcept { ++count_; }
+    bool decrement() noexcept { return --count_ == 0; }
+    std::size_t load() const noexcept { return count_; }
+
+private:
+    std::size_t count_ = 0;
+};
+
+/**
+ * @brief CRTP base that embeds a reference count in Derived
+ *
+ * Example usage:
+ * struct Texture : core::RefCounted<Texture> { ... };                           // atomic
+ * struct Node : core::RefCounted<Node, core::NonAtomicRefCount> { ... };         // one thread
+ * core::IntrusivePtr<Texture> texture = core::make_intrusive<Texture>(args...);
+ *
+ * Derived is deleted through `delete static_cast<const Derived*>(p)`, so a
+ * hierarchy rooted at Derived needs a virtual destructor.
+ */
+template<typename Derived, typename CountPolicy = AtomicRefCount>
+class RefCounted {
+public:
+    std::size_t refCount() const noexcept { return count_.load(); }
+
+protected:
+    RefCounted() noexcept = default;
+    // A copied object starts unshared
+    RefCounted(const RefCounted&) noexcept {}
+    RefCounted& operator=(const RefCounted&) noexcept { return *this; }
+    ~RefCounted() = default;
+
+private:
+    friend void intrusivePtrAddRef(const Derived* object) noexcept {
+        object->RefCounted::count_.increment();
+    }
+
+    friend void intrusivePtrAdoptNew(const Derived* object) noexcept {
+        object->RefCounted::count_.initialize();
+    }
+
+    friend void intrusivePtrRelease(const Derived* object) noexcept {
+        if (object->RefCounted::count_.decrement()) {
+            delete object;
+        }
+    }
+
+    mutable CountPolicy count_;
+};
+
+/**
+ * @brief Owning pointer to an intrusively counted object
+ *
+ * Example usage:
+ * auto a = core::make_intrusive<Texture>("grass.png");
+ * auto b = a;                 // one increment, no allocation
+ * a->refCount();              // 2
+ */
+template<typename T>
+class IntrusivePtr {
+public:
+    using element_type = T;
+
+    constexpr IntrusivePtr() noexcept = default;
+    constexpr IntrusivePtr(std::nullptr_t) noexcept {}
+
+    /// Takes a reference to @p object; pass addRef = false to adopt one already held.
+    explicit IntrusivePtr(T* object, bool addRef = true) noexcept : object_(object) {
+        if (object_ != nullptr && addRef) {
+            intrusivePtrAddRef(object_);
+        }
+    }
+
+    IntrusivePtr(const IntrusivePtr& other) noexcept : IntrusivePtr(other.object_) {}
+
+    IntrusivePtr(IntrusivePtr&& other) noexcept : object_(std::exchange(other.object_, nullptr)) {}
+
+    template<typename U>
+        requires std::is_convertible_v<U*, T*>
+    IntrusivePtr(const IntrusivePtr<U>& other) noexcept : IntrusivePtr(other.get()) {}
+
+    template<typename U>
+        requires std::is_convertible_v<U*, T*>
+    IntrusivePtr(IntrusivePtr<U>&& other) noexcept : object_(other.detach()) {}
+
+    ~IntrusivePtr() {
+        if (object_ != nullptr) {
+            intrusivePtrRelease(object_);
+        }
+    }
+
+    IntrusivePtr& operator=(const IntrusivePtr& other) noexcept {
+        if (object_ != other.object_) {
+            IntrusivePtr(other).swap(*this);
+        }
+        return *this;
+    }
+
+    IntrusivePtr& operator=(IntrusivePtr&& other) noexcept {
+        IntrusivePtr(std::move(other)).swap(*this);
+        return *this;
+    }
+
+    void reset() noexcept { IntrusivePtr().swap(*this); }
+    void reset(T* object, bool addRef = true) noexcept { IntrusivePtr(object, addRef).swap(*this); }
+
+    /// Releases ownership without decrementing; the caller now holds the reference.
+    T* detach() noexcept { return std::exchange(object_, nullptr); }
+
+    T* get() const noexcept { return object_; }
+    T& operator*() const noexcept { return *object_; }
+    T* operator->() const noexcept { return object_; }
+    explicit operator bool() const noexcept { return object_ != nullptr; }
+
+    void swap(IntrusivePtr& other) noexcept { std::swap(object_, other.object_); }
+    friend void swap(IntrusivePtr& a, IntrusivePtr& b) noexcept { a.swap(b); }
+
+    template<typename U>
+    friend bool operator==(const IntrusivePtr& a, const IntrusivePtr<U>& b) noexcept {
+        return a.get() == b.get();
+    }
+
+    friend bool operator==(const IntrusivePtr& a, std::nullptr_t) noexcept {
+        return a.object_ == nullptr;
+    }
+
+    friend auto operator<=>(const IntrusivePtr& a, const IntrusivePtr& b) noexcept {
+        return std::compare_three_way{}(a.object_, b.object_);
+    }
+
+private:
+    T* object_ = nullptr;
+};
+
+/// Allocates T (count included, one block) and returns the first reference.
+template<typename T, typename... Args>
+IntrusivePtr<T> make_intrusive(Args&&... args) {
+    T* object = new T(std::forward<Args>(args)...);
+    if constexpr (requires { intrusivePtrAdoptNew(object); }) {
+        // Unpublished object: set the count with a plain store
+        intrusivePtrAdoptNew(object);
+        return IntrusivePtr<T>(object, false);
+    } else {
+        return IntrusivePtr<T>(object);
+    }
+}
+
+template<typename T, typename U>
+IntrusivePtr<T> static_pointer_cast(const IntrusivePtr<U>& ptr) noexcept {
+    return IntrusivePtr<T>(static_cast<T*>(ptr.get()));
+}
+
+}  // namespace core
+
+namespace std {
+
+template<typename T>
+struct hash<core::IntrusivePtr<T>> {
+    std::size_t operator()(const core::IntrusivePtr<T>& ptr) const noexcept {
+        return std::hash<T*>{}(ptr.get());
+    }
+};
+
+}  // namespace std
@@ -0,0 +1,397 @@
+/**
+ * @file lru_cache.hpp
+ * @brief Sharded, thread-safe LRU / CLOCK cache with size limits and TTL
+ *
+ * core::LruCache<K, V> replaces the "unordered_map plus one mutex" memo
+ * table. Keys are spread over a power-of-two number of shards, and each
+ * shard has its own lock, hash map and recency list. Threads working on
+ * different keys rarely touch the same lock.
+ *
+ * Two eviction policies are available:
+ * - EvictionPolicy::kLru: exact least-recently-used order within a shard.
+ *   Every hit moves its entry to the front of the list, so hits take the
+ *   shard lock exclusively.
+ * - EvictionPolicy::kClock: the CLOCK (second-chance) approximation. A hit
+ *   only sets the entry's reference bit, so hits take the shard lock in
+ *   shared mode and never write to the list. Concurrent readers of one
+ *   shard proceed in parallel. Eviction walks from the oldest entry and
+ *   gives referenced entries a second chance.
+ *
+ * The cache can be bounded by entry count, by bytes, or both. Bytes are
+ * measured by a weigher function (sizeof(K) + sizeof(V) by default).
+ * Limits are split evenly across shards, so a shard may evict while others
+ * still have room. Entries may also expire: a TTL from the options or one
+ * given per put(). Expired entries read as misses and are dropped lazily.
+ *
+ * Hits, misses, insertions, evictions and expirations are counted per
+ * shard with relaxed atomics; stats() adds them up.
+ *
+ * @author Modern C++ Starter Template
+ * @date 2025
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <thread>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+
+namespace core {
+
+enum class EvictionPolicy {
+    kLru,   ///< exact LRU; hits reorder the list under an exclusive lock
+    kClock  ///< second-chance approximation; hits take a shared lock
+};
+
+/**
+ * @brief Thread-safe sharded cache with LRU or CLOCK eviction
+ *
+ * Example usage:
+ * core::LruCache<int, long>::Options options;
+ * options.maxEntries = 10'000;
+ * options.ttl = std::chrono::minutes(5);
+ * core::LruCache<int, long> factorials(options);
+ * long value = factorials.getOrCompute(20, [] { return slowFactorial(20); });
+ * auto stats = factorials.stats();      // hits, misses, evictions, ...
+ */
+template<typename K, typename V, typename Hash = std::hash<K>,
+         typename Clock = std::chrono::steady_clock>
+class LruCache {
+public:
+    using Duration = typename Clock::duration;
+    using TimePoint = typename Clock::time_point;
+    using Weigher = std::function<std::size_t(const K&, const V&)>;
+
+    struct Options {
+        std::size_t maxEntries = 0;  ///< 0 = no count limit
+        std::size_t maxBytes = 0;    ///< 0 = no byte limit
+        Weigher weigher;             ///< entry size in bytes; default sizeof(K) + sizeof(V)
+        Duration ttl = Duration::zero();  ///< default time to live; zero = never expires
+        EvictionPolicy policy = EvictionPolicy::kLru;
+        std::size_t shards = 0;  ///< rounded up to a power of two; 0 = pick from core count
+    };
+
+    /// Counter totals across all shards.
+    struct Stats {
+        std::uint64_t hits = 0;
+        std::uint64_t misses = 0;
+        std::uint64_t insertions = 0;   ///< new keys stored by put()
+        std::uint64_t evictions = 0;    ///< entries dropped to meet a size limit
+        std::uint64_t expirations = 0;  ///< expired entries removed
+
+        double hitRate() const noexcept {
+            const std::uint64_t lookups = hits + misses;
+            return lookups == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(lookups);
+        }
+    };
+
+    explicit LruCache(Options options)
+        : weigher_(std::move(options.weigher)), ttl_(options.ttl), policy_(options.policy) {
+        std::size_t shards = options.shards;
+        if (shards == 0) {
+            // A few shards per core, but keep at least 64 entries per shard
+            // so per-shard eviction stays close to global LRU
+            shards = std::clamp<std::size_t>(4 * std::thread::hardware_concurrency(), 1, 64);
+            while (shards > 1 && options.maxEntries != 0 && options.maxEntries / shards < 64) {
+                shards /= 2;
+            }
+        }
+        shardCount_ = std::bit_ceil(shards);
+        shards_ = std::make_unique<Shard[]>(shardCount_);
+        entryLimit_ = perShard(options.maxEntries);
+        byteLimit_ = perShard(options.maxBytes);
+        if (options.maxEntries != 0) {
+            for (std::size_t i = 0; i < shardCount_; ++i) {
+                shards_[i].map.reserve(entryLimit_ + 1);  // no rehash once warm
+            }
+        }
+    }
+
+    /// Cache holding at most @p maxEntries entries with default options.
+    explicit LruCache(std::size_t maxEntries) : LruCache(optionsWithEntries(maxEntries)) {}
+
+    LruCache(const LruCache&) = delete;
+    LruCache& operator=(const LruCache&) = delete;
+
+    /// Copy of the cached value, or std::nullopt on a miss or an expired entry.
+    std::optional<V> get(const K& key) {
+        Shard& shard = shardFor(key);
+        if (policy_ == EvictionPolicy::kClock) {
+            std::shared_lock lock(shard.mutex);
+            const auto it = shard.map.find(key);
+            if (it == shard.map.end() || isExpired(it->second)) {
+                shard.misses.fetch_add(1, std::memory_order_relaxed);
+                return std::nullopt;
+            }
+            // Skip the store when the bit is already set: no cache-line write
+            if (!it->second.referenced.load(std::memory_order_relaxed)) {
+                it->second.referenced.store(true, std::memory_order_relaxed);
+            }
+            shard.hits.fetch_add(1, std::memory_order_relaxed);
+            return it->second.value;
+        }
+
+        std::unique_lock lock(shard.mutex);
+        const auto it = shard.map.find(key);
+        if (it == shard.map.end()) {
+            shard.misses.fetch_add(1, std::memory_order_relaxed);
+            return std::nullopt;
+        }
+        if (isExpired(it->second)) {
+            remove(shard, it);
+            shard.expirations.fetch_add(1, std::memory_order_relaxed);
+            shard.misses.fetch_add(1, std::memory_order_relaxed);
+            return std::nullopt;
+        }
+        moveToFront(shard, &*it);
+        shard.hits.fetch_add(1, std::memory_order_relaxed);
+        return it->second.value;
+    }
+
+    /// Inserts or replaces @p key with the default TTL.
+    void put(const K& key, V value) { put(key, std::move(value), ttl_); }
+
+    /// Inserts or replaces @p key; it expires after @p ttl (zero = never).
+    /// A value heavier than a whole shard's byte budget is not cached.
+    void put(const K& key, V value, Duration ttl) {
+        const std::size_t bytes = weigh(key, value);
+        TimePoint expiry = TimePoint::max();
+        if (ttl > Duration::zero()) {
+            expiry = Clock::now() + ttl;
+            mayExpire_.store(true, std::memory_order_relaxed);
+        }
+
+        Shard& shard = shardFor(key);
+        std::unique_lock lock(shard.mutex);
+        auto it = shard.map.find(key);
+        if (bytes > byteLimit_) {
+            if (it != shard.map.end()) {
+                remove(shard, it);
+            }
+            return;
+        }
+        if (it != shard.map.end()) {
+            Entry& entry = it->second;
+            shard.bytes = shard.bytes - entry.bytes + bytes;
+            entry.value = std::move(value);
+            entry.bytes = bytes;
+            entry.expiry = expiry;
+            moveToFront(shard, &*it);
+        } else {
+            it = shard.map
+                     .emplace(std::piecewise_construct, std::forward_as_tuple(key),
+                              std::forward_as_tuple(std::move(value), expiry, bytes))
+                     .first;
+            shard.bytes += bytes;
+            pushFront(shard, &*it);
+            shard.insertions.fetch_add(1, std::memory_order_relaxed);
+        }
+        evictOverflow(shard, &*it);
+    }
+
+    /**
+     * @brief Cached value for @p key, computing and storing it on a miss
+     *
+     * @p compute runs without any lock held, so two threads that miss on
+     * the same key at the same time may both compute it; the later put wins.
+     */
+    template<typename Compute>
+    V getOrCompute(const K& key, Compute&& compute) {
+        if (std::optional<V> cached = get(key)) {
+            return std::move(*cached);
+        }
+        V value = std::forward<Compute>(compute)();
+        put(key, value);
+        return value;
+    }
+
+    /// Removes @p key; false if it was not cached.
+    bool erase(const K& key) {
+        Shard& shard = shardFor(key);
+        std::unique_lock lock(shard.mutex);
+        const auto it = shard.map.find(key);
+        if (it == shard.map.end()) {
+            return false;
+        }
+        remove(shard, it);
+        return true;
+    }
+
+    void clear() {
+        for (std::size_t i = 0; i < shardCount_; ++i) {
+            Shard& shard = shards_[i];
+            std::unique_lock lock(shard.mutex);
+            shard.map.clear();
+            shard.head = shard.tail = nullptr;
+            shard.bytes = 0;
+        }
+    }
+
+    /// Number of cached entries, including expired ones not yet dropped.
+    std::size_t size() const {
+        std::size_t total = 0;
+        for (std::size_t i = 0; i < shardCount_; ++i) {
+            std::shared_lock lock(shards_[i].mutex);
+            total += shards_[i].map.size();
+        }
+        return total;
+    }
+
+    /// Total weight of the cached entries.
+    std::size_t bytes() const {
+        std::size_t total = 0;
+        for (std::size_t i = 0; i < shardCount_; ++i) {
+            std::shared_lock lock(shards_[i].mutex);
+            total += shards_[i].bytes;
+        }
+        return total;
+    }
+
+    Stats stats() const noexcept {
+        Stats total;
+        for (std::size_t i = 0; i < shardCount_; ++i) {
+            const Shard& shard = shards_[i];
+            total.hits += shard.hits.load(std::memory_order_relaxed);
+            total.misses += shard.misses.load(std::memory_order_relaxed);
+            total.insertions += shard.insertions.load(std::memory_order_relaxed);
+            total.evictions += shard.evictions.load(std::memory_order_relaxed);
+            total.expirations += shard.expirations.load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+    std::size_t shardCount() const noexcept { return shardCount_; }
+    EvictionPolicy policy() const noexcept { return policy_; }
+
+private:
+    struct Entry;
+    using Node = std::pair<const K, Entry>;
+
+    struct Entry {
+        Entry(V v, TimePoint e, std::size_t b) : value(std::move(v)), expiry(e), bytes(b) {}
+
+        V value;
+        TimePoint expiry;
+        std::size_t bytes;
+        Node* prev = nullptr;  ///< towards the most recently used entry
+        Node* next = nullptr;  ///< towards the eviction end
+        std::atomic<bool> referenced{false};  ///< CLOCK bit, set by hits under a shared lock
+    };
+
+    // Aligned so neighbouring shards' locks and counters do not share a line
+    struct alignas(64) Shard {
+        mutable std::shared_mutex mutex;
+        std::unordered_map<K, Entry, Hash> map;
+        Node* head = nullptr;
+        Node* tail = nullptr;
+        std::size_t bytes = 0;
+        std::atomic<std::uint64_t> hits{0};
+        std::atomic<std::uint64_t> misses{0};
+        std::atomic<std::uint64_t> insertions{0};
+        std::atomic<std::uint64_t> evictions{0};
+        std::atomic<std::uint64_t> expirations{0};
+    };
+
+    static Options optionsWithEntries(std::size_t maxEntries) {
+        Options options;
+        options.maxEntries = maxEntries;
+        return options;
+    }
+
+    std::size_t perShard(std::size_t limit) const noexcept {
+        if (limit == 0) {
+            return std::numeric_limits<std::size_t>::max();
+        }
+        return std::max<std::size_t>(1, (limit + shardCount_ - 1) / shardCount_);
+    }
+
+    Shard& shardFor(const K& key) const {
+        // Fibonacci hashing: the map uses the low bits, shards use the high ones
+        const auto h = static_cast<std::uint64_t>(hash_(key)) * 0x9e3779b97f4a7c15ULL;
+        return shards_[static_cast<std::size_t>(h >> 40) & (shardCount_ - 1)];
+    }
+
+    std::size_t weigh(const K& key, const V& value) const {
+        return weigher_ ? weigher_(key, value) : sizeof(K) + sizeof(V);
+    }
+
+    bool isExpired(const Entry& entry) const {
+        return mayExpire_.load(std::memory_order_relaxed) && entry.expiry != TimePoint::max() &&
+               Clock::now() >= entry.expiry;
+    }
+
+    static void unlink(Shard& shard, Node* node) noexcept {
+        Entry& entry = node->second;
+        (entry.prev ? entry.prev->second.next : shard.head) = entry.next;
+        (entry.next ? entry.next->second.prev : shard.tail) = entry.prev;
+        entry.prev = entry.next = nullptr;
+    }
+
+    static void pushFront(Shard& shard, Node* node) noexcept {
+        Entry& entry = node->second;
+        entry.prev = nullptr;
+        entry.next = shard.head;
+        (shard.head ? shard.head->second.prev : shard.tail) = node;
+        shard.head = node;
+    }
+
+    static void moveToFront(Shard& shard, Node* node) noexcept {
+        if (shard.head != node) {
+            unlink(shard, node);
+            pushFront(shard, node);
+        }
+    }
+
+    static void remove(Shard& shard, typename std::unordered_map<K, Entry, Hash>::iterator it) {
+        unlink(shard, &*it);
+        shard.bytes -= it->second.bytes;
+        shard.map.erase(it);
+    }
+
+    /// Evicts from the tail until the shard fits its limits, sparing @p added.
+    void evictOverflow(Shard& shard, Node* added) {
+        while (shard.tail != nullptr &&
+               (shard.map.size() > entryLimit_ || shard.bytes > byteLimit_)) {
+            Node* victim = shard.tail;
+            Entry& entry = victim->second;
+            const bool expired = isExpired(entry);
+            // CLOCK: a referenced entry loses its bit and goes round again,
+            // as does the entry just added. Each pass clears bits, so the
+            // loop ends within two sweeps
+            if (victim == added ||
+                (policy_ == EvictionPolicy::kClock && !expired &&
+                 entry.referenced.exchange(false, std::memory_order_relaxed))) {
+                moveToFront(shard, victim);
+                continue;
+            }
+            remove(shard, shard.map.find(victim->first));
+            (expired ? shard.expirations : shard.evictions)
+                .fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    std::unique_ptr<Shard[]> shards_;
+    std::size_t shardCount_ = 1;
+    std::size_t entryLimit_ = 0;
+    std::size_t byteLimit_ = 0;
+    Weigher weigher_;
+    Duration ttl_;
+    EvictionPolicy policy_;
+    std::atomic<bool> mayExpire_{false};
+    [[no_unique_address]] Hash hash_;
+};
+
+}  // namespace core
@@ -0,0 +1,236 @@
+/**
+ * @file parallel_sort.hpp
+ * @brief Parallel sample sort running on core::ThreadPool
+ *
+ * core::parallel_sort and core::parallel_stable_sort accept the same
+ * comparator/projection arguments as std::ranges::sort. Inputs smaller than
+ * kParallelSortThreshold (or pools with a single worker) use std::sort /
+ * std::stable_sort directly. Larger inputs are sample sorted:
+ * - choose bucket splitters from an oversampled, sorted sample
+ * - classify every element into a bucket, one block per task
+ * - scatter the elements into a scratch buffer, bucket by bucket
+ * - sort the buckets independently and move them back
+ *
+ * Every phase is a flat ThreadPool::parallelFor, so the whole sort uses
+ * one scratch buffer of n elements plus one byte per element for bucket ids.
+ *
+ * @author Modern C++ Starter Template
+ * @date 2025
+ */
+
+#pragma once
+
+#include "core/thread_pool.hpp"
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <type_traits>
+#include <vector>
+
+namespace core {
+
+/// Inputs below this many elements are sorted sequentially.
+inline constexpr std::size_t kParallelSortThreshold = std::size_t{1} << 16;
+
+namespace detail {
+
+/// Owns uninitialized scratch storage; destroys the elements if still live.
+template<typename T>
+class SortBuffer {
+public:
+    explicit SortBuffer(std::size_t size) : data_(std::allocator<T>{}.allocate(size)), size_(size) {}
+
+    ~SortBuffer() {
+        if (live_) {
+            std::destroy_n(data_, size_);
+        }
+        std::allocator<T>{}.deallocate(data_, size_);
+    }
+
+    SortBuffer(const SortBuffer&) = delete;
+    SortBuffer& operator=(const SortBuffer&) = delete;
+
+    T* data() const { return data_; }
+    void setLive(bool live) { live_ = live; }
+
+private:
+    T* data_;
+    std::size_t size_;
+    bool live_ = false;
+};
+
+template<bool Stable, typename RandomIt, typename Less>
+void sequentialSort(RandomIt first, RandomIt last, Less less) {
+    if constexpr (Stable) {
+        std::stable_sort(first, last, less);
+    } else {
+        std::sort(first, last, less);
+    }
+}
+
+template<bool Stable, typename RandomIt, typename Comp, typename Proj>
+void sampleSort(ThreadPool& pool, RandomIt first, RandomIt last, Comp& comp, Proj& proj) {
+    using T = std::iter_value_t<RandomIt>;
+
+    auto less = [&comp, &proj](const T& a, const T& b) {
+        return std::invoke(comp, std::invoke(proj, a), std::invoke(proj, b));
+    };
+
+    const auto n = static_cast<std::size_t>(last - first);
+    if (n < kParallelSortThreshold || pool.size() < 2 || !std::is_nothrow_move_constructible_v<T>) {
+        sequentialSort<Stable>(first, last, less);
+        return;
+    }
+
+    // Bucket ids are stored as bytes, which caps the fan-out at 256
+    const std::size_t threads = pool.size() + 1;
+    const std::size_t buckets = std::clamp<std::size_t>(threads * 8, 2, 256);
+    const std::size_t blocks = threads * 4;
+    const std::size_t blockSize = (n + blocks - 1) / blocks;
+
+    // 1. Splitters from a sorted, oversampled set of element positions
+    constexpr std::size_t kOversample = 32;
+    std::vector<std::size_t> sample(buckets * kOversample);
+    std::uint64_t rng = 0x9E3779B97F4A7C15ULL ^ n;
+    for (auto& index : sample) {
+        rng ^= rng << 13;
+        rng ^= rng >> 7;
+        rng ^= rng << 17;
+        index = static_cast<std::size_t>(rng % n);
+    }
+    std::sort(sample.begin(), sample.end(), [&](std::size_t a, std::size_t b) {
+        return less(first[static_cast<std::ptrdiff_t>(a)], first[static_cast<std::ptrdiff_t>(b)]);
+    });
+    std::vector<std::size_t> splitters(buckets - 1);
+    for (std::size_t i = 0; i < splitters.size(); ++i) {
+        splitters[i] = sample[(i + 1) * kOversample];
+    }
+
+    // 2. Classify each block; equal keys always land in the same bucket
+    std::vector<std::uint8_t> bucketOf(n);
+    std::vector<std::size_t> counts(blocks * buckets, 0);
+    pool.parallelFor(blocks, [&](std::size_t block) {
+        const std::size_t begin = std::min(n, block * blockSize);
+        const std::size_t end = std::min(n, begin + blockSize);
+        std::size_t* blockCounts = &counts[block * buckets];
+        for (std::size_t i = begin; i < end; ++i) {
+            const T& value = first[static_cast<std::ptrdiff_t>(i)];
+            const auto bucket = static_cast<std::size_t>(
+                std::upper_bound(splitters.begin(), splitters.end(), value,
+                                 [&](const T& v, std::size_t s) {
+                                     return less(v, first[static_cast<std::ptrdiff_t>(s)]);
+                                 }) -
+                splitters.begin());
+            bucketOf[i] = static_cast<std::uint8_t>(bucket);
+            ++blockCounts[bucket];
+        }
+    });
+
+    // 3. Bucket-major prefix sums keep the scatter stable across blocks
+    std::vector<std::size_t> bucketStart(buckets + 1, 0);
+    std::size_t offset = 0;
+    for (std::size_t b = 0; b < buckets; ++b) {
+        bucketStart[b] = offset;
+        for (std::size_t block = 0; block < blocks; ++block) {
+            const std::size_t count = counts[block * buckets + b];
+            counts[block * buckets + b] = offset;
+            offset += count;
+        }
+    }
+    bucketStart[buckets] = offset;
+
+    // 4. Scatter into the scratch buffer (noexcept moves only)
+    SortBuffer<T> buffer(n);
+    T* scratch = buffer.data();
+    pool.parallelFor(blocks, [&](std::size_t block) {
+        const std::size_t begin = std::min(n, block * blockSize);
+        const std::size_t end = std::min(n, begin + blockSize);
+        std::size_t* cursor = &counts[block * buckets];
+        for (std::size_t i = begin; i < end; ++i) {
+            std::construct_at(scratch + cursor[bucketOf[i]]++,
+                              std::move(first[static_cast<std::ptrdiff_t>(i)]));
+        }
+    });
+    buffer.setLive(true);
+
+    // 5. Sort buckets independently, then move them back in place
+    pool.parallelFor(buckets, [&](std::size_t b) {
+        sequentialSort<Stable>(scratch + bucketStart[b], scratch + bucketStart[b + 1], less);
+    });
+    pool.parallelFor(blocks, [&](std::size_t block) {
+        const std::size_t begin = std::min(n, block * blockSize);
+        const std::size_t end = std::min(n, begin + blockSize);
+        std::move(scratch + begin, scratch + end, first + static_cast<std::ptrdiff_t>(begin));
+        std::destroy(scratch + begin, scratch + end);
+    });
+    buffer.setLive(false);
+}
+
+}  // namespace detail
+
+/**
+ * @brief Sorts [first, last) using the given pool
+ *
+ * Example usage:
+ * core::parallel_sort(pool, keys.begin(), keys.end());
+ * core::parallel_sort(pool, people.begin(), people.end(), std::greater<>{}, &Person::age);
+ */
+template<std::random_access_iterator RandomIt, typename Comp = std::ranges::less,
+         typename Proj = std::identity>
+    requires std::sortable<RandomIt, Comp, Proj>
+void parallel_sort(ThreadPool& pool, RandomIt first, RandomIt last, Comp comp = {}, Proj proj = {}) {
+    detail::sampleSort<false>(pool, first, last, comp, proj);
+}
+
+/// Sorts [first, last) on the shared core pool.
+template<std::random_access_iterator RandomIt, typename Comp = std::ranges::less,
+         typename Proj = std::identity>
+    requires std::sortable<RandomIt, Comp, Proj>
+void parallel_sort(RandomIt first, RandomIt last, Comp comp = {}, Proj proj = {}) {
+    detail::sampleSort<false>(ThreadPool::getInstance(), first, last, comp, proj);
+}
+
+/// Sorts a random-access range on the shared core pool.
+template<std::ranges::random_access_range Range, typename Comp = std::ranges::less,
+         typename Proj = std::identity>
+    requires std::sortable<std::ranges::iterator_t<Range>, Comp, Proj>
+void parallel_sort(Range&& range, Comp comp = {}, Proj proj = {}) {
+    detail::sampleSort<false>(ThreadPool::getInstance(), std::ranges::begin(range),
+                              std::ranges::end(range), comp, proj);
+}
+
+/**
+ * @brief Stable variant: equivalent elements keep their relative order
+ */
+template<std::random_access_iterator RandomIt, typename Comp = std::ranges::less,
+         typename Proj = std::identity>
+    requires std::sortable<RandomIt, Comp, Proj>
+void parallel_stable_sort(ThreadPool& pool, RandomIt first, RandomIt last, Comp comp = {},
+                          Proj proj = {}) {
+    detail::sampleSort<true>(pool, first, last, comp, proj);
+}
+
+/// Stable sort of [first, last) on the shared core pool.
+template<std::random_access_iterator RandomIt, typename Comp = std::ranges::less,
+         typename Proj = std::identity>
+    requires std::sortable<RandomIt, Comp, Proj>
+void parallel_stable_sort(RandomIt first, RandomIt last, Comp comp = {}, Proj proj = {}) {
+    detail::sampleSort<true>(ThreadPool::getInstance(), first, last, comp, proj);
+}
+
+/// Stable sort of a random-access range on the shared core pool.
+template<std::ranges::random_access_range Range, typename Comp = std::ranges::less,
+         typename Proj = std::identity>
+    requires std::sortable<std::ranges::iterator_t<Range>, Comp, Proj>
+void parallel_stable_sort(Range&& range, Comp comp = {}, Proj proj = {}) {
+    detail::sampleSort<true>(ThreadPool::getInstance(), std::ranges::begin(range),
+                             std::ranges::end(range), comp, proj);
+}
+
+}  // namespace core
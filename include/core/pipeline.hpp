@@ -0,0 +1,204 @@
+/**
+ * @file pipeline.hpp
+ * @brief Staged pipeline executor with token-based flow control
+ *
+ * A core::Pipeline is a linear chain source -> stage... -> sink. Items move
+ * between stages through bounded lock-free queues (core::BoundedQueue). The
+ * number of items in flight is capped by a fixed pool of tokens: the source
+ * can only produce while a token is free, and the sink returns the token.
+ *
+ * Each stage declares how it may run:
+ * - SerialInOrder: one item at a time, in source order
+ * - SerialOutOfOrder: one item at a time, in any order
+ * - Parallel: any number of items at once
+ *
+ * Stage payloads are type-erased between stages. As with Config, a stage
+ * that receives a type other than its declared input throws
+ * std::runtime_error.
+ *
+ * @author Modern C++ Starter Template
+ * @date 2025
+ */
+
+#pragma once
+
+#include "core/bounded_queue.hpp"
+#include "core/thread_pool.hpp"
+
+#include <any>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace core {
+
+/// How a pipeline stage may be scheduled.
+enum class StageMode {
+    SerialInOrder,
+    SerialOutOfOrder,
+    Parallel
+};
+
+/// Per-stage counters; throughput covers the most recent run().
+struct StageStats {
+    std::string name;
+    StageMode mode = StageMode::Parallel;
+    std::uint64_t processed = 0;         ///< items completed by this stage
+    std::chrono::nanoseconds busyTime{}; ///< total time spent inside the stage body
+    std::size_t queueDepth = 0;          ///< items currently waiting for this stage
+    std::size_t maxQueueDepth = 0;       ///< high-water mark of queueDepth
+    double itemsPerSecond = 0.0;         ///< processed / wall time of the last run
+};
+
+/**
+ * @brief Linear multi-stage pipeline running on core::ThreadPool
+ *
+ * Example usage:
+ * core::Pipeline pipeline(32);  // at most 32 items in flight
+ * pipeline.addSource<std::string>("parse", [&]() -> std::optional<std::string> { ... })
+ *         .addStage<std::string, Record>("transform", core::StageMode::Parallel, transform)
+ *         .addSink<Record>("emit", core::StageMode::SerialInOrder, emit);
+ * pipeline.run();
+ */
+class Pipeline {
+public:
+    explicit Pipeline(std::size_t maxTokens = 64);
+    ~Pipeline();
+
+    Pipeline(const Pipeline&) = delete;
+    Pipeline& operator=(const Pipeline&) = delete;
+
+    /**
+     * @brief Sets the serial source; @p produce returns std::nullopt when done
+     */
+    template<typename Out, typename F>
+    Pipeline& addSource(std::string name, F&& produce);
+
+    /// Appends a stage converting In to Out.
+    template<typename In, typename Out, typename F>
+    Pipeline& addStage(std::string name, StageMode mode, F&& transform);
+
+    /// Appends the final stage consuming In.
+    template<typename In, typename F>
+    Pipeline& addSink(std::string name, StageMode mode, F&& consume);
+
+    /**
+     * @brief Runs the pipeline to completion on @p pool
+     *
+     * The calling thread takes part in the work. The first exception thrown
+     * by any stage stops the run and is rethrown here.
+     */
+    void run(ThreadPool& pool = ThreadPool::getInstance());
+
+    /// Counter snapshot for every stage, source first.
+    std::vector<StageStats> stats() const;
+
+    std::size_t maxTokens() const { return slots_.size(); }
+
+private:
+    struct Slot {
+        std::any payload;
+        std::uint64_t sequence = 0;
+    };
+
+    struct Stage {
+        std::string name;
+        StageMode mode = StageMode::Parallel;
+        std::function<bool(std::any&)> body;  // false from the source means "end of input"
+        std::unique_ptr<BoundedQueue<std::uint32_t>> input;
+        std::atomic<bool> busy{false};
+        std::uint64_t nextSequence = 0;       // SerialInOrder only, guarded by busy
+        std::vector<std::int64_t> reorder;    // slot per sequence % maxTokens, guarded by busy
+        std::atomic<std::size_t> buffered{0};
+        std::atomic<std::uint64_t> processed{0};
+        std::atomic<std::uint64_t> busyNanos{0};
+        std::atomic<std::size_t> maxDepth{0};
+    };
+
+    void addStageImpl(std::string name, StageMode mode, std::function<bool(std::any&)> body,
+                      bool isSource);
+    void workerLoop();
+    bool runSource();
+    bool runStage(std::size_t index);
+    void process(std::size_t index, std::uint32_t slot);
+    void forward(std::size_t index, std::uint32_t slot);
+    void noteDepth(Stage& stage);
+    bool finished() const;
+
+    template<typename In>
+    static In& payloadAs(std::any& payload, const std::string& stageName);
+
+    std::vector<Slot> slots_;
+    std::vector<std::unique_ptr<Stage>> stages_;
+    std::unique_ptr<BoundedQueue<std::uint32_t>> freeSlots_;
+    bool hasSink_ = false;
+
+    std::atomic<bool> sourceDone_{false};
+    std::atomic<bool> failed_{false};
+    std::atomic<std::size_t> inFlight_{0};
+    std::uint64_t nextSequence_ = 0;  // guarded by the source's busy flag
+    std::chrono::nanoseconds lastRunTime_{};
+};
+
+template<typename In>
+In& Pipeline::payloadAs(std::any& payload, const std::string& stageName) {
+    auto* value = std::any_cast<In>(&payload);
+    if (value == nullptr) {
+        throw std::runtime_error("Type mismatch in Pipeline stage: " + stageName);
+    }
+    return *value;
+}
+
+template<typename Out, typename F>
+Pipeline& Pipeline::addSource(std::string name, F&& produce) {
+    addStageImpl(std::move(name), StageMode::SerialInOrder,
+                 [produce = std::forward<F>(produce)](std::any& payload) mutable {
+                     std::optional<Out> item = produce();
+                     if (!item) {
+                         return false;
+                     }
+                     payload.template emplace<Out>(std::move(*item));
+                     return true;
+                 },
+                 true);
+    return *this;
+}
+
+template<typename In, typename Out, typename F>
+Pipeline& Pipeline::addStage(std::string name, StageMode mode, F&& transform) {
+    const std::string stageName = name;
+    addStageImpl(std::move(name), mode,
+                 [transform = std::forward<F>(transform), stageName](std::any& payload) mutable {
+                     In& input = payloadAs<In>(payload, stageName);
+                     Out output = std::invoke(transform, std::move(input));
+                     payload.template emplace<Out>(std::move(output));
+                     return true;
+                 },
+                 false);
+    return *this;
+}
+
+template<typename In, typename F>
+Pipeline& Pipeline::addSink(std::string name, StageMode mode, F&& consume) {
+    const std::string stageName = name;
+    addStageImpl(std::move(name), mode,
+                 [consume = std::forward<F>(consume), stageName](std::any& payload) mutable {
+                     std::invoke(consume, std::move(payloadAs<In>(payload, stageName)));
+                     payload.reset();
+                     return true;
+                 },
+                 false);
+    hasSink_ = true;
+    return *this;
+}
+
+}  // namespace core
@@ -0,0 +1,465 @@
+/**
+ * @file radix_sort.hpp
+ * @brief Radix sorts for integer, floating-point and string keys
+ *
+ * core::radix_sort takes an optional projection, like std::ranges::sort. It
+ * picks the algorithm from the projected key type:
+ * - integers and IEEE floats: stable LSD radix sort. Keys are mapped to
+ *   unsigned integers that order the same way, then sorted by 11-bit digits
+ *   (8-bit for keys narrower than 32 bits), so 64-bit keys take six passes.
+ *   One counting pass builds every digit histogram. Digits that are equal in
+ *   every key are skipped, so small values in wide types cost fewer passes.
+ * - anything convertible to std::string_view: in-place MSD radix sort
+ *   (American flag sort). It is not stable.
+ *
+ * Floats are ordered by bit pattern: -0.0 sorts before +0.0, and NaNs sort to
+ * the ends according to their sign bit.
+ *
+ * core::parallel_radix_sort runs the same passes on a core::ThreadPool. For
+ * numeric keys each block counts its digits and scatters its own elements.
+ * For strings, the first byte splits the input and the 256 buckets are
+ * sorted as independent tasks.
+ *
+ * @author Modern C++ Starter Template
+ * @date 2025
+ */
+
+#pragma once
+
+#include "core/parallel_sort.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <ranges>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace core {
+
+/// Ranges of this many elements or fewer use a comparison sort instead.
+inline constexpr std::size_t kRadixSortSmall = 64;
+
+namespace detail {
+
+/// Byte values 0-255 plus a leading bucket for strings that end earlier.
+inline constexpr std::size_t kStringBuckets = 257;
+
+template<typename K>
+concept RadixIntegral = std::integral<K> && !std::same_as<K, bool>;
+
+template<typename K>
+concept RadixFloating = std::floating_point<K> && std::numeric_limits<K>::is_iec559 &&
+                        (sizeof(K) == 4 || sizeof(K) == 8);
+
+template<typename It, typename Proj>
+using RadixProjected = std::remove_cvref_t<std::indirect_result_t<Proj&, It>>;
+
+/// Maps @p key to an unsigned integer with the same ordering.
+template<typename K>
+constexpr auto radixKey(K key) noexcept {
+    if constexpr (std::floating_point<K>) {
+        using U = std::conditional_t<sizeof(K) == 4, std::uint32_t, std::uint64_t>;
+        constexpr U kSign = U{1} << (sizeof(U) * 8 - 1);
+        const auto bits = std::bit_cast<U>(key);
+        // Negatives: flip every bit so larger magnitudes sort first
+        return (bits & kSign) != 0 ? static_cast<U>(~bits) : static_cast<U>(bits | kSign);
+    } else {
+        using U = std::make_unsigned_t<K>;
+        if constexpr (std::is_signed_v<K>) {
+            constexpr U kSign = U{1} << (sizeof(U) * 8 - 1);
+            return static_cast<U>(static_cast<U>(key) ^ kSign);
+        } else {
+            return static_cast<U>(key);
+        }
+    }
+}
+
+/// Digit layout for an unsigned key type.
+template<typename Key>
+struct RadixDigits {
+    // Fewer passes beat the larger histograms: 2048 counters still fit in L1
+    static constexpr std::size_t kBits = sizeof(Key) >= 4 ? 11 : 8;
+    static constexpr std::size_t kBuckets = std::size_t{1} << kBits;
+    static constexpr std::size_t kPasses = (sizeof(Key) * 8 + kBits - 1) / kBits;
+
+    static constexpr std::size_t digit(Key key, std::size_t pass) noexcept {
+        return static_cast<std::size_t>(key >> (pass * kBits)) & (kBuckets - 1);
+    }
+};
+
+template<typename T>
+constexpr bool kRadixMovable =
+    std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T>;
+
+/// Projects an element and returns its unsigned radix key.
+template<typename Proj>
+auto radixKeyOf(Proj& proj) {
+    return [&proj](const auto& value) { return radixKey(std::invoke(proj, value)); };
+}
+
+template<typename RandomIt, typename Proj>
+void lsdRadixSort(RandomIt first, RandomIt last, Proj& proj) {
+    using T = std::iter_value_t<RandomIt>;
+    using Key = decltype(radixKey(std::declval<RadixProjected<RandomIt, Proj>>()));
+    using Digits = RadixDigits<Key>;
+    constexpr std::size_t kPasses = Digits::kPasses;
+    constexpr std::size_t kBuckets = Digits::kBuckets;
+
+    auto keyOf = radixKeyOf(proj);
+    const auto n = static_cast<std::size_t>(last - first);
+    if (n <= kRadixSortSmall || !kRadixMovable<T>) {
+        std::stable_sort(first, last, [&](const T& a, const T& b) { return keyOf(a) < keyOf(b); });
+        return;
+    }
+
+    // Every histogram comes from one read of the input
+    std::vector<std::size_t> counts(kPasses * kBuckets, 0);
+    for (std::size_t i = 0; i < n; ++i) {
+        const Key key = keyOf(first[static_cast<std::ptrdiff_t>(i)]);
+        for (std::size_t pass = 0; pass < kPasses; ++pass) {
+            ++counts[pass * kBuckets + Digits::digit(key, pass)];
+        }
+    }
+    const Key sample = keyOf(*first);
+
+    // Elements move back and forth between the input and a scratch buffer.
+    // The buffer is either fully constructed or fully destroyed.
+    SortBuffer<T> buffer(n);
+    T* scratch = buffer.data();
+    bool inScratch = false;
+    for (std::size_t pass = 0; pass < kPasses; ++pass) {
+        std::size_t* offsets = &counts[pass * kBuckets];
+        if (offsets[Digits::digit(sample, pass)] == n) {
+            continue;  // every key has the same digit here
+        }
+        std::size_t offset = 0;
+        for (std::size_t digit = 0; digit < kBuckets; ++digit) {
+            offset += std::exchange(offsets[digit], offset);
+        }
+
+        if (!inScratch) {
+            for (std::size_t i = 0; i < n; ++i) {
+                auto& value = first[static_cast<std::ptrdiff_t>(i)];
+                std::construct_at(scratch + offsets[Digits::digit(keyOf(value), pass)]++,
+                                  std::move(value));
+            }
+            buffer.setLive(true);
+        } else {
+            for (std::size_t i = 0; i < n; ++i) {
+                const auto target = offsets[Digits::digit(keyOf(scratch[i]), pass)]++;
+                first[static_cast<std::ptrdiff_t>(target)] = std::move(scratch[i]);
+            }
+            std::destroy_n(scratch, n);
+            buffer.setLive(false);
+        }
+        inScratch = !inScratch;
+    }
+
+    if (inScratch) {
+        std::move(scratch, scratch + n, first);
+        std::destroy_n(scratch, n);
+        buffer.setLive(false);
+    }
+}
+
+template<typename RandomIt, typename Proj>
+void parallelLsdRadixSort(ThreadPool& pool, RandomIt first, RandomIt last, Proj& proj) {
+    using T = std::iter_value_t<RandomIt>;
+    using Key = decltype(radixKey(std::declval<RadixProjected<RandomIt, Proj>>()));
+    using Digits = RadixDigits<Key>;
+    constexpr std::size_t kPasses = Digits::kPasses;
+    constexpr std::size_t kBuckets = Digits::kBuckets;
+
+    const auto n = static_cast<std::size_t>(last - first);
+    if (n < kParallelSortThreshold || pool.size() < 2 || !kRadixMovable<T>) {
+        lsdRadixSort(first, last, proj);
+        return;
+    }
+
+    auto keyOf = radixKeyOf(proj);
+    const std::size_t blocks = (pool.size() + 1) * 4;
+    const std::size_t blockSize = (n + blocks - 1) / blocks;
+    auto blockRange = [&](std::size_t block) {
+        const std::size_t begin = std::min(n, block * blockSize);
+        return std::pair{begin, std::min(n, begin + blockSize)};
+    };
+
+    // Per-block histograms of every digit. They are only valid for the
+    // first pass that moves elements; later passes recount their digit.
+    std::vector<std::size_t> counts(blocks * kPasses * kBuckets, 0);
+    pool.parallelFor(blocks, [&](std::size_t block) {
+        const auto [begin, end] = blockRange(block);
+        std::size_t* blockCounts = &counts[block * kPasses * kBuckets];
+        for (std::size_t i = begin; i < end; ++i) {
+            const Key key = keyOf(first[static_cast<std::ptrdiff_t>(i)]);
+            for (std::size_t pass = 0; pass < kPasses; ++pass) {
+                ++blockCounts[pass * kBuckets + Digits::digit(key, pass)];
+            }
+        }
+    });
+    const Key sample = keyOf(*first);
+
+    SortBuffer<T> buffer(n);
+    T* scratch = buffer.data();
+    bool inScratch = false;
+    bool moved = false;
+    std::vector<std::size_t> offsets(blocks * kBuckets);
+    for (std::size_t pass = 0; pass < kPasses; ++pass) {
+        const std::size_t sampleDigit = Digits::digit(sample, pass);
+        std::size_t sampleCount = 0;
+        for (std::size_t block = 0; block < blocks; ++block) {
+            sampleCount += counts[(block * kPasses + pass) * kBuckets + sampleDigit];
+        }
+        if (sampleCount == n) {
+            continue;
+        }
+
+        if (moved) {
+            // An earlier pass reordered the elements, so recount this digit
+            pool.parallelFor(blocks, [&](std::size_t block) {
+                const auto [begin, end] = blockRange(block);
+                std::size_t* blockCounts = &counts[(block * kPasses + pass) * kBuckets];
+                std::fill_n(blockCounts, kBuckets, 0);
+                for (std::size_t i = begin; i < end; ++i) {
+                    const Key key = inScratch ? keyOf(scratch[i])
+                                              : keyOf(first[static_cast<std::ptrdiff_t>(i)]);
+                    ++blockCounts[Digits::digit(key, pass)];
+                }
+            });
+        }
+
+        // Digit-major, block-minor prefix sums keep the scatter stable
+        std::size_t offset = 0;
+        for (std::size_t digit = 0; digit < kBuckets; ++digit) {
+            for (std::size_t block = 0; block < blocks; ++block) {
+                offsets[block * kBuckets + digit] = offset;
+                offset += counts[(block * kPasses + pass) * kBuckets + digit];
+            }
+        }
+
+        pool.parallelFor(blocks, [&](std::size_t block) {
+            const auto [begin, end] = blockRange(block);
+            std::size_t* cursor = &offsets[block * kBuckets];
+            if (!inScratch) {
+                for (std::size_t i = begin; i < end; ++i) {
+                    auto& value = first[static_cast<std::ptrdiff_t>(i)];
+                    std::construct_at(scratch + cursor[Digits::digit(keyOf(value), pass)]++,
+                                      std::move(value));
+                }
+            } else {
+                for (std::size_t i = begin; i < end; ++i) {
+                    const auto target = cursor[Digits::digit(keyOf(scratch[i]), pass)]++;
+                    first[static_cast<std::ptrdiff_t>(target)] = std::move(scratch[i]);
+                }
+            }
+        });
+        if (inScratch) {
+            std::destroy_n(scratch, n);
+        }
+        inScratch = !inScratch;
+        moved = true;
+        buffer.setLive(inScratch);
+    }
+
+    if (inScratch) {
+        pool.parallelFor(blocks, [&](std::size_t block) {
+            const auto [begin, end] = blockRange(block);
+            std::move(scratch + begin, scratch + end, first + static_cast<std::ptrdiff_t>(begin));
+        });
+        std::destroy_n(scratch, n);
+        buffer.setLive(false);
+    }
+}
+
+/// Bucket of a string at @p depth: 0 if it ends there, otherwise byte + 1.
+template<typename Proj, typename T>
+std::size_t stringBucket(Proj& proj, const T& value, std::size_t depth) {
+    decltype(auto) key = std::invoke(proj, value);  // keeps a projected temporary alive
+    const std::string_view text(key);
+    return depth < text.size() ? static_cast<unsigned char>(text[depth]) + std::size_t{1} : 0;
+}
+
+/**
+ * Permutes [first, first + n) in place so the elements are grouped by their
+ * bucket at @p depth. Returns the bucket boundaries (kStringBuckets + 1 entries).
+ * @p bucketOf is reusable scratch: each bucket is computed once and moves
+ * along with its element.
+ */
+template<typename RandomIt, typename Proj>
+std::array<std::size_t, kStringBuckets + 1> stringPartition(RandomIt first, std::size_t n,
+                                                            Proj& proj, std::size_t depth,
+                                                            std::vector<std::uint16_t>& bucketOf) {
+    bucketOf.resize(n);
+    std::array<std::size_t, kStringBuckets + 1> bounds{};
+    for (std::size_t i = 0; i < n; ++i) {
+        const std::size_t bucket = stringBucket(proj, first[static_cast<std::ptrdiff_t>(i)], depth);
+        bucketOf[i] = static_cast<std::uint16_t>(bucket);
+        ++bounds[bucket + 1];
+    }
+    for (std::size_t b = 1; b <= kStringBuckets; ++b) {
+        bounds[b] += bounds[b - 1];
+    }
+
+    // American flag sort: swap each element straight into its bucket
+    std::array<std::size_t, kStringBuckets> next{};
+    std::copy_n(bounds.begin(), kStringBuckets, next.begin());
+    for (std::size_t b = 0; b < kStringBuckets; ++b) {
+        while (next[b] < bounds[b + 1]) {
+            const std::size_t at = next[b];
+            const std::size_t bucket = bucketOf[at];
+            if (bucket == b) {
+                ++next[b];
+            } else {
+                const std::size_t target = next[bucket]++;
+                std::iter_swap(first + static_cast<std::ptrdiff_t>(at),
+                               first + static_cast<std::ptrdiff_t>(target));
+                std::swap(bucketOf[at], bucketOf[target]);
+            }
+        }
+    }
+    return bounds;
+}
+
+template<typename RandomIt, typename Proj>
+void msdRadixSort(RandomIt first, RandomIt last, Proj& proj, std::size_t depth = 0) {
+    using T = std::iter_value_t<RandomIt>;
+
+    struct Pending {
+        std::size_t begin;
+        std::size_t end;
+        std::size_t depth;
+    };
+    // An explicit stack: long shared prefixes would otherwise recurse deeply
+    std::vector<Pending> pending{{0, static_cast<std::size_t>(last - first), depth}};
+    std::vector<std::uint16_t> bucketOf;
+    while (!pending.empty()) {
+        const Pending range = pending.back();
+        pending.pop_back();
+        const auto begin = first + static_cast<std::ptrdiff_t>(range.begin);
+        const std::size_t n = range.end - range.begin;
+
+        if (n <= kRadixSortSmall) {
+            // Every string here has at least range.depth bytes
+            std::sort(begin, begin + static_cast<std::ptrdiff_t>(n), [&](const T& a, const T& b) {
+                decltype(auto) keyA = std::invoke(proj, a);
+                decltype(auto) keyB = std::invoke(proj, b);
+                return std::string_view(keyA).substr(range.depth) <
+                       std::string_view(keyB).substr(range.depth);
+            });
+            continue;
+        }
+
+        const auto bounds = stringPartition(begin, n, proj, range.depth, bucketOf);
+        // Bucket 0 holds strings that ended: they are all equal
+        for (std::size_t b = 1; b < kStringBuckets; ++b) {
+            if (bounds[b + 1] - bounds[b] > 1) {
+                pending.push_back(
+                    {range.begin + bounds[b], range.begin + bounds[b + 1], range.depth + 1});
+            }
+        }
+    }
+}
+
+template<typename RandomIt, typename Proj>
+void parallelMsdRadixSort(ThreadPool& pool, RandomIt first, RandomIt last, Proj& proj) {
+    const auto n = static_cast<std::size_t>(last - first);
+    if (n < kParallelSortThreshold || pool.size() < 2) {
+        msdRadixSort(first, last, proj);
+        return;
+    }
+    std::vector<std::uint16_t> bucketOf;
+    const auto bounds = stringPartition(first, n, proj, 0, bucketOf);
+    pool.parallelFor(kStringBuckets - 1, [&](std::size_t index) {
+        const std::size_t b = index + 1;
+        msdRadixSort(first + static_cast<std::ptrdiff_t>(bounds[b]),
+                     first + static_cast<std::ptrdiff_t>(bounds[b + 1]), proj, 1);
+    });
+}
+
+}  // namespace detail
+
+/// Key types sorted by the LSD path: integers (not bool) and float/double.
+template<typename K>
+concept RadixNumericKey = detail::RadixIntegral<K> || detail::RadixFloating<K>;
+
+/// Key types sorted by the MSD path: anything viewable as std::string_view.
+template<typename K>
+concept RadixStringKey = !RadixNumericKey<K> && std::convertible_to<const K&, std::string_view>;
+
+/// Iterators whose projected elements core::radix_sort can order.
+template<typename It, typename Proj>
+concept RadixSortable = std::permutable<It> && (RadixNumericKey<detail::RadixProjected<It, Proj>> ||
+                                                RadixStringKey<detail::RadixProjected<It, Proj>>);
+
+/**
+ * @brief Sorts [first, last) in ascending order of proj(element)
+ *
+ * Numeric keys are sorted stably; string keys are not.
+ *
+ * Example usage:
+ * core::radix_sort(keys.begin(), keys.end());
+ * core::radix_sort(people, &Person::age);
+ * core::radix_sort(names);  // std::vector<std::string>, MSD
+ */
+template<std::random_access_iterator RandomIt, typename Proj = std::identity>
+    requires RadixSortable<RandomIt, Proj>
+void radix_sort(RandomIt first, RandomIt last, Proj proj = {}) {
+    if constexpr (RadixNumericKey<detail::RadixProjected<RandomIt, Proj>>) {
+        detail::lsdRadixSort(first, last, proj);
+    } else {
+        detail::msdRadixSort(first, last, proj);
+    }
+}
+
+/// Sorts a random-access range in ascending order of proj(element).
+template<std::ranges::random_access_range Range, typename Proj = std::identity>
+    requires RadixSortable<std::ranges::iterator_t<Range>, Proj>
+void radix_sort(Range&& range, Proj proj = {}) {
+    core::radix_sort(std::ranges::begin(range), std::ranges::end(range), std::move(proj));
+}
+
+/**
+ * @brief Parallel radix sort of [first, last) using the given pool
+ *
+ * Inputs below kParallelSortThreshold, or pools with one worker, run the
+ * sequential sort. Same ordering and stability as core::radix_sort.
+ *
+ * Example usage:
+ * core::parallel_radix_sort(pool, keys.begin(), keys.end());
+ */
+template<std::random_access_iterator RandomIt, typename Proj = std::identity>
+    requires RadixSortable<RandomIt, Proj>
+void parallel_radix_sort(ThreadPool& pool, RandomIt first, RandomIt last, Proj proj = {}) {
+    if constexpr (RadixNumericKey<detail::RadixProjected<RandomIt, Proj>>) {
+        detail::parallelLsdRadixSort(pool, first, last, proj);
+    } else {
+        detail::parallelMsdRadixSort(pool, first, last, proj);
+    }
+}
+
+/// Parallel radix sort of [first, last) on the shared core pool.
+template<std::random_access_iterator RandomIt, typename Proj = std::identity>
+    requires RadixSortable<RandomIt, Proj>
+void parallel_radix_sort(RandomIt first, RandomIt last, Proj proj = {}) {
+    core::parallel_radix_sort(ThreadPool::getInstance(), first, last, std::move(proj));
+}
+
+/// Parallel radix sort of a random-access range on the shared core pool.
+template<std::ranges::random_access_range Range, typename Proj = std::identity>
+    requires RadixSortable<std::ranges::iterator_t<Range>, Proj>
+void parallel_radix_sort(Range&& range, Proj proj = {}) {
+    core::parallel_radix_sort(ThreadPool::getInstance(), std::ranges::begin(range),
+                              std::ranges::end(range), std::move(proj));
+}
+
+}  // namespace core
@@ -0,0 +1,485 @@
+/**
+ * @file ring_deque.hpp
+ * @brief Double-ended queue in one contiguous power-of-two ring buffer
+ *
+ * core::RingDeque<T> stores its elements in a single heap buffer whose
+ * capacity is a power of two. The front element sits at some head
+ * position and the rest follow it, wrapping around to the start of the
+ * buffer, so element i lives at (head + i) & (capacity - 1): one add and
+ * one mask, no division and no chunk table. Push and pop are O(1) at both
+ * ends. A full buffer doubles and unwraps into the new one, so growth is
+ * amortized O(1) like std::vector.
+ *
+ * std::deque instead keeps fixed-size chunks (512 bytes in libstdc++)
+ * behind a map of chunk pointers. Each element access goes through that
+ * map, and a steady FIFO workload keeps freeing and allocating chunks.
+ * A RingDeque allocates nothing once it is large enough, and its
+ * contents are at most two contiguous runs. segments() exposes them as
+ * spans for memcpy, writev or vectorized loops; linearize() makes them
+ * one span.
+ *
+ * Invalidation differs from std::deque:
+ * - A push that grows the buffer moves the elements, invalidating all
+ *   references and iterators, as do reserve(), shrink_to_fit() and
+ *   linearize() when they reallocate. std::deque keeps references valid
+ *   across pushes.
+ * - push_back/pop_back without growth keep everything else valid.
+ * - push_front/pop_front without growth keep references valid, but
+ *   iterators hold a logical index, so every iterator then refers to a
+ *   different element. Treat them as invalidated.
+ *
+ * @author Modern C++ Starter Template
+ * @date 2025
+ */
+
+#pragma once
+
+#include "core/small_vector.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <compare>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace core {
+
+/**
+ * @brief Contiguous ring-buffer deque with masked indexing
+ *
+ * Example usage:
+ * core::RingDeque<Job> pending;
+ * pending.push_back(job);                     // O(1) at the back...
+ * pending.push_front(urgent);                 // ...and at the front
+ * Job next = std::move(pending.front());
+ * pending.pop_front();
+ * auto [head, tail] = pending.segments();     // the contents as two spans
+ */
+template<typename T>
+class RingDeque {
+    template<bool Const>
+    class Iterator;
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    RingDeque() noexcept = default;
+
+    explicit RingDeque(size_type count) {
+        reserve(count);
+        for (size_type i = 0; i < count; ++i) {
+            emplace_back();
+        }
+    }
+
+    template<std::input_iterator It>
+    RingDeque(It first, It last) {
+        if constexpr (std::forward_iterator<It>) {
+            reserve(static_cast<size_type>(std::distance(first, last)));
+        }
+        for (; first != last; ++first) {
+            emplace_back(*first);
+        }
+    }
+
+    RingDeque(std::initializer_list<T> values) : RingDeque(values.begin(), values.end()) {}
+
+    RingDeque(const RingDeque& other) : RingDeque(other.begin(), other.end()) {}
+
+    RingDeque(RingDeque&& other) noexcept
+        : data_(std::exchange(other.data_, nullptr)),
+          capacity_(std::exchange(other.capacity_, 0)),
+          head_(std::exchange(other.head_, 0)),
+          size_(std::exchange(other.size_, 0)) {}
+
+    RingDeque& operator=(const RingDeque& other) {
+        if (this != &other) {
+            RingDeque copy(other);
+            swap(copy);
+        }
+        return *this;
+    }
+
+    RingDeque& operator=(RingDeque&& other) noexcept {
+        if (this != &other) {
+            RingDeque moved(std::move(other));
+            swap(moved);
+        }
+        return *this;
+    }
+
+    ~RingDeque() {
+        clear();
+        deallocate(data_, capacity_);
+    }
+
+    // Element access
+
+    reference operator[](size_type index) noexcept { return data_[slot(index)]; }
+    const_reference operator[](size_type index) const noexcept { return data_[slot(index)]; }
+
+    reference at(size_type index) {
+        if (index >= size_) {
+            throw std::out_of_range("RingDeque::at index out of range");
+        }
+        return (*this)[index];
+    }
+
+    const_reference at(size_type index) const {
+        if (index >= size_) {
+            throw std::out_of_range("RingDeque::at index out of range");
+        }
+        return (*this)[index];
+    }
+
+    reference front() noexcept { return data_[head_]; }
+    const_reference front() const noexcept { return data_[head_]; }
+    reference back() noexcept { return data_[slot(size_ - 1)]; }
+    const_reference back() const noexcept { return data_[slot(size_ - 1)]; }
+
+    /// The elements in order as two contiguous runs; the second is empty
+    /// unless the contents wrap around the end of the buffer.
+    std::pair<std::span<T>, std::span<T>> segments() noexcept {
+        const size_type first = std::min(size_, capacity_ - head_);
+        return {std::span<T>(data_ + head_, first), std::span<T>(data_, size_ - first)};
+    }
+
+    std::pair<std::span<const T>, std::span<const T>> segments() const noexcept {
+        const size_type first = std::min(size_, capacity_ - head_);
+        return {std::span<const T>(data_ + head_, first),
+                std::span<const T>(data_, size_ - first)};
+    }
+
+    /// Moves the elements into one contiguous run (reallocating if they
+    /// wrap) and returns it.
+    std::span<T> linearize() {
+        if (head_ + size_ > capacity_) {
+            reallocate(capacity_);
+        }
+        return std::span<T>(data_ + head_, size_);
+    }
+
+    // Iterators
+
+    iterator begin() noexcept { return iterator(this, 0); }
+    const_iterator begin() const noexcept { return const_iterator(this, 0); }
+    const_iterator cbegin() const noexcept { return begin(); }
+    iterator end() noexcept { return iterator(this, size_); }
+    const_iterator end() const noexcept { return const_iterator(this, size_); }
+    const_iterator cend() const noexcept { return end(); }
+
+    reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+    reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+    const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+
+    // Capacity
+
+    bool empty() const noexcept { return size_ == 0; }
+    size_type size() const noexcept { return size_; }
+    size_type capacity() const noexcept { return capacity_; }
+
+    /// Rounds @p count up to a power of two; never shrinks.
+    void reserve(size_type count) {
+        if (count > capacity_) {
+            reallocate(roundedCapacity(count));
+        }
+    }
+
+    void shrink_to_fit() {
+        if (size_ == 0) {
+            deallocate(data_, capacity_);
+            data_ = nullptr;
+            capacity_ = 0;
+            head_ = 0;
+        } else if (roundedCapacity(size_) < capacity_) {
+            reallocate(roundedCapacity(size_));
+        }
+    }
+
+    // Modifiers
+
+    template<typename... Args>
+    reference emplace_back(Args&&... args) {
+        if (size_ == capacity_) {
+            return growAndEmplace(false, std::forward<Args>(args)...);
+        }
+        T* at = data_ + slot(size_);
+        std::construct_at(at, std::forward<Args>(args)...);
+        ++size_;
+        return *at;
+    }
+
+    template<typename... Args>
+    reference emplace_front(Args&&... args) {
+        if (size_ == capacity_) {
+            return growAndEmplace(true, std::forward<Args>(args)...);
+        }
+        const size_type newHead = (head_ - 1) & (capacity_ - 1);
+        std::construct_at(data_ + newHead, std::forward<Args>(args)...);
+        head_ = newHead;
+        ++size_;
+        return data_[head_];
+    }
+
+    void push_back(const T& value) { emplace_back(value); }
+    void push_back(T&& value) { emplace_back(std::move(value)); }
+    void push_front(const T& value) { emplace_front(value); }
+    void push_front(T&& value) { emplace_front(std::move(value)); }
+
+    void pop_back() noexcept {
+        --size_;
+        std::destroy_at(data_ + slot(size_));
+    }
+
+    void pop_front() noexcept {
+        std::destroy_at(data_ + head_);
+        head_ = (head_ + 1) & (capacity_ - 1);
+        --size_;
+    }
+
+    /// Destroys the elements; the buffer is kept for reuse.
+    void clear() noexcept {
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            auto [first, second] = segments();
+            std::destroy(first.begin(), first.end());
+            std::destroy(second.begin(), second.end());
+        }
+        head_ = 0;
+        size_ = 0;
+    }
+
+    void swap(RingDeque& other) noexcept {
+        std::swap(data_, other.data_);
+        std::swap(capacity_, other.capacity_);
+        std::swap(head_, other.head_);
+        std::swap(size_, other.size_);
+    }
+
+    friend void swap(RingDeque& a, RingDeque& b) noexcept { a.swap(b); }
+
+    friend bool operator==(const RingDeque& a, const RingDeque& b) {
+        return std::equal(a.begin(), a.end(), b.begin(), b.end());
+    }
+
+    friend auto operator<=>(const RingDeque& a, const RingDeque& b)
+        requires std::three_way_comparable<T>
+    {
+        return std::lexicographical_compare_three_way(a.begin(), a.end(), b.begin(), b.end());
+    }
+
+private:
+    static constexpr bool kOverAligned = alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+    static constexpr size_type kMinCapacity = 8;
+
+    /// Buffer position of logical index @p index.
+    size_type slot(size_type index) const noexcept { return (head_ + index) & (capacity_ - 1); }
+
+    static size_type roundedCapacity(size_type count) {
+        if (count > (size_type{1} << (std::numeric_limits<size_type>::digits - 2)) / sizeof(T)) {
+            throw std::length_error("RingDeque capacity overflow");
+        }
+        return std::bit_ceil(std::max(count, kMinCapacity));
+    }
+
+    static T* allocate(size_type count) {
+        if constexpr (kOverAligned) {
+            return static_cast<T*>(
+                ::operator new(count * sizeof(T), std::align_val_t{alignof(T)}));
+        } else {
+            return static_cast<T*>(::operator new(count * sizeof(T)));
+        }
+    }
+
+    static void deallocate(T* ptr, size_type count) noexcept {
+        if (ptr == nullptr) {
+            return;
+        }
+        if constexpr (kOverAligned) {
+            ::operator delete(ptr, count * sizeof(T), std::align_val_t{alignof(T)});
+        } else {
+            ::operator delete(ptr, count * sizeof(T));
+        }
+    }
+
+    /// Moves the elements, in order, to the start of raw storage at @p to
+    /// and destroys the originals.
+    void relocateTo(T* to) {
+        auto [first, second] = segments();
+        if constexpr (is_trivially_relocatable_v<T>) {
+            if (!first.empty()) {
+                std::memcpy(static_cast<void*>(to), static_cast<const void*>(first.data()),
+                            first.size_bytes());
+            }
+            if (!second.empty()) {
+                std::memcpy(static_cast<void*>(to + first.size()),
+                            static_cast<const void*>(second.data()), second.size_bytes());
+            }
+        } else if constexpr (std::is_nothrow_move_constructible_v<T> ||
+                             !std::is_copy_constructible_v<T>) {
+            std::uninitialized_move(first.begin(), first.end(), to);
+            std::uninitialized_move(second.begin(), second.end(), to + first.size());
+            std::destroy(first.begin(), first.end());
+            std::destroy(second.begin(), second.end());
+        } else {
+            // Copy so that a throwing constructor leaves the source intact
+            std::uninitialized_copy(first.begin(), first.end(), to);
+            try {
+                std::uninitialized_copy(second.begin(), second.end(), to + first.size());
+            } catch (...) {
+                std::destroy_n(to, first.size());
+                throw;
+            }
+            std::destroy(first.begin(), first.end());
+            std::destroy(second.begin(), second.end());
+        }
+    }
+
+    void reallocate(size_type newCapacity) {
+        T* fresh = allocate(newCapacity);
+        try {
+            relocateTo(fresh);
+        } catch (...) {
+            deallocate(fresh, newCapacity);
+            throw;
+        }
+        deallocate(data_, capacity_);
+        data_ = fresh;
+        capacity_ = newCapacity;
+        head_ = 0;
+    }
+
+    template<typename... Args>
+    reference growAndEmplace(bool atFront, Args&&... args) {
+        const size_type newCapacity = roundedCapacity(capacity_ * 2);
+        T* fresh = allocate(newCapacity);
+        // Construct first: args may refer to an element that is about to move.
+        // A new front element goes in the last slot, so the ring starts there
+        T* at = fresh + (atFront ? newCapacity - 1 : size_);
+        try {
+            std::construct_at(at, std::forward<Args>(args)...);
+        } catch (...) {
+            deallocate(fresh, newCapacity);
+            throw;
+        }
+        try {
+            relocateTo(fresh);
+        } catch (...) {
+            std::destroy_at(at);
+            deallocate(fresh, newCapacity);
+            throw;
+        }
+        deallocate(data_, capacity_);
+        data_ = fresh;
+        capacity_ = newCapacity;
+        head_ = atFront ? newCapacity - 1 : 0;
+        ++size_;
+        return *at;
+    }
+
+    T* data_ = nullptr;
+    size_type capacity_ = 0;
+    size_type head_ = 0;
+    size_type size_ = 0;
+};
+
+/// Random-access iterator holding the owner and a logical index. It
+/// survives push_back/pop_back without growth, but push_front/pop_front
+/// shift every index, so it then names a different element.
+template<typename T>
+template<bool Const>
+class RingDeque<T>::Iterator {
+    using Owner = std::conditional_t<Const, const RingDeque, RingDeque>;
+
+public:
+    using iterator_category = std::random_access_iterator_tag;
+    using iterator_concept = std::random_access_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<Const, const T*, T*>;
+    using reference = std::conditional_t<Const, const T&, T&>;
+
+    Iterator() noexcept = default;
+    Iterator(Owner* owner, size_type index) noexcept : owner_(owner), index_(index) {}
+
+    /// iterator converts to const_iterator
+    template<bool OtherConst>
+        requires(Const && !OtherConst)
+    Iterator(const Iterator<OtherConst>& other) noexcept
+        : owner_(other.owner_), index_(other.index_) {}
+
+    reference operator*() const noexcept { return (*owner_)[index_]; }
+    pointer operator->() const noexcept { return &(*owner_)[index_]; }
+    reference operator[](difference_type n) const noexcept {
+        return (*owner_)[index_ + static_cast<size_type>(n)];
+    }
+
+    Iterator& operator++() noexcept {
+        ++index_;
+        return *this;
+    }
+    Iterator operator++(int) noexcept {
+        Iterator old = *this;
+        ++index_;
+        return old;
+    }
+    Iterator& operator--() noexcept {
+        --index_;
+        return *this;
+    }
+    Iterator operator--(int) noexcept {
+        Iterator old = *this;
+        --index_;
+        return old;
+    }
+    Iterator& operator+=(difference_type n) noexcept {
+        index_ += static_cast<size_type>(n);
+        return *this;
+    }
+    Iterator& operator-=(difference_type n) noexcept {
+        index_ -= static_cast<size_type>(n);
+        return *this;
+    }
+
+    friend Iterator operator+(Iterator it, difference_type n) noexcept { return it += n; }
+    friend Iterator operator+(difference_type n, Iterator it) noexcept { return it += n; }
+    friend Iterator operator-(Iterator it, difference_type n) noexcept { return it -= n; }
+    friend difference_type operator-(const Iterator& a, const Iterator& b) noexcept {
+        return static_cast<difference_type>(a.index_) - static_cast<difference_type>(b.index_);
+    }
+
+    friend bool operator==(const Iterator& a, const Iterator& b) noexcept {
+        return a.index_ == b.index_;
+    }
+    friend auto operator<=>(const Iterator& a, const Iterator& b) noexcept {
+        return a.index_ <=> b.index_;
+    }
+
+private:
+    template<bool>
+    friend class Iterator;
+
+    Owner* owner_ = nullptr;
+    size_type index_ = 0;
+};
+
+}  // namespace core
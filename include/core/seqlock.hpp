@@ -0,0 +1,168 @@
+/**
+ * @file seqlock.hpp
+ * @brief Sequence lock for small, read-mostly snapshots
+ *
+ * A writer makes the sequence counter odd, updates the payload and makes it
+ * even again. A reader copies the payload between two reads of the counter
+ * and retries if the counter was odd or moved. Readers never write shared
+ * memory, so any number of them can read without bouncing the cache line
+ * between cores.
+ *
+ * The payload is kept as relaxed atomic 64-bit words rather than as a raw T,
+ * which keeps concurrent copying free of data races under the C++ memory
+ * model while still compiling to plain loads and stores.
+ *
+ * @author Modern C++ Starter Template
+ * @date 2025
+ */
+
+#pragma once
+
+#include "core/cpu_relax.hpp"
+#include "core/stress_point.hpp"
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace core {
+
+/**
+ * @brief Single-value seqlock for trivially copyable T
+ *
+ * Example usage:
+ * core::SeqLock<Rates> rates(Rates{1.0, 2.0});
+ * rates.store(Rates{1.1, 2.1});       // writer
+ * Rates snapshot = rates.load();      // any number of readers, no stores
+ */
+template<typename T>
+class alignas(64) SeqLock {
+    static_assert(std::is_trivially_copyable_v<T>, "SeqLock<T> requires a trivially copyable T");
+
+public:
+    SeqLock()
+        requires std::is_default_constructible_v<T>
+        : SeqLock(T{}) {}
+
+    explicit SeqLock(const T& initial) { writeWords(initial); }
+
+    SeqLock(const SeqLock&) = delete;
+    SeqLock& operator=(const SeqLock&) = delete;
+
+    /// Returns a consistent copy, retrying while a write is in progress.
+    T load() const {
+        Words copy;
+        while (!tryCopy(copy)) {
+            cpuRelax();
+        }
+        return fromWords(copy);
+    }
+
+    /**
+     * @brief Single read attempt
+     * @return false if a writer was active; @p out is then unspecified
+     */
+    bool tryLoad(T& out) const {
+        Words copy;
+        if (!tryCopy(copy)) {
+            return false;
+        }
+        std::memcpy(static_cast<void*>(&out), copy.data(), sizeof(T));
+        return true;
+    }
+
+    /// Publishes a new value. Concurrent writers are serialized.
+    void store(const T& value) {
+        const std::uint64_t sequence = beginWrite();
+        writeWords(value);
+        sequence_.store(sequence + 2, std::memory_order_release);
+    }
+
+    /**
+     * @brief Applies @p mutate to the current value and publishes the result
+     *
+     * If @p mutate throws, the stored value and version are left as they
+     * were and the exception propagates.
+     */
+    template<typename Mutate>
+    void update(Mutate&& mutate) {
+        const std::uint64_t sequence = beginWrite();
+        Words copy;
+        for (std::size_t i = 0; i < kWords; ++i) {
+            copy[i] = words_[i].load(std::memory_order_relaxed);
+        }
+        T value = fromWords(copy);
+        try {
+            mutate(value);
+        } catch (...) {
+            // Nothing was written yet; reopen the lock so readers and writers don't spin
+            sequence_.store(sequence, std::memory_order_release);
+            throw;
+        }
+        writeWords(value);
+        sequence_.store(sequence + 2, std::memory_order_release);
+    }
+
+    /// Number of completed writes.
+    std::uint64_t version() const { return sequence_.load(std::memory_order_acquire) / 2; }
+
+private:
+    static constexpr std::size_t kWords = (sizeof(T) + sizeof(std::uint64_t) - 1) /
+                                          sizeof(std::uint64_t);
+    using Words = std::array<std::uint64_t, kWords>;
+
+    // Copies the payload words; false if a writer was active or finished meanwhile
+    bool tryCopy(Words& copy) const {
+        const std::uint64_t before = sequence_.load(std::memory_order_acquire);
+        if (before & 1) {
+            return false;
+        }
+        for (std::size_t i = 0; i < kWords; ++i) {
+            copy[i] = words_[i].load(std::memory_order_relaxed);
+            CORE_STRESS_POINT("seqlock.read.word");
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return sequence_.load(std::memory_order_relaxed) == before;
+    }
+
+    // Builds T straight from the bytes, so T needs no default constructor
+    static T fromWords(const Words& copy) {
+        std::array<unsigned char, sizeof(T)> bytes;
+        std::memcpy(bytes.data(), copy.data(), sizeof(T));
+        return std::bit_cast<T>(bytes);
+    }
+
+    // Claims the writer slot by moving the counter from even to odd
+    std::uint64_t beginWrite() {
+        std::uint64_t sequence = sequence_.load(std::memory_order_relaxed);
+        for (;;) {
+            if ((sequence & 1) == 0 &&
+                sequence_.compare_exchange_weak(sequence, sequence + 1, std::memory_order_acquire,
+                                                std::memory_order_relaxed)) {
+                // Payload stores must not become visible before the odd counter
+                std::atomic_thread_fence(std::memory_order_release);
+                return sequence;
+            }
+            cpuRelax();
+            sequence = sequence_.load(std::memory_order_relaxed);
+        }
+    }
+
+    void writeWords(const T& value) {
+        Words copy{};
+        std::memcpy(copy.data(), &value, sizeof(T));
+        for (std::size_t i = 0; i < kWords; ++i) {
+            words_[i].store(copy[i], std::memory_order_relaxed);
+            CORE_STRESS_POINT("seqlock.write.word");
+        }
+    }
+
+    std::atomic<std::uint64_t> sequence_{0};
+    std::array<std::atomic<std::uint64_t>, kWords> words_{};
+};
+
+}  // namespace core
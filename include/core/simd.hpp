@@ -0,0 +1,76 @@
+/**
+ * @file simd.hpp
+ * @brief Vectorized search and reduction kernels with runtime CPU dispatch
+ *
+ * core::simd provides the scans the standard algorithms do one element at
+ * a time: find, count, min/max and sum over int32 arrays, float sums, and
+ * memchr-style byte search and count. Each kernel has a scalar, an SSE2,
+ * an AVX2 and an AVX-512 version, all compiled into the library with
+ * per-function target attributes. On the first call CPUID (and XGETBV,
+ * to check that the OS saves the wide registers) selects the widest set
+ * the machine supports. No compiler flags are needed, and one binary
+ * runs on any x86-64 CPU. Other architectures use the scalar versions.
+ *
+ * All levels return the same results, with one exception: sum(float)
+ * adds in several lanes, so its rounding differs slightly from a
+ * sequential loop and from one level to the next.
+ *
+ * setLevel() forces a lower level, for tests and benchmarks that compare
+ * the implementations.
+ *
+ * @author Modern C++ Starter Template
+ * @date 2025
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace core::simd {
+
+/// Instruction sets with their own kernels, in increasing width.
+enum class Level : std::uint8_t { kScalar, kSSE2, kAVX2, kAVX512 };
+
+/// Widest level this CPU and OS support (AVX-512 needs the F and BW subsets).
+Level detectedLevel() noexcept;
+/// Level the kernels currently dispatch to.
+Level activeLevel() noexcept;
+/// Switches all kernels to @p level, clamped to detectedLevel(); returns the level used.
+Level setLevel(Level level) noexcept;
+const char* levelName(Level level) noexcept;
+
+/// Smallest and largest element of a range.
+struct MinMax {
+    std::int32_t min;
+    std::int32_t max;
+};
+
+/**
+ * @brief Kernels over contiguous arrays
+ *
+ * Example usage:
+ * std::vector<std::int32_t> ids = ...;
+ * std::size_t at = core::simd::find(ids, 42);         // ids.size() if absent
+ * std::size_t hits = core::simd::count(ids, 7);
+ * auto [lo, hi] = core::simd::minMax(ids);
+ * std::int64_t total = core::simd::sum(ids);          // no int32 overflow
+ * const void* nl = core::simd::findByte(text.data(), text.size(), '\n');
+ */
+
+/// Index of the first element equal to @p value, or values.size().
+std::size_t find(std::span<const std::int32_t> values, std::int32_t value) noexcept;
+std::size_t count(std::span<const std::int32_t> values, std::int32_t value) noexcept;
+/// @throws std::invalid_argument if @p values is empty
+MinMax minMax(std::span<const std::int32_t> values);
+/// Sum in 64 bits, so it cannot overflow for fewer than 2^32 elements.
+std::int64_t sum(std::span<const std::int32_t> values) noexcept;
+/// Sum accumulated in float lanes; see the file comment about rounding.
+float sum(std::span<const float> values) noexcept;
+
+/// Like std::memchr: first byte equal to @p byte, or nullptr.
+const void* findByte(const void* data, std::size_t size, std::uint8_t byte) noexcept;
+std::size_t countByte(const void* data, std::size_t size, std::uint8_t byte) noexcept;
+
+}  // namespace core::simd
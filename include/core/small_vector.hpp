@@ -0,0 +1,452 @@
+/**
+ * @file small_vector.hpp
+ * @brief Vector with inline storage for the first N elements
+ *
+ * core::SmallVector<T, N> keeps up to N elements inside the object itself
+ * and only moves to the heap when it grows past that. Short lists, which
+ * make up most lists in practice, never touch the allocator.
+ *
+ * Types for which core::is_trivially_relocatable is true are moved between
+ * buffers with memcpy instead of a move-construct/destroy loop. The trait
+ * defaults to std::is_trivially_copyable and may be specialized for types
+ * such as std::unique_ptr whose moves are bitwise in practice.
+ *
+ * @author Modern C++ Starter Template
+ * @date 2025
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <compare>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace core {
+
+/// Customization point: true if moving a T is equivalent to copying its bytes.
+template<typename T>
+struct is_trivially_relocatable : std::is_trivially_copyable<T> {};
+
+template<typename T>
+inline constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+
+/**
+ * @brief std::vector-compatible container with N inline slots
+ *
+ * Example usage:
+ * core::SmallVector<int, 8> ids{1, 2, 3};  // no heap allocation
+ * ids.push_back(4);
+ * bool onStack = ids.isInline();           // true until size() exceeds 8
+ *
+ * Unlike std::vector, moving a SmallVector whose elements are inline moves
+ * the elements one by one, so iterators into the source are invalidated.
+ */
+template<typename T, std::size_t N>
+class SmallVector {
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using iterator = T*;
+    using const_iterator = const T*;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    static constexpr size_type kInlineCapacity = N;
+
+    SmallVector() noexcept = default;
+
+    explicit SmallVector(size_type count) { resize(count); }
+
+    SmallVector(size_type count, const T& value) { assign(count, value); }
+
+    template<std::input_iterator It>
+    SmallVector(It first, It last) {
+        append(first, last);
+    }
+
+    SmallVector(std::initializer_list<T> values) { append(values.begin(), values.end()); }
+
+    SmallVector(const SmallVector& other) { append(other.begin(), other.end()); }
+
+    SmallVector(SmallVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+        takeFrom(std::move(other));
+    }
+
+    SmallVector& operator=(const SmallVector& other) {
+        if (this != &other) {
+            assign(other.begin(), other.end());
+        }
+        return *this;
+    }
+
+    SmallVector& operator=(SmallVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+        if (this != &other) {
+            clear();
+            releaseHeap();
+            takeFrom(std::move(other));
+        }
+        return *this;
+    }
+
+    SmallVector& operator=(std::initializer_list<T> values) {
+        assign(values.begin(), values.end());
+        return *this;
+    }
+
+    ~SmallVector() {
+        std::destroy_n(data_, size_);
+        releaseHeap();
+    }
+
+    void assign(size_type count, const T& value) {
+        // value may refer into *this
+        T copy(value);
+        clear();
+        reserve(count);
+        std::uninitialized_fill_n(data_, count, copy);
+        size_ = count;
+    }
+
+    template<std::input_iterator It>
+    void assign(It first, It last) {
+        clear();
+        append(first, last);
+    }
+
+    void assign(std::initializer_list<T> values) { assign(values.begin(), values.end()); }
+
+    // Element access
+
+    reference at(size_type index) {
+        if (index >= size_) {
+            throw std::out_of_range("SmallVector::at index out of range");
+        }
+        return data_[index];
+    }
+
+    const_reference at(size_type index) const {
+        if (index >= size_) {
+            throw std::out_of_range("SmallVector::at index out of range");
+        }
+        return data_[index];
+    }
+
+    reference operator[](size_type index) { return data_[index]; }
+    const_reference operator[](size_type index) const { return data_[index]; }
+
+    reference front() { return data_[0]; }
+    const_reference front() const { return data_[0]; }
+    reference back() { return data_[size_ - 1]; }
+    const_reference back() const { return data_[size_ - 1]; }
+
+    T* data() noexcept { return data_; }
+    const T* data() const noexcept { return data_; }
+
+    // Iterators
+
+    iterator begin() noexcept { return data_; }
+    const_iterator begin() const noexcept { return data_; }
+    const_iterator cbegin() const noexcept { return data_; }
+    iterator end() noexcept { return data_ + size_; }
+    const_iterator end() const noexcept { return data_ + size_; }
+    const_iterator cend() const noexcept { return data_ + size_; }
+
+    reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+    reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+    const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+
+    // Capacity
+
+    bool empty() const noexcept { return size_ == 0; }
+    size_type size() const noexcept { return size_; }
+    size_type capacity() const noexcept { return capacity_; }
+
+    size_type max_size() const noexcept {
+        return std::numeric_limits<difference_type>::max() / sizeof(T);
+    }
+
+    /// True while the elements live in the inline buffer.
+    bool isInline() const noexcept { return data_ == inlineData(); }
+
+    void reserve(size_type newCapacity) {
+        if (newCapacity > capacity_) {
+            reallocate(newCapacity);
+        }
+    }
+
+    /// Moves back into the inline buffer when the elements fit.
+    void shrink_to_fit() {
+        if (isInline() || size_ == capacity_) {
+            return;
+        }
+        if (size_ <= N) {
+            T* heap = data_;
+            const size_type heapCapacity = capacity_;
+            relocate(heap, inlineData(), size_);
+            data_ = inlineData();
+            capacity_ = N;
+            deallocate(heap, heapCapacity);
+        } else {
+            reallocate(size_);
+        }
+    }
+
+    // Modifiers
+
+    void clear() noexcept {
+        std::destroy_n(data_, size_);
+        size_ = 0;
+    }
+
+    void push_back(const T& value) { emplace_back(value); }
+    void push_back(T&& value) { emplace_back(std::move(value)); }
+
+    template<typename... Args>
+    reference emplace_back(Args&&... args) {
+        if (size_ == capacity_) {
+            return growAndEmplaceBack(std::forward<Args>(args)...);
+        }
+        T* slot = std::construct_at(data_ + size_, std::forward<Args>(args)...);
+        ++size_;
+        return *slot;
+    }
+
+    void pop_back() {
+        --size_;
+        std::destroy_at(data_ + size_);
+    }
+
+    template<typename... Args>
+    iterator emplace(const_iterator position, Args&&... args) {
+        const auto index = static_cast<size_type>(position - data_);
+        emplace_back(std::forward<Args>(args)...);
+        std::rotate(data_ + index, data_ + size_ - 1, data_ + size_);
+        return data_ + index;
+    }
+
+    iterator insert(const_iterator position, const T& value) { return emplace(position, value); }
+
+    iterator insert(const_iterator position, T&& value) {
+        return emplace(position, std::move(value));
+    }
+
+    iterator insert(const_iterator position, size_type count, const T& value) {
+        const auto index = static_cast<size_type>(position - data_);
+        T copy(value);
+        reserve(size_ + count);
+        std::uninitialized_fill_n(data_ + size_, count, copy);
+        size_ += count;
+        std::rotate(data_ + index, data_ + size_ - count, data_ + size_);
+        return data_ + index;
+    }
+
+    template<std::input_iterator It>
+    iterator insert(const_iterator position, It first, It last) {
+        const auto index = static_cast<size_type>(position - data_);
+        const size_type oldSize = size_;
+        append(first, last);
+        std::rotate(data_ + index, data_ + oldSize, data_ + size_);
+        return data_ + index;
+    }
+
+    iterator insert(const_iterator position, std::initializer_list<T> values) {
+        return insert(position, values.begin(), values.end());
+    }
+
+    iterator erase(const_iterator position) { return erase(position, position + 1); }
+
+    iterator erase(const_iterator first, const_iterator last) {
+        T* from = data_ + (first - data_);
+        T* to = data_ + (last - data_);
+        if (from != to) {
+            T* newEnd = std::move(to, end(), from);
+            std::destroy(newEnd, end());
+            size_ = static_cast<size_type>(newEnd - data_);
+        }
+        return from;
+    }
+
+    void resize(size_type count) {
+        if (count < size_) {
+            std::destroy(data_ + count, end());
+        } else {
+            reserve(count);
+            std::uninitialized_value_construct(data_ + size_, data_ + count);
+        }
+        size_ = count;
+    }
+
+    void resize(size_type count, const T& value) {
+        if (count <= size_) {
+            resize(count);
+        } else {
+            insert(end(), count - size_, value);
+        }
+    }
+
+    void swap(SmallVector& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+        SmallVector temp(std::move(other));
+        other = std::move(*this);
+        *this = std::move(temp);
+    }
+
+    friend void swap(SmallVector& a, SmallVector& b) noexcept(noexcept(a.swap(b))) { a.swap(b); }
+
+    friend bool operator==(const SmallVector& a, const SmallVector& b) {
+        return std::equal(a.begin(), a.end(), b.begin(), b.end());
+    }
+
+    friend auto operator<=>(const SmallVector& a, const SmallVector& b)
+        requires std::three_way_comparable<T>
+    {
+        return std::lexicographical_compare_three_way(a.begin(), a.end(), b.begin(), b.end());
+    }
+
+private:
+    static constexpr bool kOverAligned = alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+
+    T* inlineData() noexcept { return reinterpret_cast<T*>(inline_); }
+    const T* inlineData() const noexcept { return reinterpret_cast<const T*>(inline_); }
+
+    static T* allocate(size_type count) {
+        if (count > std::numeric_limits<difference_type>::max() / sizeof(T)) {
+            throw std::length_error("SmallVector capacity overflow");
+        }
+        if constexpr (kOverAligned) {
+            return static_cast<T*>(
+                ::operator new(count * sizeof(T), std::align_val_t{alignof(T)}));
+        } else {
+            return static_cast<T*>(::operator new(count * sizeof(T)));
+        }
+    }
+
+    static void deallocate(T* ptr, size_type count) noexcept {
+        if constexpr (kOverAligned) {
+            ::operator delete(ptr, count * sizeof(T), std::align_val_t{alignof(T)});
+        } else {
+            ::operator delete(ptr, count * sizeof(T));
+        }
+    }
+
+    void releaseHeap() noexcept {
+        if (!isInline()) {
+            deallocate(data_, capacity_);
+            data_ = inlineData();
+            capacity_ = N;
+        }
+    }
+
+    /// Moves @p count elements into raw storage at @p to and destroys the originals.
+    static void relocate(T* from, T* to, size_type count) {
+        if constexpr (is_trivially_relocatable_v<T>) {
+            if (count != 0) {
+                std::memcpy(static_cast<void*>(to), static_cast<const void*>(from),
+                            count * sizeof(T));
+            }
+        } else if constexpr (std::is_nothrow_move_constructible_v<T> ||
+                             !std::is_copy_constructible_v<T>) {
+            std::uninitialized_move_n(from, count, to);
+            std::destroy_n(from, count);
+        } else {
+            // Copy so that a throwing constructor leaves the source intact
+            std::uninitialized_copy_n(from, count, to);
+            std::destroy_n(from, count);
+        }
+    }
+
+    size_type grownCapacity(size_type minimum) const {
+        return std::max(minimum, capacity_ + capacity_ / 2 + 1);
+    }
+
+    void reallocate(size_type newCapacity) {
+        T* fresh = allocate(newCapacity);
+        try {
+            relocate(data_, fresh, size_);
+        } catch (...) {
+            deallocate(fresh, newCapacity);
+            throw;
+        }
+        releaseHeap();
+        data_ = fresh;
+        capacity_ = newCapacity;
+    }
+
+    template<typename... Args>
+    reference growAndEmplaceBack(Args&&... args) {
+        const size_type newCapacity = grownCapacity(size_ + 1);
+        T* fresh = allocate(newCapacity);
+        // Construct first: args may refer to an element that is about to move
+        try {
+            std::construct_at(fresh + size_, std::forward<Args>(args)...);
+        } catch (...) {
+            deallocate(fresh, newCapacity);
+            throw;
+        }
+        try {
+            relocate(data_, fresh, size_);
+        } catch (...) {
+            std::destroy_at(fresh + size_);
+            deallocate(fresh, newCapacity);
+            throw;
+        }
+        releaseHeap();
+        data_ = fresh;
+        capacity_ = newCapacity;
+        return data_[size_++];
+    }
+
+    template<typename It>
+    void append(It first, It last) {
+        if constexpr (std::forward_iterator<It>) {
+            const auto count = static_cast<size_type>(std::distance(first, last));
+            if (size_ + count > capacity_) {
+                reallocate(grownCapacity(size_ + count));
+            }
+            std::uninitialized_copy(first, last, data_ + size_);
+            size_ += count;
+        } else {
+            for (; first != last; ++first) {
+                emplace_back(*first);
+            }
+        }
+    }
+
+    void takeFrom(SmallVector&& other) {
+        if (other.isInline()) {
+            if constexpr (is_trivially_relocatable_v<T>) {
+                relocate(other.data_, data_, other.size_);
+                size_ = std::exchange(other.size_, 0);
+            } else {
+                std::uninitialized_move_n(other.data_, other.size_, data_);
+                size_ = other.size_;
+                other.clear();
+            }
+        } else {
+            data_ = std::exchange(other.data_, other.inlineData());
+            size_ = std::exchange(other.size_, 0);
+            capacity_ = std::exchange(other.capacity_, N);
+        }
+    }
+
+    T* data_ = inlineData();
+    size_type size_ = 0;
+    size_type capacity_ = N;
+    alignas(T) unsigned char inline_[N == 0 ? 1 : N * sizeof(T)];
+};
+
+}  // namespace core
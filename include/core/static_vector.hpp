@@ -0,0 +1,487 @@
+/**
+ * @file static_vector.hpp
+ * @brief Fixed-capacity vector and string that never allocate
+ *
+ * core::StaticVector<T, N> holds between 0 and N elements in place; unlike a
+ * plain T[N], the unused slots are raw storage, so T need not be default
+ * constructible. core::StaticString<N> is the same idea for text of up to N
+ * characters, always NUL-terminated.
+ *
+ * Both are usable in constant expressions. Exceeding the capacity throws
+ * std::length_error, which is a compile error in a constant expression.
+ *
+ * @author Modern C++ Starter Template
+ * @date 2025
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <compare>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <ostream>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace core {
+
+/**
+ * @brief Vector with inline capacity N and no heap fallback
+ *
+ * Example usage:
+ * constexpr core::StaticVector<int, 4> primes{2, 3, 5};
+ * static_assert(primes.size() == 3 && primes.back() == 5);
+ *
+ * core::StaticVector<std::reference_wrapper<Widget>, 8> selected;  // no default ctor needed
+ * if (!selected.tryPushBack(widget)) { ... }                        // full
+ */
+template<typename T, std::size_t N>
+class StaticVector {
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using iterator = T*;
+    using const_iterator = const T*;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    constexpr StaticVector() noexcept {
+        if constexpr (std::is_trivially_default_constructible_v<T>) {
+            // A constant expression may not leave the array partly uninitialized
+            if (std::is_constant_evaluated()) {
+                for (std::size_t i = 0; i < N; ++i) {
+                    std::construct_at(items_ + i);
+                }
+            }
+        }
+    }
+
+    constexpr explicit StaticVector(size_type count) : StaticVector() { resize(count); }
+
+    constexpr StaticVector(size_type count, const T& value) : StaticVector() {
+        insert(end(), count, value);
+    }
+
+    template<std::input_iterator It>
+    constexpr StaticVector(It first, It last) : StaticVector() {
+        insert(end(), first, last);
+    }
+
+    constexpr StaticVector(std::initializer_list<T> values)
+        : StaticVector(values.begin(), values.end()) {}
+
+    constexpr StaticVector(const StaticVector& other)
+        requires std::is_trivially_copy_constructible_v<T>
+    = default;
+
+    constexpr StaticVector(const StaticVector& other) : StaticVector() {
+        insert(end(), other.begin(), other.end());
+    }
+
+    constexpr StaticVector(StaticVector&& other)
+        requires std::is_trivially_move_constructible_v<T>
+    = default;
+
+    constexpr StaticVector(StaticVector&& other) noexcept(
+        std::is_nothrow_move_constructible_v<T>)
+        : StaticVector() {
+        insert(end(), std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+    }
+
+    constexpr StaticVector& operator=(const StaticVector& other)
+        requires std::is_trivially_copy_assignable_v<T> && std::is_trivially_destructible_v<T>
+    = default;
+
+    constexpr StaticVector& operator=(const StaticVector& other) {
+        if (this != &other) {
+            assign(other.begin(), other.end());
+        }
+        return *this;
+    }
+
+    constexpr StaticVector& operator=(StaticVector&& other)
+        requires std::is_trivially_move_assignable_v<T> && std::is_trivially_destructible_v<T>
+    = default;
+
+    constexpr StaticVector& operator=(StaticVector&& other) noexcept(
+        std::is_nothrow_move_constructible_v<T>) {
+        if (this != &other) {
+            assign(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+        }
+        return *this;
+    }
+
+    constexpr ~StaticVector()
+        requires std::is_trivially_destructible_v<T>
+    = default;
+
+    constexpr ~StaticVector() { std::destroy_n(items_, size_); }
+
+    template<std::input_iterator It>
+    constexpr void assign(It first, It last) {
+        clear();
+        insert(end(), first, last);
+    }
+
+    constexpr void assign(std::initializer_list<T> values) { assign(values.begin(), values.end()); }
+
+    // Element access
+
+    constexpr reference at(size_type index) {
+        if (index >= size_) {
+            throw std::out_of_range("StaticVector::at index out of range");
+        }
+        return items_[index];
+    }
+
+    constexpr const_reference at(size_type index) const {
+        if (index >= size_) {
+            throw std::out_of_range("StaticVector::at index out of range");
+        }
+        return items_[index];
+    }
+
+    constexpr reference operator[](size_type index) { return items_[index]; }
+    constexpr const_reference operator[](size_type index) const { return items_[index]; }
+
+    constexpr reference front() { return items_[0]; }
+    constexpr const_reference front() const { return items_[0]; }
+    constexpr reference back() { return items_[size_ - 1]; }
+    constexpr const_reference back() const { return items_[size_ - 1]; }
+
+    constexpr T* data() noexcept { return items_; }
+    constexpr const T* data() const noexcept { return items_; }
+
+    // Iterators
+
+    constexpr iterator begin() noexcept { return items_; }
+    constexpr const_iterator begin() const noexcept { return items_; }
+    constexpr const_iterator cbegin() const noexcept { return items_; }
+    constexpr iterator end() noexcept { return items_ + size_; }
+    constexpr const_iterator end() const noexcept { return items_ + size_; }
+    constexpr const_iterator cend() const noexcept { return items_ + size_; }
+
+    constexpr reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+    constexpr const_reverse_iterator rbegin() const noexcept {
+        return const_reverse_iterator(end());
+    }
+    constexpr reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+    constexpr const_reverse_iterator rend() const noexcept {
+        return const_reverse_iterator(begin());
+    }
+
+    // Capacity
+
+    constexpr bool empty() const noexcept { return size_ == 0; }
+    constexpr bool full() const noexcept { return size_ == N; }
+    constexpr size_type size() const noexcept { return size_; }
+    static constexpr size_type capacity() noexcept { return N; }
+    static constexpr size_type max_size() noexcept { return N; }
+
+    // Modifiers
+
+    constexpr void clear() noexcept {
+        std::destroy_n(items_, size_);
+        size_ = 0;
+    }
+
+    constexpr void push_back(const T& value) { emplace_back(value); }
+    constexpr void push_back(T&& value) { emplace_back(std::move(value)); }
+
+    template<typename... Args>
+    constexpr reference emplace_back(Args&&... args) {
+        if (full()) {
+            throw std::length_error("StaticVector capacity exceeded");
+        }
+        return unsafeEmplaceBack(std::forward<Args>(args)...);
+    }
+
+    /// Appends unless full; returns the new element or nullptr.
+    template<typename... Args>
+    constexpr T* tryEmplaceBack(Args&&... args) {
+        if (full()) {
+            return nullptr;
+        }
+        return &unsafeEmplaceBack(std::forward<Args>(args)...);
+    }
+
+    constexpr T* tryPushBack(const T& value) { return tryEmplaceBack(value); }
+    constexpr T* tryPushBack(T&& value) { return tryEmplaceBack(std::move(value)); }
+
+    constexpr void pop_back() {
+        --size_;
+        std::destroy_at(items_ + size_);
+    }
+
+    template<typename... Args>
+    constexpr iterator emplace(const_iterator position, Args&&... args) {
+        const auto index = position - cbegin();
+        emplace_back(std::forward<Args>(args)...);
+        std::rotate(begin() + index, end() - 1, end());
+        return begin() + index;
+    }
+
+    constexpr iterator insert(const_iterator position, const T& value) {
+        return emplace(position, value);
+    }
+
+    constexpr iterator insert(const_iterator position, T&& value) {
+        return emplace(position, std::move(value));
+    }
+
+    constexpr iterator insert(const_iterator position, size_type count, const T& value) {
+        const auto index = position - cbegin();
+        if (count > N - size_) {
+            throw std::length_error("StaticVector capacity exceeded");
+        }
+        const auto oldEnd = end();
+        for (size_type i = 0; i < count; ++i) {
+            unsafeEmplaceBack(value);
+        }
+        std::rotate(begin() + index, oldEnd, end());
+        return begin() + index;
+    }
+
+    /// On overflow, throws std::length_error and leaves the vector unchanged.
+    template<std::input_iterator It>
+    constexpr iterator insert(const_iterator position, It first, It last) {
+        const auto index = position - cbegin();
+        const size_type oldSize = size_;
+        if constexpr (std::forward_iterator<It>) {
+            if (static_cast<size_type>(std::distance(first, last)) > N - size_) {
+                throw std::length_error("StaticVector capacity exceeded");
+            }
+        }
+        try {
+            for (; first != last; ++first) {
+                emplace_back(*first);
+            }
+        } catch (...) {
+            // Input ranges overflow mid-way and copies may throw; undo the appends
+            while (size_ > oldSize) {
+                pop_back();
+            }
+            throw;
+        }
+        std::rotate(begin() + index, begin() + oldSize, end());
+        return begin() + index;
+    }
+
+    constexpr iterator insert(const_iterator position, std::initializer_list<T> values) {
+        return insert(position, values.begin(), values.end());
+    }
+
+    constexpr iterator erase(const_iterator position) { return erase(position, position + 1); }
+
+    constexpr iterator erase(const_iterator first, const_iterator last) {
+        const auto from = begin() + (first - cbegin());
+        const auto to = begin() + (last - cbegin());
+        if (from != to) {
+            const auto newEnd = std::move(to, end(), from);
+            std::destroy(newEnd, end());
+            size_ = static_cast<size_type>(newEnd - begin());
+        }
+        return from;
+    }
+
+    constexpr void resize(size_type count) {
+        if (count > N) {
+            throw std::length_error("StaticVector capacity exceeded");
+        }
+        while (size_ > count) {
+            pop_back();
+        }
+        while (size_ < count) {
+            unsafeEmplaceBack();
+        }
+    }
+
+    constexpr void resize(size_type count, const T& value) {
+        if (count <= size_) {
+            resize(count);
+        } else {
+            insert(end(), count - size_, value);
+        }
+    }
+
+    constexpr void swap(StaticVector& other) noexcept(std::is_nothrow_swappable_v<T> &&
+                                                      std::is_nothrow_move_constructible_v<T>) {
+        StaticVector& shorter = size_ < other.size_ ? *this : other;
+        StaticVector& longer = size_ < other.size_ ? other : *this;
+        std::swap_ranges(shorter.begin(), shorter.end(), longer.begin());
+        const auto common = static_cast<difference_type>(shorter.size_);
+        shorter.insert(shorter.end(), std::make_move_iterator(longer.begin() + common),
+                       std::make_move_iterator(longer.end()));
+        longer.erase(longer.begin() + common, longer.end());
+    }
+
+    friend constexpr void swap(StaticVector& a, StaticVector& b) noexcept(noexcept(a.swap(b))) {
+        a.swap(b);
+    }
+
+    friend constexpr bool operator==(const StaticVector& a, const StaticVector& b) {
+        return std::equal(a.begin(), a.end(), b.begin(), b.end());
+    }
+
+    friend constexpr auto operator<=>(const StaticVector& a, const StaticVector& b)
+        requires std::three_way_comparable<T>
+    {
+        return std::lexicographical_compare_three_way(a.begin(), a.end(), b.begin(), b.end());
+    }
+
+private:
+    template<typename... Args>
+    constexpr reference unsafeEmplaceBack(Args&&... args) {
+        T* slot = std::construct_at(items_ + size_, std::forward<Args>(args)...);
+        ++size_;
+        return *slot;
+    }
+
+    // Union so that unused slots are never constructed
+    union {
+        T items_[N];
+    };
+    size_type size_ = 0;
+};
+
+/**
+ * @brief NUL-terminated string of at most N characters stored in place
+ *
+ * Example usage:
+ * constexpr core::StaticString<16> key("server.port");
+ * core::StaticString<64> line = key;
+ * line += '=';
+ * line += "8080";
+ * std::string_view view = line;  // "server.port=8080"
+ */
+template<std::size_t N>
+class StaticString {
+public:
+    using value_type = char;
+    using size_type = std::size_t;
+    using iterator = char*;
+    using const_iterator = const char*;
+
+    static constexpr size_type npos = std::string_view::npos;
+
+    constexpr StaticString() noexcept = default;
+
+    constexpr StaticString(std::string_view text) { append(text); }
+
+    constexpr StaticString(const char* text) : StaticString(std::string_view(text)) {}
+
+    template<std::size_t M>
+    constexpr StaticString(const StaticString<M>& other) : StaticString(other.view()) {}
+
+    constexpr StaticString& operator=(std::string_view text) {
+        clear();
+        return append(text);
+    }
+
+    // Access
+
+    constexpr char& operator[](size_type index) { return chars_[index]; }
+    constexpr const char& operator[](size_type index) const { return chars_[index]; }
+    constexpr const char* c_str() const noexcept { return chars_; }
+    constexpr const char* data() const noexcept { return chars_; }
+    constexpr std::string_view view() const noexcept { return {chars_, size_}; }
+    constexpr operator std::string_view() const noexcept { return view(); }
+
+    constexpr iterator begin() noexcept { return chars_; }
+    constexpr const_iterator begin() const noexcept { return chars_; }
+    constexpr iterator end() noexcept { return chars_ + size_; }
+    constexpr const_iterator end() const noexcept { return chars_ + size_; }
+
+    constexpr bool empty() const noexcept { return size_ == 0; }
+    constexpr size_type size() const noexcept { return size_; }
+    constexpr size_type length() const noexcept { return size_; }
+    static constexpr size_type capacity() noexcept { return N; }
+
+    // Modifiers
+
+    constexpr void clear() noexcept {
+        size_ = 0;
+        chars_[0] = '\0';
+    }
+
+    constexpr StaticString& append(std::string_view text) {
+        // Checked as two bounds so the optimizer sees size_ + text.size() <= N
+        if (text.size() > N || size_ > N - text.size()) {
+            throw std::length_error("StaticString capacity exceeded");
+        }
+        std::copy(text.begin(), text.end(), chars_ + size_);
+        size_ += text.size();
+        chars_[size_] = '\0';
+        return *this;
+    }
+
+    constexpr void push_back(char c) { append(std::string_view(&c, 1)); }
+
+    constexpr void pop_back() { chars_[--size_] = '\0'; }
+
+    /// Shortens to @p count characters (no-op if already shorter).
+    constexpr void truncate(size_type count) {
+        if (count < size_) {
+            size_ = count;
+            chars_[size_] = '\0';
+        }
+    }
+
+    constexpr StaticString& operator+=(std::string_view text) { return append(text); }
+    constexpr StaticString& operator+=(char c) {
+        push_back(c);
+        return *this;
+    }
+
+    constexpr size_type find(std::string_view needle, size_type from = 0) const noexcept {
+        return view().find(needle, from);
+    }
+
+    constexpr bool starts_with(std::string_view prefix) const noexcept {
+        return view().starts_with(prefix);
+    }
+
+    constexpr bool ends_with(std::string_view suffix) const noexcept {
+        return view().ends_with(suffix);
+    }
+
+    friend constexpr bool operator==(const StaticString& a, std::string_view b) noexcept {
+        return a.view() == b;
+    }
+
+    friend constexpr auto operator<=>(const StaticString& a, std::string_view b) noexcept {
+        return a.view() <=> b;
+    }
+
+    friend std::ostream& operator<<(std::ostream& out, const StaticString& text) {
+        return out << text.view();
+    }
+
+private:
+    char chars_[N + 1] = {};
+    size_type size_ = 0;
+};
+
+}  // namespace core
+
+namespace std {
+
+template<std::size_t N>
+struct hash<core::StaticString<N>> {
+    std::size_t operator()(const core::StaticString<N>& text) const noexcept {
+        return std::hash<std::string_view>{}(text.view());
+    }
+};
+
+}  // namespace std
@@ -0,0 +1,42 @@
+/**
+ * @file stress_point.hpp
+ * @brief Schedule-perturbation hooks for concurrency stress testing
+ *
+ * CORE_STRESS_POINT(site) marks a spot in concurrent code where a different
+ * thread interleaving matters, e.g. between a CAS and the store that
+ * publishes its result. In normal builds the macro expands to nothing. The
+ * stress test executable defines CORE_STRESS_TESTING for every translation
+ * unit and installs a hook that randomly yields or sleeps at these sites
+ * (see tests/stress_harness.hpp).
+ *
+ * @author Modern C++ Starter Template
+ * @date 2025
+ */
+
+#pragma once
+
+#if defined(CORE_STRESS_TESTING)
+
+#include <atomic>
+
+namespace core::stress {
+
+using PointHook = void (*)(const char* site);
+
+inline std::atomic<PointHook> pointHook{nullptr};
+
+inline void point(const char* site) {
+    if (auto hook = pointHook.load(std::memory_order_acquire)) {
+        hook(site);
+    }
+}
+
+}  // namespace core::stress
+
+#define CORE_STRESS_POINT(site) ::core::stress::point(site)
+
+#else
+
+#define CORE_STRESS_POINT(site) static_cast<void>(0)
+
+#endif
@@ -0,0 +1,663 @@
+/**
+ * @file swiss_map.hpp
+ * @brief Open-addressing hash map probed 16 control bytes at a time
+ *
+ * core::SwissMap<K, V> follows the "Swiss table" layout. Every slot has a
+ * one-byte control entry: empty, deleted, or the low 7 bits of the key's
+ * hash (H2). A lookup loads 16 control bytes at once and compares all of
+ * them with H2 in one SSE2 instruction, so it only touches slots whose
+ * H2 matches. The remaining hash bits (H1) choose where probing starts.
+ * Targets without SSE2 use a portable byte loop with the same results.
+ * Groups stay 16 wide under AVX2 as well: one SSE2 compare already covers
+ * a group, and a 32-wide group would make probe windows longer.
+ *
+ * Erase leaves no tombstone when no probe sequence can ever have passed
+ * the slot: that holds if every 16-byte window covering the slot still
+ * contains an empty byte. Only slots inside a full run become "deleted".
+ *
+ * Pointers and iterators to elements are invalidated by rehashing, as with
+ * std::unordered_map, and also by any insertion that triggers growth.
+ *
+ * @author Modern C++ Starter Template
+ * @date 2025
+ */
+
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+// Define CORE_SWISS_PORTABLE to force the scalar group code (e.g. to test it)
+#if !defined(CORE_SWISS_PORTABLE) && \
+    (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define CORE_SWISS_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace core {
+
+/**
+ * @brief Default SwissMap hasher
+ *
+ * std::hash<K>, except that std::string keys hash as string_view and the
+ * hasher is transparent, so string-like keys can be looked up without
+ * building a std::string.
+ */
+template<typename K>
+struct SwissHash : std::hash<K> {};
+
+template<>
+struct SwissHash<std::string> {
+    using is_transparent = void;
+    std::size_t operator()(std::string_view text) const noexcept {
+        return std::hash<std::string_view>{}(text);
+    }
+};
+
+namespace detail {
+
+using SwissCtrl = std::int8_t;
+
+inline constexpr SwissCtrl kSwissEmpty = -128;   // 0b10000000
+inline constexpr SwissCtrl kSwissDeleted = -2;   // 0b11111110
+inline constexpr std::size_t kSwissGroupWidth = 16;
+
+/// Bits of a 16-slot match; iterate with countr_zero and clear-lowest.
+class SwissBitMask {
+public:
+    explicit SwissBitMask(std::uint32_t bits) noexcept : bits_(bits) {}
+
+    explicit operator bool() const noexcept { return bits_ != 0; }
+    std::uint32_t lowest() const noexcept {
+        return static_cast<std::uint32_t>(std::countr_zero(bits_));
+    }
+    /// Empty slots directly before the end of the group (from the top bit down).
+    std::uint32_t leadingZeros() const noexcept {
+        return static_cast<std::uint32_t>(std::countl_zero(static_cast<std::uint16_t>(bits_)));
+    }
+    std::uint32_t trailingZeros() const noexcept {
+        return static_cast<std::uint32_t>(std::countr_zero(static_cast<std::uint16_t>(bits_)));
+    }
+    void clearLowest() noexcept { bits_ &= bits_ - 1; }
+
+private:
+    std::uint32_t bits_;
+};
+
+/// Sixteen control bytes loaded together.
+class SwissGroup {
+public:
+    explicit SwissGroup(const SwissCtrl* ctrl) noexcept {
+#if defined(CORE_SWISS_SSE2)
+        bytes_ = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl));
+#else
+        std::memcpy(bytes_, ctrl, kSwissGroupWidth);
+#endif
+    }
+
+    SwissBitMask match(SwissCtrl h2) const noexcept {
+#if defined(CORE_SWISS_SSE2)
+        const __m128i equal = _mm_cmpeq_epi8(_mm_set1_epi8(h2), bytes_);
+        return SwissBitMask(static_cast<std::uint32_t>(_mm_movemask_epi8(equal)));
+#else
+        std::uint32_t bits = 0;
+        for (std::size_t i = 0; i < kSwissGroupWidth; ++i) {
+            bits |= static_cast<std::uint32_t>(bytes_[i] == h2) << i;
+        }
+        return SwissBitMask(bits);
+#endif
+    }
+
+    SwissBitMask matchEmpty() const noexcept { return match(kSwissEmpty); }
+
+    /// Empty and deleted both have the sign bit set; full slots never do.
+    SwissBitMask matchEmptyOrDeleted() const noexcept {
+#if defined(CORE_SWISS_SSE2)
+        return SwissBitMask(static_cast<std::uint32_t>(_mm_movemask_epi8(bytes_)));
+#else
+        std::uint32_t bits = 0;
+        for (std::size_t i = 0; i < kSwissGroupWidth; ++i) {
+            bits |= static_cast<std::uint32_t>(bytes_[i] < 0) << i;
+        }
+        return SwissBitMask(bits);
+#endif
+    }
+
+private:
+#if defined(CORE_SWISS_SSE2)
+    __m128i bytes_;
+#else
+    SwissCtrl bytes_[kSwissGroupWidth];
+#endif
+};
+
+/// Control bytes of a map with no storage: one all-empty group.
+inline const SwissCtrl* swissEmptyGroup() noexcept {
+    alignas(16) static constexpr SwissCtrl kEmptyGroup[kSwissGroupWidth] = {
+        kSwissEmpty, kSwissEmpty, kSwissEmpty, kSwissEmpty, kSwissEmpty, kSwissEmpty,
+        kSwissEmpty, kSwissEmpty, kSwissEmpty, kSwissEmpty, kSwissEmpty, kSwissEmpty,
+        kSwissEmpty, kSwissEmpty, kSwissEmpty, kSwissEmpty};
+    return kEmptyGroup;
+}
+
+/// Finalizer that spreads weak hashes (std::hash<int> is the identity).
+inline std::size_t swissMix(std::size_t hash) noexcept {
+    auto h = static_cast<std::uint64_t>(hash);
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdull;
+    h ^= h >> 33;
+    return static_cast<std::size_t>(h);
+}
+
+template<typename Hash, typename Eq, typename Key, typename K>
+inline constexpr bool kSwissLookup =
+    std::is_same_v<K, Key> ||
+    (requires { typename Hash::is_transparent; } && requires { typename Eq::is_transparent; });
+
+}  // namespace detail
+
+/**
+ * @brief Swiss-table hash map with SSE2 group probing
+ *
+ * Example usage:
+ * core::SwissMap<int, std::string> employees;
+ * employees[101] = "John Doe";
+ * employees.try_emplace(102, "Jane Smith");
+ * if (auto it = employees.find(101); it != employees.end()) { ... }
+ *
+ * core::SwissMap<std::string, int> counts;
+ * counts.find(std::string_view("key"));   // no std::string built
+ */
+template<typename Key, typename T, typename Hash = SwissHash<Key>, typename Eq = std::equal_to<>>
+class SwissMap {
+    template<bool Const>
+    class Iterator;
+
+public:
+    using key_type = Key;
+    using mapped_type = T;
+    using value_type = std::pair<const Key, T>;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using hasher = Hash;
+    using key_equal = Eq;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    SwissMap() noexcept = default;
+
+    explicit SwissMap(size_type capacity, const Hash& hash = Hash(), const Eq& eq = Eq())
+        : hash_(hash), eq_(eq) {
+        reserve(capacity);
+    }
+
+    SwissMap(std::initializer_list<value_type> init) {
+        reserve(init.size());
+        for (const auto& value : init) {
+            insert(value);
+        }
+    }
+
+    SwissMap(const SwissMap& other) : hash_(other.hash_), eq_(other.eq_) {
+        reserve(other.size());
+        for (const auto& value : other) {
+            insertUnique(value.first, value.second);
+        }
+    }
+
+    SwissMap(SwissMap&& other) noexcept
+        : ctrl_(std::exchange(other.ctrl_, const_cast<detail::SwissCtrl*>(
+                                              detail::swissEmptyGroup()))),
+          slots_(std::exchange(other.slots_, nullptr)),
+          capacity_(std::exchange(other.capacity_, 0)),
+          size_(std::exchange(other.size_, 0)),
+          growthLeft_(std::exchange(other.growthLeft_, 0)),
+          hash_(other.hash_),
+          eq_(other.eq_) {}
+
+    SwissMap& operator=(const SwissMap& other) {
+        if (this != &other) {
+            SwissMap(other).swap(*this);
+        }
+        return *this;
+    }
+
+    SwissMap& operator=(SwissMap&& other) noexcept {
+        SwissMap(std::move(other)).swap(*this);
+        return *this;
+    }
+
+    ~SwissMap() { destroyAll(); }
+
+    iterator begin() noexcept { return iterator(ctrl_, slots_, ctrl_ + capacity_); }
+    iterator end() noexcept { return iterator(ctrl_ + capacity_); }
+    const_iterator begin() const noexcept {
+        return const_iterator(ctrl_, slots_, ctrl_ + capacity_);
+    }
+    const_iterator end() const noexcept { return const_iterator(ctrl_ + capacity_); }
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+
+    bool empty() const noexcept { return size_ == 0; }
+    size_type size() const noexcept { return size_; }
+    size_type capacity() const noexcept { return capacity_; }
+
+    float load_factor() const noexcept {
+        return capacity_ == 0 ? 0.0f : static_cast<float>(size_) / static_cast<float>(capacity_);
+    }
+
+    /// Tables grow when live slots plus tombstones would pass 7/8 of capacity.
+    static constexpr float max_load_factor() noexcept { return 0.875f; }
+
+    void clear() noexcept {
+        destroyAll();
+        ctrl_ = const_cast<detail::SwissCtrl*>(detail::swissEmptyGroup());
+        slots_ = nullptr;
+        capacity_ = 0;
+        size_ = 0;
+        growthLeft_ = 0;
+    }
+
+    /// Makes room for @p count elements without further rehashing.
+    void reserve(size_type count) {
+        if (count > size_ + growthLeft_) {
+            size_type capacity = detail::kSwissGroupWidth;
+            while (maxLoad(capacity) < count) {
+                capacity *= 2;
+            }
+            rehash(capacity > capacity_ ? capacity : capacity_);  // also drops tombstones
+        }
+    }
+
+    template<typename K>
+        requires detail::kSwissLookup<Hash, Eq, Key, K>
+    iterator find(const K& key) {
+        const size_type index = findIndex(key);
+        return index == capacity_ ? end()
+                                  : iterator(ctrl_ + index, slots_ + index, ctrl_ + capacity_);
+    }
+    iterator find(const Key& key) { return find<Key>(key); }
+
+    template<typename K>
+        requires detail::kSwissLookup<Hash, Eq, Key, K>
+    const_iterator find(const K& key) const {
+        const size_type index = findIndex(key);
+        return index == capacity_ ? end()
+                                  : const_iterator(ctrl_ + index, slots_ + index,
+                                                   ctrl_ + capacity_);
+    }
+    const_iterator find(const Key& key) const { return find<Key>(key); }
+
+    template<typename K>
+        requires detail::kSwissLookup<Hash, Eq, Key, K>
+    bool contains(const K& key) const {
+        return findIndex(key) != capacity_;
+    }
+    bool contains(const Key& key) const { return contains<Key>(key); }
+
+    template<typename K>
+        requires detail::kSwissLookup<Hash, Eq, Key, K>
+    size_type count(const K& key) const {
+        return contains(key) ? 1 : 0;
+    }
+    size_type count(const Key& key) const { return count<Key>(key); }
+
+    template<typename K>
+        requires detail::kSwissLookup<Hash, Eq, Key, K>
+    T& at(const K& key) {
+        return slots_[checkedIndex(key)].second;
+    }
+    T& at(const Key& key) { return at<Key>(key); }
+
+    template<typename K>
+        requires detail::kSwissLookup<Hash, Eq, Key, K>
+    const T& at(const K& key) const {
+        return slots_[checkedIndex(key)].second;
+    }
+    const T& at(const Key& key) const { return at<Key>(key); }
+
+    T& operator[](const Key& key) { return try_emplace(key).first->second; }
+    T& operator[](Key&& key) { return try_emplace(std::move(key)).first->second; }
+
+    template<typename... Args>
+    std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args) {
+        return emplaceKey(key, std::forward<Args>(args)...);
+    }
+
+    template<typename... Args>
+    std::pair<iterator, bool> try_emplace(Key&& key, Args&&... args) {
+        return emplaceKey(std::move(key), std::forward<Args>(args)...);
+    }
+
+    template<typename M>
+    std::pair<iterator, bool> insert_or_assign(const Key& key, M&& value) {
+        auto result = emplaceKey(key, std::forward<M>(value));
+        if (!result.second) {
+            result.first->second = std::forward<M>(value);
+        }
+        return result;
+    }
+
+    std::pair<iterator, bool> insert(const value_type& value) {
+        return emplaceKey(value.first, value.second);
+    }
+
+    std::pair<iterator, bool> insert(std::pair<Key, T>&& value) {
+        return emplaceKey(std::move(value.first), std::move(value.second));
+    }
+
+    template<typename... Args>
+    std::pair<iterator, bool> emplace(Args&&... args) {
+        std::pair<Key, T> value(std::forward<Args>(args)...);
+        return emplaceKey(std::move(value.first), std::move(value.second));
+    }
+
+    template<typename K>
+        requires(detail::kSwissLookup<Hash, Eq, Key, K> &&
+                 !std::is_convertible_v<K, const_iterator>)
+    size_type erase(const K& key) {
+        const size_type index = findIndex(key);
+        if (index == capacity_) {
+            return 0;
+        }
+        eraseAt(index);
+        return 1;
+    }
+    size_type erase(const Key& key) { return erase<Key>(key); }
+
+    /// Erases the element at @p position and returns the next one.
+    iterator erase(const_iterator position) {
+        const auto index = static_cast<size_type>(position.ctrl_ - ctrl_);
+        eraseAt(index);
+        return iterator(ctrl_ + index, slots_ + index, ctrl_ + capacity_);
+    }
+
+    void swap(SwissMap& other) noexcept {
+        using std::swap;
+        swap(ctrl_, other.ctrl_);
+        swap(slots_, other.slots_);
+        swap(capacity_, other.capacity_);
+        swap(size_, other.size_);
+        swap(growthLeft_, other.growthLeft_);
+        swap(hash_, other.hash_);
+        swap(eq_, other.eq_);
+    }
+    friend void swap(SwissMap& a, SwissMap& b) noexcept { a.swap(b); }
+
+    friend bool operator==(const SwissMap& a, const SwissMap& b) {
+        if (a.size() != b.size()) {
+            return false;
+        }
+        for (const auto& [key, value] : a) {
+            auto it = b.find(key);
+            if (it == b.end() || !(it->second == value)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+private:
+    using Ctrl = detail::SwissCtrl;
+    using Group = detail::SwissGroup;
+    static constexpr size_type kWidth = detail::kSwissGroupWidth;
+
+    static constexpr size_type maxLoad(size_type capacity) noexcept {
+        return capacity - capacity / 8;
+    }
+
+    template<typename K>
+    size_type hashOf(const K& key) const {
+        return detail::swissMix(hash_(key));
+    }
+
+    static Ctrl h2(size_type hash) noexcept { return static_cast<Ctrl>(hash & 0x7F); }
+
+    void setCtrl(size_type index, Ctrl value) noexcept {
+        ctrl_[index] = value;
+        // Mirror the first group after the end so unaligned loads never wrap
+        if (index < kWidth) {
+            ctrl_[capacity_ + index] = value;
+        }
+    }
+
+    /// Slot index of @p key, or capacity_ when absent.
+    template<typename K>
+    size_type findIndex(const K& key) const {
+        const size_type hash = hashOf(key);
+        const Ctrl tag = h2(hash);
+        const size_type mask = capacity_ == 0 ? 0 : capacity_ - 1;
+        size_type position = (hash >> 7) & mask;
+        for (size_type step = kWidth;; step += kWidth) {
+            const Group group(ctrl_ + position);
+            for (auto match = group.match(tag); match; match.clearLowest()) {
+                const size_type index = (position + match.lowest()) & mask;
+                if (eq_(slots_[index].first, key)) {
+                    return index;
+                }
+            }
+            if (group.matchEmpty()) {
+                return capacity_;
+            }
+            position = (position + step) & mask;  // triangular probing over groups
+        }
+    }
+
+    /// First empty or deleted slot on the probe sequence of @p hash.
+    size_type findInsertSlot(size_type hash) const noexcept {
+        const size_type mask = capacity_ - 1;
+        size_type position = (hash >> 7) & mask;
+        for (size_type step = kWidth;; step += kWidth) {
+            const auto available = Group(ctrl_ + position).matchEmptyOrDeleted();
+            if (available) {
+                return (position + available.lowest()) & mask;
+            }
+            position = (position + step) & mask;
+        }
+    }
+
+    template<typename K>
+    size_type checkedIndex(const K& key) const {
+        const size_type index = findIndex(key);
+        if (index == capacity_) {
+            throw std::out_of_range("SwissMap::at: key not found");
+        }
+        return index;
+    }
+
+    template<typename K, typename... Args>
+    std::pair<iterator, bool> emplaceKey(K&& key, Args&&... args) {
+        const size_type existing = findIndex(key);
+        if (existing != capacity_) {
+            return {iterator(ctrl_ + existing, slots_ + existing, ctrl_ + capacity_), false};
+        }
+        const size_type index = insertUnique(std::forward<K>(key), std::forward<Args>(args)...);
+        return {iterator(ctrl_ + index, slots_ + index, ctrl_ + capacity_), true};
+    }
+
+    /// Inserts a key known to be absent; returns its slot.
+    template<typename K, typename... Args>
+    size_type insertUnique(K&& key, Args&&... args) {
+        const size_type hash = hashOf(key);
+        if (capacity_ == 0) {
+            rehash(kWidth);
+        }
+        size_type index = findInsertSlot(hash);
+        // Reusing a tombstone costs no growth; taking an empty slot does
+        if (growthLeft_ == 0 && ctrl_[index] != detail::kSwissDeleted) {
+            // Mostly tombstones: rehash in place; otherwise double
+            rehash(size_ * 2 < maxLoad(capacity_) ? capacity_ : capacity_ * 2);
+            index = findInsertSlot(hash);
+        }
+        std::construct_at(slots_ + index, std::piecewise_construct,
+                          std::forward_as_tuple(std::forward<K>(key)),
+                          std::forward_as_tuple(std::forward<Args>(args)...));
+        if (ctrl_[index] == detail::kSwissEmpty) {
+            --growthLeft_;
+        }
+        setCtrl(index, h2(hash));
+        ++size_;
+        return index;
+    }
+
+    void eraseAt(size_type index) {
+        std::destroy_at(slots_ + index);
+        --size_;
+        // If a 16-wide window covering this slot was never completely full,
+        // no probe can have passed over it, so it may become empty again.
+        const size_type mask = capacity_ - 1;
+        const auto emptyBefore = Group(ctrl_ + ((index - kWidth) & mask)).matchEmpty();
+        const auto emptyAfter = Group(ctrl_ + index).matchEmpty();
+        const bool neverFull = emptyBefore && emptyAfter &&
+                               emptyAfter.trailingZeros() + emptyBefore.leadingZeros() < kWidth;
+        if (neverFull) {
+            setCtrl(index, detail::kSwissEmpty);
+            ++growthLeft_;
+        } else {
+            setCtrl(index, detail::kSwissDeleted);
+        }
+    }
+
+    void rehash(size_type newCapacity) {
+        Ctrl* oldCtrl = ctrl_;
+        value_type* oldSlots = slots_;
+        const size_type oldCapacity = capacity_;
+
+        auto* newCtrl = new Ctrl[newCapacity + kWidth];
+        value_type* newSlots = nullptr;
+        try {
+            newSlots = std::allocator<value_type>().allocate(newCapacity);
+        } catch (...) {
+            delete[] newCtrl;
+            throw;
+        }
+        std::memset(newCtrl, static_cast<unsigned char>(detail::kSwissEmpty),
+                    newCapacity + kWidth);
+
+        ctrl_ = newCtrl;
+        slots_ = newSlots;
+        capacity_ = newCapacity;
+        growthLeft_ = maxLoad(newCapacity) - size_;
+
+        for (size_type i = 0; i < oldCapacity; ++i) {
+            if (oldCtrl[i] >= 0) {
+                value_type& old = oldSlots[i];
+                const size_type hash = hashOf(old.first);
+                const size_type index = findInsertSlot(hash);
+                // The key is const inside value_type, so it is copied here
+                std::construct_at(slots_ + index, std::piecewise_construct,
+                                  std::forward_as_tuple(old.first),
+                                  std::forward_as_tuple(std::move(old.second)));
+                setCtrl(index, h2(hash));
+                std::destroy_at(&old);
+            }
+        }
+        if (oldCapacity != 0) {
+            delete[] oldCtrl;
+            std::allocator<value_type>().deallocate(oldSlots, oldCapacity);
+        }
+    }
+
+    void destroyAll() noexcept {
+        if (capacity_ == 0) {
+            return;
+        }
+        if constexpr (!std::is_trivially_destructible_v<value_type>) {
+            for (size_type i = 0; i < capacity_; ++i) {
+                if (ctrl_[i] >= 0) {
+                    std::destroy_at(slots_ + i);
+                }
+            }
+        }
+        delete[] ctrl_;
+        std::allocator<value_type>().deallocate(slots_, capacity_);
+    }
+
+    Ctrl* ctrl_ = const_cast<Ctrl*>(detail::swissEmptyGroup());  // never written while empty
+    value_type* slots_ = nullptr;
+    size_type capacity_ = 0;
+    size_type size_ = 0;
+    size_type growthLeft_ = 0;
+    [[no_unique_address]] Hash hash_;
+    [[no_unique_address]] Eq eq_;
+};
+
+/// Forward iterator that skips empty and deleted slots.
+template<typename Key, typename T, typename Hash, typename Eq>
+template<bool Const>
+class SwissMap<Key, T, Hash, Eq>::Iterator {
+    using Slot = std::conditional_t<Const, const typename SwissMap::value_type,
+                                    typename SwissMap::value_type>;
+
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = typename SwissMap::value_type;
+    using difference_type = std::ptrdiff_t;
+    using reference = Slot&;
+    using pointer = Slot*;
+
+    Iterator() noexcept = default;
+
+    template<bool OtherConst>
+        requires(Const && !OtherConst)
+    Iterator(const Iterator<OtherConst>& other) noexcept
+        : ctrl_(other.ctrl_), slot_(other.slot_), end_(other.end_) {}
+
+    reference operator*() const noexcept { return *slot_; }
+    pointer operator->() const noexcept { return slot_; }
+
+    Iterator& operator++() noexcept {
+        ++ctrl_;
+        ++slot_;
+        skipEmpty();
+        return *this;
+    }
+
+    Iterator operator++(int) noexcept {
+        Iterator old = *this;
+        ++*this;
+        return old;
+    }
+
+    friend bool operator==(const Iterator& a, const Iterator& b) noexcept {
+        return a.ctrl_ == b.ctrl_;
+    }
+
+private:
+    friend class SwissMap;
+    friend class Iterator<!Const>;
+
+    /// Scans forward from @p ctrl to the first full slot.
+    Iterator(const detail::SwissCtrl* ctrl, Slot* slot, const detail::SwissCtrl* end) noexcept
+        : ctrl_(ctrl), slot_(slot), end_(end) {
+        skipEmpty();
+    }
+
+    explicit Iterator(const detail::SwissCtrl* end) noexcept : ctrl_(end), end_(end) {}
+
+    void skipEmpty() noexcept {
+        while (ctrl_ != end_ && *ctrl_ < 0) {
+            ++ctrl_;
+            ++slot_;
+        }
+    }
+
+    const detail::SwissCtrl* ctrl_ = nullptr;
+    Slot* slot_ = nullptr;
+    const detail::SwissCtrl* end_ = nullptr;
+};
+
+}  // namespace core
@@ -0,0 +1,123 @@
+/**
+ * @file task.hpp
+ * @brief Eagerly started coroutine handle for fire-and-join style code
+ *
+ * core::Task is the return type for coroutines that drive core::Channel
+ * operations. The coroutine starts running as soon as it is called, suspends
+ * whenever an awaited channel operation cannot complete, and keeps its frame
+ * alive until the Task is destroyed, so its exception can still be observed.
+ *
+ * @author Modern C++ Starter Template
+ * @date 2025
+ */
+
+#pragma once
+
+#include <atomic>
+#include <coroutine>
+#include <exception>
+#include <memory>
+#include <utility>
+
+namespace core {
+
+/**
+ * @brief Owning handle to an eagerly started `void` coroutine
+ *
+ * Example usage:
+ * core::Task producer(core::Channel<int>& ch) {
+ *     for (int i = 0; i < 10; ++i) co_await ch.send(i);
+ *     ch.close();
+ * }
+ * auto task = producer(ch);   // runs until the first blocking send
+ * task.wait();                // block this thread until it finishes
+ * task.get();                 // rethrows an escaped exception
+ *
+ * A Task must not be destroyed while its coroutine is suspended on a channel.
+ */
+class Task {
+public:
+    struct promise_type {
+        /// Shared with the Task so a waiter may free the frame while the final notify runs.
+        struct State {
+            std::exception_ptr error;
+            std::atomic<bool> finished{false};
+        };
+        std::shared_ptr<State> state = std::make_shared<State>();
+
+        Task get_return_object() {
+            return Task(std::coroutine_handle<promise_type>::from_promise(*this), state);
+        }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+
+        struct FinalAwaiter {
+            bool await_ready() noexcept { return false; }
+            void await_suspend(std::coroutine_handle<promise_type> handle) noexcept {
+                // Once finished is set the Task may destroy this frame, so
+                // notify through a reference held on this thread's stack
+                std::shared_ptr<State> state = handle.promise().state;
+                state->finished.store(true, std::memory_order_release);
+                state->finished.notify_all();
+            }
+            void await_resume() noexcept {}
+        };
+        FinalAwaiter final_suspend() noexcept { return {}; }
+
+        void return_void() {}
+        void unhandled_exception() { state->error = std::current_exception(); }
+    };
+
+    Task() = default;
+
+    Task(Task&& other) noexcept
+        : handle_(std::exchange(other.handle_, nullptr)), state_(std::move(other.state_)) {}
+
+    Task& operator=(Task&& other) noexcept {
+        if (this != &other) {
+            if (handle_) {
+                handle_.destroy();
+            }
+            handle_ = std::exchange(other.handle_, nullptr);
+            state_ = std::move(other.state_);
+        }
+        return *this;
+    }
+
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+
+    ~Task() {
+        if (handle_) {
+            handle_.destroy();
+        }
+    }
+
+    /// True once the coroutine has run to completion (safe from any thread).
+    bool done() const {
+        return !state_ || state_->finished.load(std::memory_order_acquire);
+    }
+
+    /// Blocks the calling thread until the coroutine completes.
+    void wait() const {
+        if (state_) {
+            state_->finished.wait(false, std::memory_order_acquire);
+        }
+    }
+
+    /// Waits for completion and rethrows any exception that escaped the coroutine.
+    void get() const {
+        wait();
+        if (state_ && state_->error) {
+            std::rethrow_exception(state_->error);
+        }
+    }
+
+private:
+    Task(std::coroutine_handle<promise_type> handle, std::shared_ptr<promise_type::State> state)
+        : handle_(handle), state_(std::move(state)) {}
+
+    std::coroutine_handle<promise_type> handle_;
+    std::shared_ptr<promise_type::State> state_;
+};
+
+}  // namespace core
@@ -0,0 +1,102 @@
+/**
+ * @file thread_pool.hpp
+ * @brief Fixed-size worker pool shared by the core parallel algorithms
+ *
+ * The pool owns a set of long-lived worker threads that drain a single FIFO
+ * task queue. Parallel algorithms in the core library (for example
+ * core::parallel_sort) use parallelFor(), which lets the calling thread take
+ * part in the work so that nested use from inside a pool task cannot deadlock.
+ *
+ * @author Modern C++ Starter Template
+ * @date 2025
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace core {
+
+/**
+ * @brief Fixed-size thread pool with a shared task queue
+ *
+ * Example usage:
+ * auto& pool = core::ThreadPool::getInstance();
+ * auto answer = pool.submit([] { return 42; });
+ * pool.parallelFor(64, [&](std::size_t chunk) { process(chunk); });
+ */
+class ThreadPool {
+public:
+    /// Creates a pool with @p threadCount workers (at least one).
+    explicit ThreadPool(std::size_t threadCount = std::thread::hardware_concurrency());
+
+    /// Finishes all queued tasks, then joins the workers.
+    ~ThreadPool();
+
+    // Non-copyable and non-movable: workers hold a pointer to the pool
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+    ThreadPool(ThreadPool&&) = delete;
+    ThreadPool& operator=(ThreadPool&&) = delete;
+
+    /// Process-wide pool sized to the hardware concurrency.
+    static ThreadPool& getInstance();
+
+    /// Number of worker threads.
+    std::size_t size() const { return workers_.size(); }
+
+    /**
+     * @brief Queues a callable and returns a future for its result
+     *
+     * Exceptions thrown by the callable are stored in the future.
+     */
+    template<typename F, typename... Args>
+    auto submit(F&& func, Args&&... args)
+        -> std::future<std::invoke_result_t<std::decay_t<F>, std::decay_t<Args>...>>;
+
+    /**
+     * @brief Runs body(i) for every i in [0, count) and waits for completion
+     *
+     * Indices are claimed dynamically by the workers and by the calling
+     * thread, so the call makes progress even when every worker is busy.
+     * The first exception thrown by @p body is rethrown after all claimed
+     * indices have finished.
+     */
+    void parallelFor(std::size_t count, const std::function<void(std::size_t)>& body);
+
+private:
+    void enqueue(std::function<void()> task);
+    void workerLoop();
+
+    std::vector<std::thread> workers_;
+    std::queue<std::function<void()>> tasks_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool stopping_ = false;
+};
+
+template<typename F, typename... Args>
+auto ThreadPool::submit(F&& func, Args&&... args)
+    -> std::future<std::invoke_result_t<std::decay_t<F>, std::decay_t<Args>...>> {
+    using Result = std::invoke_result_t<std::decay_t<F>, std::decay_t<Args>...>;
+
+    // std::function requires a copyable target, so the task lives in a shared_ptr
+    auto task = std::make_shared<std::packaged_task<Result()>>(
+        [func = std::forward<F>(func), ... args = std::forward<Args>(args)]() mutable {
+            return std::invoke(std::move(func), std::move(args)...);
+        });
+    auto future = task->get_future();
+    enqueue([task]() { (*task)(); });
+    return future;
+}
+
+}  // namespace core
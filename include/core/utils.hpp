@@ -18,6 +18,9 @@
 
 #pragma once
 
+#include "core/intern_pool.hpp"
+#include "core/intrusive_ptr.hpp"
+
 #include <memory>
 #include <vector>
 #include <string>
@@ -26,6 +29,8 @@
 #include <typeindex>
 #include <stdexcept>
 #include <chrono>
+#include <optional>
+#include <string_view>
 
 namespace core {
 
@@ -95,8 +100,32 @@ auto makeRaiiWrapper(T resource, Deleter deleter) {
     return RaiiWrapper<T, Deleter>(resource, deleter);
 }
 
+namespace detail {
+
+/// Type-erased, reference-counted storage for one Config value.
+struct ConfigSlot : RefCounted<ConfigSlot> {
+    virtual ~ConfigSlot() = default;
+};
+
+template<typename T>
+struct ConfigSlotOf final : ConfigSlot {
+    template<typename U>
+    explicit ConfigSlotOf(U&& v) : value(std::forward<U>(v)) {}
+    T value;
+};
+
+}  // namespace detail
+
 /**
  * @brief Type-safe configuration system
+ *
+ * Keys are interned in InternPool::global(). The Symbol overloads skip
+ * hashing the key text, so hot paths can intern a key once and reuse it.
+ *
+ * Example usage:
+ * static const core::Symbol kWidth = core::intern("window.width");
+ * config.set(kWidth, 1280);
+ * int width = config.get<int>(kWidth);
  */
 class Config {
 public:
@@ -110,7 +139,19 @@ public:
     T getOrDefault(const std::string& key, T&& defaultValue) const;
     
     bool has(const std::string& key) const;
-    void remove(const std::string& key);    private:
+    void remove(const std::string& key);
+
+    template<typename T>
+    void set(Symbol key, T&& value);
+
+    template<typename T>
+    T get(Symbol key) const;
+
+    template<typename T>
+    T getOrDefault(Symbol key, T&& defaultValue) const;
+
+    bool has(Symbol key) const;
+    void remove(Symbol key);    private:
         class ConfigValue {
         public:
             // Default constructor for container usage
@@ -120,7 +161,7 @@ public:
             ConfigValue(T&& value) 
                 : type_(std::type_index(typeid(typename std::decay<T>::type))) {
                 using DecayedT = typename std::decay<T>::type;
-                data_ = std::make_shared<DecayedT>(std::forward<T>(value));
+                data_ = make_intrusive<detail::ConfigSlotOf<DecayedT>>(std::forward<T>(value));
             }
             
             template<typename T>
@@ -129,43 +170,73 @@ public:
                 if (type_ != std::type_index(typeid(DecayedT))) {
                     throw std::runtime_error("Type mismatch in Config::get()");
                 }
-                return *static_cast<DecayedT*>(data_.get());
+                return static_cast<const detail::ConfigSlotOf<DecayedT>*>(data_.get())->value;
             }
             
         private:
-            std::shared_ptr<void> data_;
+            IntrusivePtr<detail::ConfigSlot> data_;  // one block, one pointer wide
             std::type_index type_;
         };
         
-        std::unordered_map<std::string, ConfigValue> values_;
+        const ConfigValue* lookup(Symbol key) const;
+
+        std::unordered_map<Symbol, ConfigValue> values_;
 };
 
 // Template method implementations for Config
 template<typename T>
 void Config::set(const std::string& key, T&& value) {
-    values_[key] = ConfigValue(std::forward<T>(value));
+    set(intern(key), std::forward<T>(value));
 }
 
 template<typename T>
 T Config::get(const std::string& key) const {
-    auto it = values_.find(key);
-    if (it == values_.end()) {
+    // find() never inserts, so probing unknown keys does not grow the pool
+    const ConfigValue* value = lookup(InternPool::global().find(key));
+    if (value == nullptr) {
         throw std::runtime_error("Key not found: " + key);
     }
-    return it->second.template as<T>();
+    return value->template as<T>();
 }
 
 template<typename T>
 T Config::getOrDefault(const std::string& key, T&& defaultValue) const {
-    auto it = values_.find(key);
-    if (it == values_.end()) {
+    return getOrDefault(InternPool::global().find(key), std::forward<T>(defaultValue));
+}
+
+template<typename T>
+void Config::set(Symbol key, T&& value) {
+    values_[key] = ConfigValue(std::forward<T>(value));
+}
+
+template<typename T>
+T Config::get(Symbol key) const {
+    const ConfigValue* value = lookup(key);
+    if (value == nullptr) {
+        throw std::runtime_error("Key not found: " + std::string(symbolName(key)));
+    }
+    return value->template as<T>();
+}
+
+template<typename T>
+T Config::getOrDefault(Symbol key, T&& defaultValue) const {
+    const ConfigValue* value = lookup(key);
+    if (value == nullptr) {
         return std::forward<T>(defaultValue);
     }
-    return it->second.template as<T>();
+    return value->template as<T>();
 }
 
 /**
  * @brief Simple logger with different levels
+ *
+ * Messages may carry a category Symbol, which is printed with the message
+ * and can have its own level threshold.
+ *
+ * Example usage:
+ * static const core::Symbol kNet = core::intern("net");
+ * logger.setLevel(kNet, core::LogLevel::Debug);
+ * logger.debug(kNet, "connected");   // "[12:00:00] 🐛 DEBUG [net]: connected"
  */
 enum class LogLevel {
     Debug,
@@ -174,11 +245,17 @@ enum class LogLevel {
     Error
 };
 
+/// Parses "debug", "info", "warning"/"warn" or "error" (lowercase); nullopt otherwise.
+std::optional<LogLevel> parseLogLevel(std::string_view name) noexcept;
+
 class Logger {
 public:
     static Logger& getInstance();
     
     void setLevel(LogLevel level);
+
+    /// Overrides the threshold for one category.
+    void setLevel(Symbol category, LogLevel level);
     
     template<typename... Args>
     void debug(const std::string& format, Args&&... args);
@@ -191,10 +268,18 @@ public:
     
     template<typename... Args>
     void error(const std::string& format, Args&&... args);
+
+    void debug(Symbol category, const std::string& message);
+    void info(Symbol category, const std::string& message);
+    void warning(Symbol category, const std::string& message);
+    void error(Symbol category, const std::string& message);
     
 private:
     Logger() = default;
     LogLevel currentLevel_ = LogLevel::Info;
+    std::unordered_map<Symbol, LogLevel> categoryLevels_;
+
+    void write(LogLevel level, Symbol category, const std::string& message);
     
     template<typename... Args>
     void log(LogLevel level, const std::string& format, Args&&... args);
@@ -0,0 +1,485 @@
+/**
+ * @file vec.hpp
+ * @brief Numeric array whose element-wise expressions fuse into one loop
+ *
+ * With std::vector-style operators, `a = b * c + d` builds a temporary for
+ * `b * c`, a second for `+ d`, and then copies. That is two allocations
+ * and three passes over memory. core::Vec<T> uses expression templates
+ * instead. `b * c + d` builds a small object that only records the
+ * operation and the operands:
+ *
+ *     Binary<Plus, Binary<Multiplies, Ref<double>, Ref<double>>, Ref<double>>
+ *
+ * Nothing is computed until the expression is assigned to a Vec (or
+ * reduced with sum() or dot()). The assignment is then a single loop,
+ * `out[i] = b[i] * c[i] + d[i]`. It makes no temporaries, and at -O2/-O3
+ * the compiler inlines the nested operator[] calls and vectorizes it like
+ * a hand-written loop.
+ *
+ * Operands must have equal sizes; mismatches throw std::invalid_argument
+ * when the expression is built. Scalars mix freely and are converted to
+ * the vector's element type. Expressions hold references to their
+ * operands, so build them and assign them in the same statement, as in
+ * the examples. `auto e = b * c;` keeps references that dangle if b or c
+ * go away.
+ *
+ * @author Modern C++ Starter Template
+ * @date 2025
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <memory>
+#include <new>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace core {
+
+template<typename T>
+class Vec;
+
+namespace detail {
+
+/// Base of every expression node; lets the operators recognize operands.
+struct VecExpressionBase {};
+
+template<typename E>
+inline constexpr bool is_vec_expression_v =
+    std::is_base_of_v<VecExpressionBase, std::remove_cvref_t<E>>;
+
+template<typename T>
+inline constexpr bool is_vec_v = false;
+
+template<typename T>
+inline constexpr bool is_vec_v<Vec<T>> = true;
+
+/// Anything that can appear as a vector operand.
+template<typename E>
+concept VecOperand = is_vec_expression_v<E> || is_vec_v<std::remove_cvref_t<E>>;
+
+/// Leaf: the data pointer and size of a Vec, copied so the loop reads no Vec members.
+template<typename T>
+struct Ref : VecExpressionBase {
+    using value_type = T;
+    const T* data;
+    std::size_t count;
+
+    std::size_t size() const noexcept { return count; }
+    T operator[](std::size_t i) const noexcept { return data[i]; }
+};
+
+/// Leaf: a scalar broadcast to every index; it has no size of its own.
+template<typename T>
+struct Scalar : VecExpressionBase {
+    using value_type = T;
+    T value;
+
+    T operator[](std::size_t) const noexcept { return value; }
+};
+
+template<typename E>
+inline constexpr bool is_scalar_leaf_v = false;
+
+template<typename T>
+inline constexpr bool is_scalar_leaf_v<Scalar<T>> = true;
+
+/// Size of a node; the operator overloads never pair two scalars.
+template<typename L, typename R>
+std::size_t commonSize(const L& left, const R& right) {
+    if constexpr (is_scalar_leaf_v<L>) {
+        return right.size();
+    } else if constexpr (is_scalar_leaf_v<R>) {
+        return left.size();
+    } else {
+        if (left.size() != right.size()) {
+            throw std::invalid_argument("Vec expression operands differ in size");
+        }
+        return left.size();
+    }
+}
+
+template<typename Op, typename L, typename R>
+struct Binary : VecExpressionBase {
+    using value_type = decltype(Op{}(std::declval<typename L::value_type>(),
+                                     std::declval<typename R::value_type>()));
+    L left;
+    R right;
+    std::size_t count;
+
+    Binary(L l, R r) : left(l), right(r), count(commonSize(l, r)) {}
+
+    std::size_t size() const noexcept { return count; }
+    value_type operator[](std::size_t i) const { return Op{}(left[i], right[i]); }
+};
+
+template<typename Op, typename E>
+struct Unary : VecExpressionBase {
+    using value_type = decltype(Op{}(std::declval<typename E::value_type>()));
+    E operand;
+
+    std::size_t size() const noexcept { return operand.size(); }
+    value_type operator[](std::size_t i) const { return Op{}(operand[i]); }
+};
+
+struct Plus {
+    template<typename A, typename B>
+    auto operator()(A a, B b) const { return a + b; }
+};
+struct Minus {
+    template<typename A, typename B>
+    auto operator()(A a, B b) const { return a - b; }
+};
+struct Multiplies {
+    template<typename A, typename B>
+    auto operator()(A a, B b) const { return a * b; }
+};
+struct Divides {
+    template<typename A, typename B>
+    auto operator()(A a, B b) const { return a / b; }
+};
+struct Min {
+    template<typename A, typename B>
+    auto operator()(A a, B b) const { return b < a ? b : a; }
+};
+struct Max {
+    template<typename A, typename B>
+    auto operator()(A a, B b) const { return a < b ? b : a; }
+};
+struct Negate {
+    template<typename A>
+    auto operator()(A a) const { return -a; }
+};
+struct Sqrt {
+    template<typename A>
+    auto operator()(A a) const { return std::sqrt(a); }
+};
+struct Abs {
+    template<typename A>
+    auto operator()(A a) const { return std::abs(a); }
+};
+
+/// Turns an operand into its expression node: Vec becomes Ref, nodes stay.
+template<typename E>
+auto asExpression(const E& operand) {
+    if constexpr (is_vec_v<E>) {
+        return Ref<typename E::value_type>{{}, operand.data(), operand.size()};
+    } else {
+        return operand;
+    }
+}
+
+template<typename E>
+using ExpressionOf = decltype(asExpression(std::declval<const E&>()));
+
+template<typename Op, typename L, typename R>
+auto makeBinary(const L& left, const R& right) {
+    if constexpr (!VecOperand<L>) {
+        // scalar op vector: the scalar takes the vector's element type
+        using T = typename ExpressionOf<R>::value_type;
+        return Binary<Op, Scalar<T>, ExpressionOf<R>>(Scalar<T>{{}, static_cast<T>(left)},
+                                                      asExpression(right));
+    } else if constexpr (!VecOperand<R>) {
+        using T = typename ExpressionOf<L>::value_type;
+        return Binary<Op, ExpressionOf<L>, Scalar<T>>(asExpression(left),
+                                                      Scalar<T>{{}, static_cast<T>(right)});
+    } else {
+        return Binary<Op, ExpressionOf<L>, ExpressionOf<R>>(asExpression(left),
+                                                            asExpression(right));
+    }
+}
+
+/// Vector operand paired with a vector or arithmetic operand.
+template<typename L, typename R>
+concept VecOperands = (VecOperand<L> && (VecOperand<R> || std::is_arithmetic_v<R>)) ||
+                      (std::is_arithmetic_v<L> && VecOperand<R>);
+
+}  // namespace detail
+
+/**
+ * @brief Heap array of numbers with fused element-wise expressions
+ *
+ * Example usage:
+ * core::Vec<double> a(n), b(n, 1.0), c(n, 2.0), d(n, 3.0);
+ * a = b * c + d;                    // one loop, no temporaries
+ * a += 0.5 * core::sqrt(b);         // compound assignment fuses too
+ * double norm2 = core::dot(a, a);   // reductions evaluate in place
+ */
+template<typename T>
+class Vec {
+    static_assert(std::is_arithmetic_v<T>, "core::Vec holds arithmetic types");
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    Vec() noexcept = default;
+
+    /// @p count zero-initialized elements.
+    explicit Vec(size_type count) : Vec(count, T{}) {}
+
+    Vec(size_type count, T value) : data_(allocate(count)), size_(count) {
+        std::fill_n(data_, count, value);
+    }
+
+    Vec(std::initializer_list<T> values) : data_(allocate(values.size())), size_(values.size()) {
+        std::copy(values.begin(), values.end(), data_);
+    }
+
+    explicit Vec(std::span<const T> values) : data_(allocate(values.size())), size_(values.size()) {
+        std::copy(values.begin(), values.end(), data_);
+    }
+
+    /// Evaluates @p expression into a new Vec.
+    template<typename E>
+        requires detail::is_vec_expression_v<E>
+    Vec(const E& expression) : data_(allocate(expression.size())), size_(expression.size()) {
+        evaluate(expression, [](T& out, T value) { out = value; });
+    }
+
+    Vec(const Vec& other) : Vec(std::span<const T>(other.data_, other.size_)) {}
+
+    Vec(Vec&& other) noexcept
+        : data_(std::exchange(other.data_, nullptr)), size_(std::exchange(other.size_, 0)) {}
+
+    Vec& operator=(const Vec& other) {
+        if (this != &other) {
+            resizeUninitialized(other.size_);
+            std::copy_n(other.data_, other.size_, data_);
+        }
+        return *this;
+    }
+
+    Vec& operator=(Vec&& other) noexcept {
+        if (this != &other) {
+            deallocate(data_, size_);
+            data_ = std::exchange(other.data_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+        }
+        return *this;
+    }
+
+    /// Evaluates @p expression into this Vec in one pass; reallocates only
+    /// if the size changes (and then *this cannot be an operand).
+    template<typename E>
+        requires detail::is_vec_expression_v<E>
+    Vec& operator=(const E& expression) {
+        resizeUninitialized(expression.size());
+        evaluate(expression, [](T& out, T value) { out = value; });
+        return *this;
+    }
+
+    Vec& operator=(T value) {
+        std::fill_n(data_, size_, value);
+        return *this;
+    }
+
+    ~Vec() { deallocate(data_, size_); }
+
+    template<typename E>
+        requires detail::VecOperand<E> || std::is_arithmetic_v<E>
+    Vec& operator+=(const E& operand) {
+        return compound(operand, [](T& out, T value) { out += value; });
+    }
+
+    template<typename E>
+        requires detail::VecOperand<E> || std::is_arithmetic_v<E>
+    Vec& operator-=(const E& operand) {
+        return compound(operand, [](T& out, T value) { out -= value; });
+    }
+
+    template<typename E>
+        requires detail::VecOperand<E> || std::is_arithmetic_v<E>
+    Vec& operator*=(const E& operand) {
+        return compound(operand, [](T& out, T value) { out *= value; });
+    }
+
+    template<typename E>
+        requires detail::VecOperand<E> || std::is_arithmetic_v<E>
+    Vec& operator/=(const E& operand) {
+        return compound(operand, [](T& out, T value) { out /= value; });
+    }
+
+    T& operator[](size_type index) noexcept { return data_[index]; }
+    const T& operator[](size_type index) const noexcept { return data_[index]; }
+
+    T* data() noexcept { return data_; }
+    const T* data() const noexcept { return data_; }
+    size_type size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+
+    iterator begin() noexcept { return data_; }
+    const_iterator begin() const noexcept { return data_; }
+    iterator end() noexcept { return data_ + size_; }
+    const_iterator end() const noexcept { return data_ + size_; }
+
+    std::span<T> span() noexcept { return {data_, size_}; }
+    std::span<const T> span() const noexcept { return {data_, size_}; }
+
+    friend bool operator==(const Vec& a, const Vec& b) noexcept {
+        return a.size_ == b.size_ && std::equal(a.begin(), a.end(), b.begin());
+    }
+
+private:
+    // Cache-line alignment: vector loads never split a line at the start
+    static constexpr std::align_val_t kAlignment{64};
+
+    static T* allocate(size_type count) {
+        if (count == 0) {
+            return nullptr;
+        }
+        return static_cast<T*>(::operator new(count * sizeof(T), kAlignment));
+    }
+
+    static void deallocate(T* ptr, size_type count) noexcept {
+        if (ptr != nullptr) {
+            ::operator delete(ptr, count * sizeof(T), kAlignment);
+        }
+    }
+
+    void resizeUninitialized(size_type count) {
+        if (count != size_) {
+            T* fresh = allocate(count);
+            deallocate(data_, size_);
+            data_ = fresh;
+            size_ = count;
+        }
+    }
+
+    /// The fused loop: apply(out[i], expression[i]) for every i.
+    template<typename E, typename Apply>
+    void evaluate(const E& expression, Apply apply) {
+        T* out = data_;
+        const size_type count = size_;
+        for (size_type i = 0; i < count; ++i) {
+            apply(out[i], static_cast<T>(expression[i]));
+        }
+    }
+
+    template<typename E, typename Apply>
+    Vec& compound(const E& operand, Apply apply) {
+        if constexpr (std::is_arithmetic_v<E>) {
+            evaluate(detail::Scalar<T>{{}, static_cast<T>(operand)}, apply);
+        } else {
+            const auto expression = detail::asExpression(operand);
+            if (expression.size() != size_) {
+                throw std::invalid_argument("Vec compound assignment sizes differ");
+            }
+            evaluate(expression, apply);
+        }
+        return *this;
+    }
+
+    T* data_ = nullptr;
+    size_type size_ = 0;
+};
+
+// Element-wise operators; each returns an unevaluated expression node. They
+// live in detail so that argument-dependent lookup finds them for
+// expression nodes, and are re-exported for Vec operands.
+namespace detail {
+
+template<typename L, typename R>
+    requires VecOperands<L, R>
+auto operator+(const L& left, const R& right) {
+    return makeBinary<Plus>(left, right);
+}
+
+template<typename L, typename R>
+    requires VecOperands<L, R>
+auto operator-(const L& left, const R& right) {
+    return makeBinary<Minus>(left, right);
+}
+
+template<typename L, typename R>
+    requires VecOperands<L, R>
+auto operator*(const L& left, const R& right) {
+    return makeBinary<Multiplies>(left, right);
+}
+
+template<typename L, typename R>
+    requires VecOperands<L, R>
+auto operator/(const L& left, const R& right) {
+    return makeBinary<Divides>(left, right);
+}
+
+template<VecOperand E>
+auto operator-(const E& operand) {
+    return Unary<Negate, ExpressionOf<E>>{{}, asExpression(operand)};
+}
+
+}  // namespace detail
+
+using detail::operator+;
+using detail::operator-;
+using detail::operator*;
+using detail::operator/;
+
+template<typename L, typename R>
+    requires detail::VecOperands<L, R>
+auto min(const L& left, const R& right) {
+    return detail::makeBinary<detail::Min>(left, right);
+}
+
+template<typename L, typename R>
+    requires detail::VecOperands<L, R>
+auto max(const L& left, const R& right) {
+    return detail::makeBinary<detail::Max>(left, right);
+}
+
+template<detail::VecOperand E>
+auto sqrt(const E& operand) {
+    return detail::Unary<detail::Sqrt, detail::ExpressionOf<E>>{{}, detail::asExpression(operand)};
+}
+
+template<detail::VecOperand E>
+auto abs(const E& operand) {
+    return detail::Unary<detail::Abs, detail::ExpressionOf<E>>{{}, detail::asExpression(operand)};
+}
+
+/**
+ * @brief Sum of the elements of a Vec or expression, evaluated in one pass
+ *
+ * Eight independent partial sums let the compiler keep a vector register
+ * of accumulators without -ffast-math. Floating-point results can differ
+ * from a sequential loop in the last bits.
+ */
+template<detail::VecOperand E>
+auto sum(const E& operand) {
+    const auto expression = detail::asExpression(operand);
+    using T = typename decltype(expression)::value_type;
+    constexpr std::size_t kLanes = 8;
+    T lanes[kLanes] = {};
+    const std::size_t count = expression.size();
+    std::size_t i = 0;
+    for (; i + kLanes <= count; i += kLanes) {
+        for (std::size_t lane = 0; lane < kLanes; ++lane) {
+            lanes[lane] += expression[i + lane];
+        }
+    }
+    T total{};
+    for (; i < count; ++i) {
+        total += expression[i];
+    }
+    for (std::size_t lane = 0; lane < kLanes; ++lane) {
+        total += lanes[lane];
+    }
+    return total;
+}
+
+/// Inner product without materializing the element-wise product.
+template<detail::VecOperand L, detail::VecOperand R>
+auto dot(const L& left, const R& right) {
+    return sum(left * right);
+}
+
+}  // namespace core
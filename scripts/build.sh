@@ -106,6 +106,25 @@ run() {
   ./src/cpp_tutorial
 }
 
+# Function to run benchmarks
+bench() {
+  print_header "Running Benchmarks"
+
+  if [ ! -d "$BUILD_DIR/benchmarks" ]; then
+    print_warning "Benchmarks not built. Building first..."
+    build
+  fi
+
+  for benchmark in "$BUILD_DIR/benchmarks"/bench_*; do
+    if [ -x "$benchmark" ]; then
+      print_warning "Running $(basename "$benchmark")"
+      "$benchmark"
+    fi
+  done
+
+  print_success "Benchmarks completed"
+}
+
 # Function to clean build
 clean() {
   print_header "Cleaning Build"
@@ -192,6 +211,7 @@ Commands:
     build [jobs]              Build the project (default: auto-detect CPU cores)
     test                      Run all tests
     run                       Run the tutorial application
+    bench                     Run the core library benchmarks
     clean                     Clean build directory
     format                    Format all source code with clang-format
     analyze                   Run static analysis with clang-tidy
@@ -228,6 +248,9 @@ test)
 run)
   run
   ;;
+bench)
+  bench
+  ;;
 clean)
   clean
   ;;
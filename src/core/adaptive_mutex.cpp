@@ -0,0 +1,136 @@
+/**
+ * @file adaptive_mutex.cpp
+ * @brief Contended path of core::AdaptiveMutex
+ *
+ * The lock word follows the classic three-state futex mutex
+ * (0 = unlocked, 1 = locked, 2 = locked with possible sleepers), so an
+ * unlock only enters the kernel when somebody may be parked.
+ *
+ * @author Modern C++ Starter Template
+ * @date 2025
+ */
+
+#include "core/adaptive_mutex.hpp"
+#include "core/cpu_relax.hpp"
+#include "core/stress_point.hpp"
+#include <algorithm>
+
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace core {
+
+namespace {
+
+std::atomic<AdaptiveMutex::ContentionHook> contentionHook{nullptr};
+
+constexpr std::uint32_t kMaxBackoff = 64;
+
+static_assert(sizeof(std::atomic<std::uint32_t>) == sizeof(std::uint32_t),
+              "futex word must be a plain 32-bit integer");
+
+void parkWhileEquals(std::atomic<std::uint32_t>& word, std::uint32_t expected) {
+#if defined(__linux__)
+    // Returns immediately (EAGAIN) if the word already changed
+    syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&word), FUTEX_WAIT_PRIVATE, expected,
+            nullptr, nullptr, 0);
+#else
+    word.wait(expected, std::memory_order_relaxed);
+#endif
+}
+
+void wakeOneWaiter(std::atomic<std::uint32_t>& word) {
+#if defined(__linux__)
+    syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&word), FUTEX_WAKE_PRIVATE, 1, nullptr,
+            nullptr, 0);
+#else
+    word.notify_one();
+#endif
+}
+
+void report(const AdaptiveMutex& mutex, AdaptiveMutex::Event event, std::uint32_t spins) {
+    if (auto hook = contentionHook.load(std::memory_order_acquire)) {
+        hook(mutex, event, spins);
+    }
+}
+
+}  // namespace
+
+void AdaptiveMutex::lockSlow() {
+    contended_.fetch_add(1, std::memory_order_relaxed);
+
+    // Spin for roughly twice the typical wait that spinning has paid off for
+    const std::uint32_t estimate = spinEstimate_.load(std::memory_order_relaxed);
+    const std::uint32_t limit = std::clamp(estimate * 2, kMinSpinLimit, kMaxSpinLimit);
+
+    std::uint32_t spins = 0;
+    std::uint32_t backoff = 1;
+    while (spins < limit) {
+        for (std::uint32_t i = 0; i < backoff; ++i) {
+            cpuRelax();
+        }
+        spins += backoff;
+        backoff = std::min(backoff * 2, kMaxBackoff);
+
+        // Test before test-and-set so spinners share the line read-only
+        CORE_STRESS_POINT("adaptive_mutex.spin");
+        if (state_.load(std::memory_order_relaxed) == kUnlocked) {
+            std::uint32_t expected = kUnlocked;
+            if (state_.compare_exchange_weak(expected, kLocked, std::memory_order_acquire,
+                                             std::memory_order_relaxed)) {
+                // Move the estimate 1/8 of the way toward this observation
+                const auto delta = static_cast<std::int64_t>(spins) - estimate;
+                spinEstimate_.store(static_cast<std::uint32_t>(std::clamp<std::int64_t>(
+                                        estimate + delta / 8, kMinSpinLimit, kMaxSpinLimit)),
+                                    std::memory_order_relaxed);
+                spinAcquired_.fetch_add(1, std::memory_order_relaxed);
+                report(*this, Event::SpinAcquired, spins);
+                return;
+            }
+        }
+    }
+
+    // Holds are outlasting the budget: spend less time spinning next time
+    spinEstimate_.store(std::max(kMinSpinLimit, estimate - estimate / 4),
+                        std::memory_order_relaxed);
+    report(*this, Event::Parked, spins);
+    CORE_STRESS_POINT("adaptive_mutex.park");
+
+    std::uint32_t previous = state_.exchange(kLockedWithWaiters, std::memory_order_acquire);
+    while (previous != kUnlocked) {
+        parked_.fetch_add(1, std::memory_order_relaxed);
+        parkWhileEquals(state_, kLockedWithWaiters);
+        previous = state_.exchange(kLockedWithWaiters, std::memory_order_acquire);
+    }
+}
+
+void AdaptiveMutex::wakeOne() {
+    wakeOneWaiter(state_);
+}
+
+AdaptiveMutex::Stats AdaptiveMutex::stats() const {
+    Stats result;
+    result.acquisitions = acquisitions_.load(std::memory_order_relaxed);
+    result.contended = contended_.load(std::memory_order_relaxed);
+    result.spinAcquired = spinAcquired_.load(std::memory_order_relaxed);
+    result.parked = parked_.load(std::memory_order_relaxed);
+    result.spinLimit = std::clamp(spinEstimate_.load(std::memory_order_relaxed) * 2,
+                                  kMinSpinLimit, kMaxSpinLimit);
+    return result;
+}
+
+void AdaptiveMutex::resetStats() {
+    acquisitions_.store(0, std::memory_order_relaxed);
+    contended_.store(0, std::memory_order_relaxed);
+    spinAcquired_.store(0, std::memory_order_relaxed);
+    parked_.store(0, std::memory_order_relaxed);
+}
+
+void AdaptiveMutex::setContentionHook(ContentionHook hook) {
+    contentionHook.store(hook, std::memory_order_release);
+}
+
+}  // namespace core
@@ -0,0 +1,456 @@
+/**
+ * @file alloc_tracker.cpp
+ * @brief Replacement global operator new/delete for core_alloc_tracker
+ *
+ * Each block carries a 16-byte header just before the user pointer holding
+ * its size, the call-site slot it was charged to, the sample weight (0 when
+ * not sampled) and the offset back to the malloc'd base. This lets the
+ * unsized operator delete keep byte counts exact.
+ *
+ * Nothing in the allocation path itself may allocate: counters are
+ * trivially constructible thread_locals and the call-site table is a fixed
+ * open-addressing array updated with atomics.
+ *
+ * @author Modern C++ Starter Template
+ * @date 2025
+ */
+
+#include "core/alloc_tracker.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <new>
+#include <ostream>
+
+#if __has_include(<execinfo.h>)
+#include <execinfo.h>
+#define CORE_ALLOC_HAVE_BACKTRACE 1
+#endif
+
+// The tracker's own frames are dropped from sampled stacks by address:
+// every function between operator new and backtrace() is placed in one
+// ELF section, whose bounds the linker exports. Inlining and tail calls
+// change how many of those frames appear, but not where they live.
+#if defined(__ELF__) && (defined(__GNUC__) || defined(__clang__))
+#define CORE_ALLOC_HOOK [[gnu::noinline, gnu::section("core_alloc_hooks")]]
+#define CORE_ALLOC_HOOK_SECTION 1
+extern "C" const char __start_core_alloc_hooks[];
+extern "C" const char __stop_core_alloc_hooks[];
+#else
+#define CORE_ALLOC_HOOK [[gnu::noinline]]
+#endif
+
+namespace core::alloc {
+
+namespace {
+
+constexpr std::size_t kHeaderSize = 16;
+constexpr std::size_t kMaxSites = 4096;  // power of two
+constexpr int kMaxFrames = 16;
+// At most recordSample, maybeSample, allocate and operator new; exactly
+// those four when the hook section is unavailable
+constexpr int kSkipFrames = 4;
+
+struct Header {
+    std::uint64_t size;
+    std::uint32_t site;
+    std::uint16_t weight;
+    std::uint8_t offsetShift;  // user pointer = base + (1 << offsetShift)
+    std::uint8_t reserved;
+};
+static_assert(sizeof(Header) == kHeaderSize);
+
+struct ThreadState {
+    std::uint64_t allocations;
+    std::uint64_t deallocations;
+    std::uint64_t bytesAllocated;
+    std::uint64_t bytesFreed;
+    std::int64_t live;
+    std::int64_t peak;
+    std::uint32_t untilSample;
+    bool inTracker;
+};
+
+// Zero-initialised and trivially destructible, so usable from any allocation
+constinit thread_local ThreadState threadState{};
+constinit thread_local const AllocationScope* innermostScope = nullptr;
+
+struct Site {
+    std::atomic<std::uint64_t> key{0};  // stack hash; 0 = free slot
+    std::atomic<bool> ready{false};     // frames fully written
+    void* frames[kMaxFrames] = {};
+    int depth = 0;
+    std::atomic<std::uint64_t> allocations{0};
+    std::atomic<std::uint64_t> bytes{0};
+    std::atomic<std::int64_t> live{0};
+    std::atomic<std::int64_t> peak{0};
+};
+
+// Slot 0 collects samples whose stack did not fit in the table
+constinit Site sites[kMaxSites];
+std::atomic<std::uint32_t> sampleEvery{0};
+
+std::uint64_t hashFrames(void* const* frames, int depth) {
+    std::uint64_t hash = 0xCBF29CE484222325ull;
+    for (int i = 0; i < depth; ++i) {
+        hash ^= reinterpret_cast<std::uintptr_t>(frames[i]);
+        hash *= 0x100000001B3ull;
+    }
+    return hash == 0 ? 1 : hash;
+}
+
+std::uint32_t findSite(void* const* frames, int depth) {
+    const std::uint64_t key = hashFrames(frames, depth);
+    std::size_t index = key & (kMaxSites - 1);
+    for (std::size_t probe = 0; probe < kMaxSites; ++probe) {
+        index = (index + 1) & (kMaxSites - 1);
+        if (index == 0) {
+            continue;
+        }
+        Site& site = sites[index];
+        std::uint64_t current = site.key.load(std::memory_order_acquire);
+        if (current == 0 &&
+            site.key.compare_exchange_strong(current, key, std::memory_order_acq_rel)) {
+            std::copy(frames, frames + depth, site.frames);
+            site.depth = depth;
+            site.ready.store(true, std::memory_order_release);
+            return static_cast<std::uint32_t>(index);
+        }
+        if (current == key) {
+            return static_cast<std::uint32_t>(index);
+        }
+    }
+    return 0;
+}
+
+void chargeSite(Site& site, std::int64_t bytes, std::uint64_t weight) {
+    site.allocations.fetch_add(weight, std::memory_order_relaxed);
+    site.bytes.fetch_add(static_cast<std::uint64_t>(bytes), std::memory_order_relaxed);
+    const std::int64_t live = site.live.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+    std::int64_t peak = site.peak.load(std::memory_order_relaxed);
+    while (live > peak &&
+           !site.peak.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+    }
+}
+
+/// Number of leading frames that belong to the tracker itself.
+int trackerFrames(void* const* frames, int depth) {
+#if defined(CORE_ALLOC_HOOK_SECTION)
+    int skip = 0;
+    while (skip < depth) {
+        // A return address points just past its call; step back into it
+        const char* pc = static_cast<const char*>(frames[skip]) - 1;
+        if (pc < __start_core_alloc_hooks || pc >= __stop_core_alloc_hooks) {
+            break;
+        }
+        ++skip;
+    }
+    return skip;
+#else
+    return std::min(depth, kSkipFrames);
+#endif
+}
+
+CORE_ALLOC_HOOK std::uint32_t recordSample(std::size_t size, std::uint32_t weight) {
+    void* frames[kMaxFrames + kSkipFrames];
+    int depth = 0;
+#if defined(CORE_ALLOC_HAVE_BACKTRACE)
+    depth = backtrace(frames, kMaxFrames + kSkipFrames);
+#endif
+    const int skip = trackerFrames(frames, depth);
+    const std::uint32_t index = findSite(frames + skip, depth - skip);
+    chargeSite(sites[index], static_cast<std::int64_t>(size) * weight, weight);
+    return index;
+}
+
+CORE_ALLOC_HOOK void maybeSample(ThreadState& state, Header& header) {
+    const std::uint32_t every = sampleEvery.load(std::memory_order_relaxed);
+    if (every == 0 || state.inTracker) {
+        return;
+    }
+    if (state.untilSample == 0 || state.untilSample > every) {
+        state.untilSample = every;  // first use, or the rate was lowered
+    }
+    if (--state.untilSample != 0) {
+        return;
+    }
+    // backtrace() may allocate on first use; don't sample those allocations
+    state.inTracker = true;
+    header.site = recordSample(header.size, every);
+    header.weight = static_cast<std::uint16_t>(every);
+    state.inTracker = false;
+}
+
+CORE_ALLOC_HOOK void* allocate(std::size_t size, std::size_t alignment, bool nothrow) {
+    const std::size_t offset = std::max(kHeaderSize, alignment);
+    // Header and alignment slack would wrap the block size; fail like malloc would
+    const bool tooLarge = size > std::numeric_limits<std::size_t>::max() - offset - alignment;
+    void* base = nullptr;
+    for (;;) {
+        if (tooLarge) {
+            base = nullptr;
+        } else if (alignment <= alignof(std::max_align_t)) {
+            base = std::malloc(size + offset);
+        } else {
+            const std::size_t total = (size + offset + alignment - 1) / alignment * alignment;
+            base = std::aligned_alloc(alignment, total);
+        }
+        if (base != nullptr) {
+            break;
+        }
+        std::new_handler handler = std::get_new_handler();
+        if (handler == nullptr) {
+            if (nothrow) {
+                return nullptr;
+            }
+            throw std::bad_alloc();
+        }
+        handler();
+    }
+
+    ThreadState& state = threadState;
+    ++state.allocations;
+    state.bytesAllocated += size;
+    state.live += static_cast<std::int64_t>(size);
+    state.peak = std::max(state.peak, state.live);
+
+    auto* user = static_cast<unsigned char*>(base) + offset;
+    Header header{size, 0, 0, static_cast<std::uint8_t>(std::countr_zero(offset)), 0};
+    maybeSample(state, header);
+    std::memcpy(user - kHeaderSize, &header, sizeof(header));
+    return user;
+}
+
+void deallocate(void* ptr) noexcept {
+    if (ptr == nullptr) {
+        return;
+    }
+    auto* user = static_cast<unsigned char*>(ptr);
+    Header header;
+    std::memcpy(&header, user - kHeaderSize, sizeof(header));
+
+    ThreadState& state = threadState;
+    ++state.deallocations;
+    state.bytesFreed += header.size;
+    state.live -= static_cast<std::int64_t>(header.size);
+
+    if (header.weight != 0) {
+        const std::int64_t bytes = static_cast<std::int64_t>(header.size) * header.weight;
+        sites[header.site].live.fetch_sub(bytes, std::memory_order_relaxed);
+    }
+    std::free(user - (std::size_t{1} << header.offsetShift));
+}
+
+/// Keeps the tracker's own reporting allocations out of the call-site table.
+class SamplingPause {
+public:
+    SamplingPause() : previous_(threadState.inTracker) { threadState.inTracker = true; }
+    ~SamplingPause() { threadState.inTracker = previous_; }
+
+private:
+    bool previous_;
+};
+
+}  // namespace
+
+Counters threadCounters() {
+    const ThreadState& state = threadState;
+    Counters counters;
+    counters.allocations = state.allocations;
+    counters.deallocations = state.deallocations;
+    counters.bytesAllocated = state.bytesAllocated;
+    counters.bytesFreed = state.bytesFreed;
+    counters.peakBytes = state.peak;
+    return counters;
+}
+
+AllocationScope::AllocationScope()
+    : start_(threadCounters()), outerPeak_(threadState.peak), parent_(innermostScope) {
+    // Track this scope's own high-water mark from the current live level
+    threadState.peak = threadState.live;
+    start_.peakBytes = threadState.live;
+    innermostScope = this;
+}
+
+AllocationScope::~AllocationScope() {
+    threadState.peak = std::max(threadState.peak, outerPeak_);
+    innermostScope = parent_;
+}
+
+Counters AllocationScope::counters() const {
+    const Counters now = threadCounters();
+    Counters delta;
+    delta.allocations = now.allocations - start_.allocations;
+    delta.deallocations = now.deallocations - start_.deallocations;
+    delta.bytesAllocated = now.bytesAllocated - start_.bytesAllocated;
+    delta.bytesFreed = now.bytesFreed - start_.bytesFreed;
+    // Nested scopes reset the thread peak; fold back what they set aside
+    std::int64_t peak = now.peakBytes;
+    for (const AllocationScope* scope = innermostScope; scope != nullptr && scope != this;
+         scope = scope->parent_) {
+        peak = std::max(peak, scope->outerPeak_);
+    }
+    delta.peakBytes = peak - start_.peakBytes;
+    return delta;
+}
+
+void setSampleRate(std::uint32_t everyN) {
+    sampleEvery.store(std::min<std::uint32_t>(everyN, UINT16_MAX), std::memory_order_relaxed);
+}
+
+std::uint32_t sampleRate() {
+    return sampleEvery.load(std::memory_order_relaxed);
+}
+
+std::vector<CallSite> callSites() {
+    SamplingPause pause;
+    std::vector<CallSite> result;
+    for (std::size_t i = 0; i < kMaxSites; ++i) {
+        const Site& site = sites[i];
+        const std::uint64_t allocations = site.allocations.load(std::memory_order_relaxed);
+        if (allocations == 0) {
+            continue;
+        }
+        CallSite entry;
+        if (site.ready.load(std::memory_order_acquire)) {
+            entry.frames.assign(site.frames, site.frames + site.depth);
+        }
+        entry.allocations = allocations;
+        entry.bytes = site.bytes.load(std::memory_order_relaxed);
+        entry.liveBytes = std::max<std::int64_t>(0, site.live.load(std::memory_order_relaxed));
+        entry.peakBytes = site.peak.load(std::memory_order_relaxed);
+        result.push_back(std::move(entry));
+    }
+    std::sort(result.begin(), result.end(),
+              [](const CallSite& a, const CallSite& b) { return a.bytes > b.bytes; });
+    return result;
+}
+
+void resetCallSites() {
+    for (auto& site : sites) {
+        site.allocations.store(0, std::memory_order_relaxed);
+        site.bytes.store(0, std::memory_order_relaxed);
+        site.peak.store(site.live.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+}
+
+void writeReport(std::ostream& out, std::size_t maxSites) {
+    SamplingPause pause;
+    const auto all = callSites();
+    out << "Allocation call sites (sample rate 1/" << sampleRate() << ", " << all.size()
+        << " recorded)\n";
+    for (std::size_t i = 0; i < std::min(maxSites, all.size()); ++i) {
+        const CallSite& site = all[i];
+        out << "#" << i << ": " << site.allocations << " allocations, " << site.bytes
+            << " bytes, peak " << site.peakBytes << " bytes, live " << site.liveBytes
+            << " bytes\n";
+        if (site.frames.empty()) {
+            out << "    <stack not captured>\n";
+            continue;
+        }
+#if defined(CORE_ALLOC_HAVE_BACKTRACE)
+        const int depth = static_cast<int>(site.frames.size());
+        char** symbols = backtrace_symbols(site.frames.data(), depth);
+        for (std::size_t f = 0; f < site.frames.size(); ++f) {
+            out << "    " << (symbols != nullptr ? symbols[f] : "?") << "\n";
+        }
+        std::free(symbols);
+#else
+        for (void* frame : site.frames) {
+            out << "    " << frame << "\n";
+        }
+#endif
+    }
+}
+
+}  // namespace core::alloc
+
+// Replaceable global allocation functions ([new.delete]); sized and aligned
+// variants all route through the same header-based bookkeeping.
+
+CORE_ALLOC_HOOK void* operator new(std::size_t size) {
+    return core::alloc::allocate(size, 0, false);
+}
+
+CORE_ALLOC_HOOK void* operator new[](std::size_t size) {
+    return core::alloc::allocate(size, 0, false);
+}
+
+CORE_ALLOC_HOOK void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    return core::alloc::allocate(size, 0, true);
+}
+
+CORE_ALLOC_HOOK void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    return core::alloc::allocate(size, 0, true);
+}
+
+CORE_ALLOC_HOOK void* operator new(std::size_t size, std::align_val_t alignment) {
+    return core::alloc::allocate(size, static_cast<std::size_t>(alignment), false);
+}
+
+CORE_ALLOC_HOOK void* operator new[](std::size_t size, std::align_val_t alignment) {
+    return core::alloc::allocate(size, static_cast<std::size_t>(alignment), false);
+}
+
+CORE_ALLOC_HOOK void* operator new(std::size_t size, std::align_val_t alignment,
+                                   const std::nothrow_t&) noexcept {
+    return core::alloc::allocate(size, static_cast<std::size_t>(alignment), true);
+}
+
+CORE_ALLOC_HOOK void* operator new[](std::size_t size, std::align_val_t alignment,
+                                     const std::nothrow_t&) noexcept {
+    return core::alloc::allocate(size, static_cast<std::size_t>(alignment), true);
+}
+
+void operator delete(void* ptr) noexcept {
+    core::alloc::deallocate(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+    core::alloc::deallocate(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    core::alloc::deallocate(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept {
+    core::alloc::deallocate(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept {
+    core::alloc::deallocate(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept {
+    core::alloc::deallocate(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t) noexcept {
+    core::alloc::deallocate(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t) noexcept {
+    core::alloc::deallocate(ptr);
+}
+
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept {
+    core::alloc::deallocate(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept {
+    core::alloc::deallocate(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t, const std::nothrow_t&) noexcept {
+    core::alloc::deallocate(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t, const std::nothrow_t&) noexcept {
+    core::alloc::deallocate(ptr);
+}
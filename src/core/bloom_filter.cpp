@@ -0,0 +1,167 @@
+/**
+ * @file bloom_filter.cpp
+ * @brief Implementation of core::BloomFilter
+ *
+ * @author Modern C++ Starter Template
+ * @date 2025
+ */
+
+#include "core/bloom_filter.hpp"
+
+#include "core/simd.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define CORE_BLOOM_X86 1
+#include <immintrin.h>
+#endif
+
+#if defined(__GNUC__)
+#define CORE_BLOOM_AVX2 __attribute__((target("avx2")))
+#else
+#define CORE_BLOOM_AVX2
+#endif
+
+namespace core {
+
+namespace {
+
+constexpr std::size_t kBlockBits = 256;
+constexpr double kMaxBitsPerKey = 64.0;
+
+// One odd multiplier per word; word i tests bit (key * salt[i]) >> 27.
+// These are the salts of the Parquet split-block Bloom filter.
+constexpr std::uint32_t kSalts[8] = {0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+                                     0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+
+/// Full-avalanche 64-bit finalizer (MurmurHash3 fmix64).
+std::uint64_t mix(std::uint64_t h) noexcept {
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+}
+
+/// False-positive rate of a split-block filter holding @p bitsPerKey bits per key.
+double blockedFalsePositiveRate(double bitsPerKey) {
+    // Keys per block are Poisson distributed; a query fails only if all
+    // eight of its bits are set by the other keys in its block
+    const double lambda = static_cast<double>(kBlockBits) / bitsPerKey;
+    double probability = std::exp(-lambda);
+    double rate = 0.0;
+    const int limit = static_cast<int>(lambda + 10.0 * std::sqrt(lambda) + 20.0);
+    for (int keys = 0; keys <= limit; ++keys) {
+        const double bitSet = 1.0 - std::pow(31.0 / 32.0, keys);
+        rate += probability * std::pow(bitSet, 8);
+        probability *= lambda / (keys + 1);
+    }
+    return rate;
+}
+
+void insertScalar(std::uint32_t* words, std::uint32_t key) noexcept {
+    for (int i = 0; i < 8; ++i) {
+        words[i] |= 1u << ((key * kSalts[i]) >> 27);
+    }
+}
+
+bool containsScalar(const std::uint32_t* words, std::uint32_t key) noexcept {
+    bool all = true;
+    for (int i = 0; i < 8; ++i) {
+        all &= (words[i] >> ((key * kSalts[i]) >> 27) & 1) != 0;
+    }
+    return all;
+}
+
+#if defined(CORE_BLOOM_X86)
+
+CORE_BLOOM_AVX2
+__m256i bitMask(std::uint32_t key) noexcept {
+    const __m256i salts = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(kSalts));
+    const __m256i keys = _mm256_set1_epi32(static_cast<int>(key));
+    const __m256i shifts = _mm256_srli_epi32(_mm256_mullo_epi32(keys, salts), 27);
+    return _mm256_sllv_epi32(_mm256_set1_epi32(1), shifts);
+}
+
+CORE_BLOOM_AVX2
+void insertAvx2(std::uint32_t* words, std::uint32_t key) noexcept {
+    auto* block = reinterpret_cast<__m256i*>(words);
+    _mm256_store_si256(block, _mm256_or_si256(_mm256_load_si256(block), bitMask(key)));
+}
+
+CORE_BLOOM_AVX2
+bool containsAvx2(const std::uint32_t* words, std::uint32_t key) noexcept {
+    // testc: every bit of the mask is also set in the block
+    const __m256i block = _mm256_load_si256(reinterpret_cast<const __m256i*>(words));
+    return _mm256_testc_si256(block, bitMask(key)) != 0;
+}
+
+#endif
+
+}  // namespace
+
+BloomFilter::BloomFilter(std::size_t expectedItems, double falsePositiveRate)
+    : expectedItems_(std::max<std::size_t>(expectedItems, 1)),
+      useAvx2_(simd::activeLevel() >= simd::Level::kAVX2) {
+    if (!(falsePositiveRate > 0.0 && falsePositiveRate < 1.0)) {
+        throw std::invalid_argument("BloomFilter: false-positive rate must be in (0, 1)");
+    }
+    // Smallest size (in quarter bits per key) that meets the target
+    double bitsPerKey = 2.0;
+    while (bitsPerKey < kMaxBitsPerKey &&
+           blockedFalsePositiveRate(bitsPerKey) > falsePositiveRate) {
+        bitsPerKey += 0.25;
+    }
+    const double bits = bitsPerKey * static_cast<double>(expectedItems_);
+    const auto blocks = static_cast<std::size_t>(std::ceil(bits / kBlockBits));
+    blocks_.assign(std::max<std::size_t>(blocks, 1), Block{});
+}
+
+const BloomFilter::Block& BloomFilter::blockFor(std::uint64_t hash) const noexcept {
+    // Multiply-shift maps the high half onto [0, blocks) without a division
+    const std::uint64_t index = ((hash >> 32) * blocks_.size()) >> 32;
+    return blocks_[static_cast<std::size_t>(index)];
+}
+
+void BloomFilter::insertHash(std::uint64_t hash) noexcept {
+    hash = mix(hash);
+    auto* words = const_cast<Block&>(blockFor(hash)).words;
+    const auto key = static_cast<std::uint32_t>(hash);
+#if defined(CORE_BLOOM_X86)
+    if (useAvx2_) {
+        insertAvx2(words, key);
+        return;
+    }
+#endif
+    insertScalar(words, key);
+}
+
+bool BloomFilter::mayContainHash(std::uint64_t hash) const noexcept {
+    hash = mix(hash);
+    const auto* words = blockFor(hash).words;
+    const auto key = static_cast<std::uint32_t>(hash);
+#if defined(CORE_BLOOM_X86)
+    if (useAvx2_) {
+        return containsAvx2(words, key);
+    }
+#endif
+    return containsScalar(words, key);
+}
+
+void BloomFilter::clear() noexcept {
+    std::fill(blocks_.begin(), blocks_.end(), Block{});
+}
+
+double BloomFilter::bitsPerKey() const noexcept {
+    return static_cast<double>(blocks_.size() * kBlockBits) / static_cast<double>(expectedItems_);
+}
+
+double BloomFilter::expectedFalsePositiveRate() const noexcept {
+    return blockedFalsePositiveRate(bitsPerKey());
+}
+
+}  // namespace core
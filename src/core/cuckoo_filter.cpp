@@ -0,0 +1,236 @@
+/**
+ * @file cuckoo_filter.cpp
+ * @brief Implementation of core::CuckooFilter
+ *
+ * @author Modern C++ Starter Template
+ * @date 2025
+ */
+
+#include "core/cuckoo_filter.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+
+namespace core {
+
+namespace {
+
+constexpr int kMaxKicks = 500;
+constexpr double kMaxLoad = 0.96;
+
+/// Full-avalanche 64-bit finalizer (MurmurHash3 fmix64).
+std::uint64_t mix(std::uint64_t h) noexcept {
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+}
+
+// Slot helpers for one fingerprint width; a bucket is four adjacent slots
+template<typename Slot>
+std::uint32_t loadSlot(const std::uint8_t* bucket, std::size_t slot) noexcept {
+    Slot value;
+    std::memcpy(&value, bucket + slot * sizeof(Slot), sizeof(Slot));
+    return value;
+}
+
+template<typename Slot>
+void storeSlot(std::uint8_t* bucket, std::size_t slot, std::uint32_t value) noexcept {
+    const auto narrow = static_cast<Slot>(value);
+    std::memcpy(bucket + slot * sizeof(Slot), &narrow, sizeof(Slot));
+}
+
+template<typename Slot>
+bool bucketHolds(const std::uint8_t* bucket, std::uint32_t fingerprint) noexcept {
+    if constexpr (sizeof(Slot) <= 2) {
+        // All four slots fit one word: XOR with the broadcast fingerprint
+        // and look for a zero lane (the classic "has zero byte" test)
+        using Word = std::conditional_t<sizeof(Slot) == 1, std::uint32_t, std::uint64_t>;
+        constexpr Word kLow = static_cast<Word>(~Word{0}) / static_cast<Slot>(~Slot{0});
+        constexpr Word kHigh = kLow << (sizeof(Slot) * 8 - 1);
+        Word word;
+        std::memcpy(&word, bucket, sizeof(Word));
+        const Word x = word ^ (kLow * fingerprint);
+        return ((x - kLow) & ~x & kHigh) != 0;
+    } else {
+        bool found = false;
+        for (std::size_t slot = 0; slot < 4; ++slot) {
+            found |= loadSlot<Slot>(bucket, slot) == fingerprint;
+        }
+        return found;
+    }
+}
+
+/// Calls @p fn with a value of the slot type matching @p bytes.
+template<typename Fn>
+decltype(auto) withSlot(unsigned bytes, Fn&& fn) {
+    switch (bytes) {
+        case 1:
+            return fn(std::uint8_t{});
+        case 2:
+            return fn(std::uint16_t{});
+        default:
+            return fn(std::uint32_t{});
+    }
+}
+
+}  // namespace
+
+CuckooFilter::CuckooFilter(std::size_t capacity, double falsePositiveRate) {
+    if (!(falsePositiveRate > 0.0 && falsePositiveRate < 1.0)) {
+        throw std::invalid_argument("CuckooFilter: false-positive rate must be in (0, 1)");
+    }
+    // A query compares against 2 buckets x 4 slots, each matching with 2^-bits
+    const double bits = std::ceil(std::log2(2.0 * kSlotsPerBucket / falsePositiveRate));
+    fingerprintBytes_ = bits <= 8 ? 1 : bits <= 16 ? 2 : 4;
+
+    const std::size_t wanted = std::max<std::size_t>(capacity, 1);
+    std::size_t buckets = std::bit_ceil((wanted + kSlotsPerBucket - 1) / kSlotsPerBucket);
+    if (static_cast<double>(wanted) > kMaxLoad * static_cast<double>(buckets * kSlotsPerBucket)) {
+        buckets *= 2;
+    }
+    mask_ = buckets - 1;
+    table_.assign(buckets * kSlotsPerBucket * fingerprintBytes_, 0);
+}
+
+std::pair<std::size_t, std::uint32_t> CuckooFilter::locate(std::uint64_t hash) const noexcept {
+    // Low bits pick the first bucket, high bits give the fingerprint
+    hash = mix(hash);
+    auto fingerprint = static_cast<std::uint32_t>(hash >> 32);
+    if (fingerprintBytes_ < 4) {
+        fingerprint &= (1u << (fingerprintBytes_ * 8)) - 1;
+    }
+    fingerprint += fingerprint == 0;  // zero marks an empty slot
+    return {static_cast<std::size_t>(hash) & mask_, fingerprint};
+}
+
+std::size_t CuckooFilter::alternate(std::size_t index, std::uint32_t fingerprint) const noexcept {
+    // XOR with a function of the fingerprint alone is its own inverse, so
+    // either bucket leads to the other
+    return (index ^ static_cast<std::size_t>(fingerprint * 0x5bd1e995U)) & mask_;
+}
+
+bool CuckooFilter::bucketHas(std::size_t index, std::uint32_t fingerprint) const noexcept {
+    return withSlot(fingerprintBytes_, [&](auto slot) {
+        return bucketHolds<decltype(slot)>(bucket(index), fingerprint);
+    });
+}
+
+bool CuckooFilter::bucketAdd(std::size_t index, std::uint32_t fingerprint) noexcept {
+    return withSlot(fingerprintBytes_, [&](auto slotType) {
+        using Slot = decltype(slotType);
+        std::uint8_t* b = bucket(index);
+        for (std::size_t slot = 0; slot < kSlotsPerBucket; ++slot) {
+            if (loadSlot<Slot>(b, slot) == 0) {
+                storeSlot<Slot>(b, slot, fingerprint);
+                return true;
+            }
+        }
+        return false;
+    });
+}
+
+bool CuckooFilter::bucketRemove(std::size_t index, std::uint32_t fingerprint) noexcept {
+    return withSlot(fingerprintBytes_, [&](auto slotType) {
+        using Slot = decltype(slotType);
+        std::uint8_t* b = bucket(index);
+        for (std::size_t slot = 0; slot < kSlotsPerBucket; ++slot) {
+            if (loadSlot<Slot>(b, slot) == fingerprint) {
+                storeSlot<Slot>(b, slot, 0);
+                return true;
+            }
+        }
+        return false;
+    });
+}
+
+void CuckooFilter::relocate(std::size_t index, std::uint32_t fingerprint) noexcept {
+    // Both buckets are full: evict a random resident to its other bucket,
+    // and repeat with the evicted fingerprint
+    for (int kick = 0; kick < kMaxKicks; ++kick) {
+        rng_ ^= rng_ << 13;
+        rng_ ^= rng_ >> 7;
+        rng_ ^= rng_ << 17;
+        const std::size_t slot = rng_ % kSlotsPerBucket;
+        withSlot(fingerprintBytes_, [&](auto slotType) {
+            using Slot = decltype(slotType);
+            const std::uint32_t evicted = loadSlot<Slot>(bucket(index), slot);
+            storeSlot<Slot>(bucket(index), slot, fingerprint);
+            fingerprint = evicted;
+        });
+        index = alternate(index, fingerprint);
+        if (bucketAdd(index, fingerprint)) {
+            return;
+        }
+    }
+    // Keep the homeless fingerprint so no key is lost; the filter is now full
+    victim_ = Victim{index, fingerprint, true};
+}
+
+bool CuckooFilter::insertHash(std::uint64_t hash) {
+    if (victim_.used) {
+        return false;
+    }
+    const auto [first, fingerprint] = locate(hash);
+    if (!bucketAdd(first, fingerprint) && !bucketAdd(alternate(first, fingerprint), fingerprint)) {
+        relocate(first, fingerprint);
+    }
+    ++size_;
+    return true;
+}
+
+bool CuckooFilter::containsHash(std::uint64_t hash) const noexcept {
+    const auto [first, fingerprint] = locate(hash);
+    const std::size_t second = alternate(first, fingerprint);
+    if (bucketHas(first, fingerprint) || bucketHas(second, fingerprint)) {
+        return true;
+    }
+    return victim_.used && victim_.fingerprint == fingerprint &&
+           (victim_.bucket == first || victim_.bucket == second);
+}
+
+bool CuckooFilter::eraseHash(std::uint64_t hash) noexcept {
+    const auto [first, fingerprint] = locate(hash);
+    const std::size_t second = alternate(first, fingerprint);
+    if (victim_.used && victim_.fingerprint == fingerprint &&
+        (victim_.bucket == first || victim_.bucket == second)) {
+        victim_.used = false;
+        --size_;
+        return true;
+    }
+    if (!bucketRemove(first, fingerprint) && !bucketRemove(second, fingerprint)) {
+        return false;
+    }
+    --size_;
+    // A slot just opened up: give the stashed victim another chance
+    if (victim_.used) {
+        const Victim victim = victim_;
+        victim_.used = false;
+        if (!bucketAdd(victim.bucket, victim.fingerprint) &&
+            !bucketAdd(alternate(victim.bucket, victim.fingerprint), victim.fingerprint)) {
+            relocate(victim.bucket, victim.fingerprint);
+        }
+    }
+    return true;
+}
+
+void CuckooFilter::clear() noexcept {
+    std::fill(table_.begin(), table_.end(), std::uint8_t{0});
+    size_ = 0;
+    victim_ = Victim{};
+}
+
+double CuckooFilter::expectedFalsePositiveRate() const noexcept {
+    // Each of the 8 compared slots matches a random fingerprint with
+    // probability 1 / (2^bits - 1); zero is never a fingerprint
+    const double values = std::ldexp(1.0, static_cast<int>(fingerprintBits())) - 1.0;
+    return 1.0 - std::pow(1.0 - 1.0 / values, 2.0 * kSlotsPerBucket);
+}
+
+}  // namespace core
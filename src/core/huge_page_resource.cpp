@@ -0,0 +1,233 @@
+/**
+ * @file huge_page_resource.cpp
+ * @brief Implementation of core::HugePageResource
+ *
+ * @author Modern C++ Starter Template
+ * @date 2025
+ */
+
+#include "core/huge_page_resource.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <limits>
+#include <new>
+#include <ostream>
+#include <sstream>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace core {
+
+namespace {
+
+#if defined(__linux__)
+
+// Maps bytes + slack and trims both ends so the result is alignment-aligned
+void* mapAligned(std::size_t bytes, std::size_t alignment) {
+    const std::size_t length = bytes + alignment;
+    void* raw = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (raw == MAP_FAILED) {
+        return nullptr;
+    }
+    const auto start = reinterpret_cast<std::uintptr_t>(raw);
+    const std::uintptr_t aligned = (start + alignment - 1) & ~(std::uintptr_t{alignment} - 1);
+    const std::size_t head = aligned - start;
+    const std::size_t tail = length - head - bytes;
+    if (head != 0) {
+        munmap(raw, head);
+    }
+    if (tail != 0) {
+        munmap(reinterpret_cast<void*>(aligned + bytes), tail);
+    }
+    return reinterpret_cast<void*>(aligned);
+}
+
+bool isMappingHeader(const std::string& line) {
+    // "7f12a0000000-7f12a0200000 rw-p ..."; field lines start with a capital
+    return !line.empty() &&
+           ((line[0] >= '0' && line[0] <= '9') || (line[0] >= 'a' && line[0] <= 'f'));
+}
+
+#endif
+
+std::uint64_t readMeminfoField(const std::string& name) {
+    std::ifstream meminfo("/proc/meminfo");
+    std::string line;
+    while (std::getline(meminfo, line)) {
+        if (line.compare(0, name.size(), name) == 0 && line.size() > name.size() &&
+            line[name.size()] == ':') {
+            std::istringstream fields(line.substr(name.size() + 1));
+            std::uint64_t value = 0;
+            std::string unit;
+            fields >> value >> unit;
+            return unit == "kB" ? value * 1024 : value;
+        }
+    }
+    return 0;
+}
+
+std::string readTransparentMode() {
+    // The active mode is the bracketed one: "always [madvise] never"
+    std::ifstream enabled("/sys/kernel/mm/transparent_hugepage/enabled");
+    std::string modes;
+    if (std::getline(enabled, modes)) {
+        const auto open = modes.find('[');
+        const auto close = modes.find(']', open);
+        if (open != std::string::npos && close != std::string::npos) {
+            return modes.substr(open + 1, close - open - 1);
+        }
+    }
+    return "unsupported";
+}
+
+}  // namespace
+
+HugePageResource::HugePageResource(Policy policy)
+    : policy_(policy), transparentEnabled_(readTransparentMode() != "never") {}
+
+void* HugePageResource::do_allocate(std::size_t bytes, std::size_t alignment) {
+    // Rounding up to a huge page, or adding the alignment slack, must not wrap
+    constexpr std::size_t kMaxSize = std::numeric_limits<std::size_t>::max();
+    if (bytes > kMaxSize - kHugePageSize) {
+        throw std::bad_alloc();
+    }
+    const std::size_t length = roundUp(std::max<std::size_t>(bytes, 1));
+    const std::size_t mapAlignment = std::max(alignment, kHugePageSize);
+    if (length > kMaxSize - mapAlignment) {
+        throw std::bad_alloc();
+    }
+
+#if defined(__linux__)
+    if (policy_ == Policy::Auto && mapAlignment == kHugePageSize) {
+        void* pointer = mmap(nullptr, length, PROT_READ | PROT_WRITE,
+                             MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (pointer != MAP_FAILED) {
+            count(Backing::Hugetlb, length);
+            return pointer;
+        }
+        // No reserved pages (the common case): fall through to THP
+    }
+
+    void* pointer = mapAligned(length, mapAlignment);
+    if (pointer == nullptr) {
+        throw std::bad_alloc();
+    }
+    // madvise succeeds even when THP is set to "never", so check the mode too
+    if (madvise(pointer, length, MADV_HUGEPAGE) == 0 && transparentEnabled_) {
+        count(Backing::Transparent, length);
+    } else {
+        count(Backing::Regular, length);
+    }
+    return pointer;
+#else
+    void* pointer = ::operator new(length, std::align_val_t{mapAlignment});
+    count(Backing::Regular, length);
+    return pointer;
+#endif
+}
+
+void HugePageResource::do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) {
+    const std::size_t length = roundUp(std::max<std::size_t>(bytes, 1));
+    bytesMapped_.fetch_sub(length, std::memory_order_relaxed);
+#if defined(__linux__)
+    static_cast<void>(alignment);
+    munmap(pointer, length);
+#else
+    ::operator delete(pointer, std::align_val_t{std::max(alignment, kHugePageSize)});
+#endif
+}
+
+bool HugePageResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+    return this == &other;
+}
+
+void HugePageResource::count(Backing backing, std::size_t bytes) noexcept {
+    switch (backing) {
+        case Backing::Hugetlb:
+            hugetlb_.fetch_add(1, std::memory_order_relaxed);
+            break;
+        case Backing::Transparent:
+            transparent_.fetch_add(1, std::memory_order_relaxed);
+            break;
+        case Backing::Regular:
+            regular_.fetch_add(1, std::memory_order_relaxed);
+            break;
+    }
+    bytesMapped_.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+HugePageResource::Stats HugePageResource::stats() const noexcept {
+    Stats result;
+    result.hugetlb = hugetlb_.load(std::memory_order_relaxed);
+    result.transparent = transparent_.load(std::memory_order_relaxed);
+    result.regular = regular_.load(std::memory_order_relaxed);
+    result.bytesMapped = bytesMapped_.load(std::memory_order_relaxed);
+    return result;
+}
+
+std::size_t HugePageResource::hugeBytesAt(const void* pointer) {
+#if defined(__linux__)
+    const auto address = reinterpret_cast<std::uintptr_t>(pointer);
+    std::ifstream smaps("/proc/self/smaps");
+    std::string line;
+    bool inMapping = false;
+    std::size_t total = 0;
+    while (std::getline(smaps, line)) {
+        if (isMappingHeader(line)) {
+            if (inMapping) {
+                break;
+            }
+            std::uintptr_t start = 0;
+            std::uintptr_t end = 0;
+            char dash = 0;
+            std::istringstream range(line);
+            range >> std::hex >> start >> dash >> end;
+            inMapping = address >= start && address < end;
+            continue;
+        }
+        if (!inMapping) {
+            continue;
+        }
+        for (const char* field : {"AnonHugePages:", "Private_Hugetlb:", "Shared_Hugetlb:"}) {
+            const std::string name(field);
+            if (line.compare(0, name.size(), name) == 0) {
+                std::istringstream value(line.substr(name.size()));
+                std::size_t kilobytes = 0;
+                value >> kilobytes;
+                total += kilobytes * 1024;
+            }
+        }
+    }
+    return total;
+#else
+    static_cast<void>(pointer);
+    return 0;
+#endif
+}
+
+HugePageResource::SystemInfo HugePageResource::systemInfo() {
+    SystemInfo info;
+    info.transparentMode = readTransparentMode();
+    info.reservedFree = readMeminfoField("HugePages_Free");
+    info.reservedPageBytes = readMeminfoField("Hugepagesize");
+    return info;
+}
+
+void HugePageResource::writeReport(std::ostream& out) const {
+    const SystemInfo info = systemInfo();
+    const Stats current = stats();
+    out << "transparent huge pages: " << info.transparentMode << "\n"
+        << "reserved huge pages free: " << info.reservedFree << " x "
+        << info.reservedPageBytes / 1024 << " KiB\n"
+        << "allocations: " << current.hugetlb << " hugetlb, " << current.transparent
+        << " transparent, " << current.regular << " regular\n"
+        << "mapped: " << current.bytesMapped / 1024 << " KiB\n";
+    if (current.regular != 0) {
+        out << "note: huge pages unavailable for some allocations; regular pages used\n";
+    }
+}
+
+}  // namespace core
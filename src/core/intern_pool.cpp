@@ -0,0 +1,195 @@
+/**
+ * @file intern_pool.cpp
+ * @brief Implementation of core::InternPool
+ *
+ * Readers never take the mutex. A writer publishes in this order: string
+ * bytes and Entry, then count_, then the table slot (release). A reader that
+ * acquires the slot therefore sees a complete entry. When the table grows, the
+ * old one stays allocated until the pool dies, so a reader still probing it
+ * is safe; it may simply miss strings added after it loaded the pointer.
+ *
+ * @author Modern C++ Starter Template
+ * @date 2025
+ */
+
+#include "core/intern_pool.hpp"
+
+#include <bit>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+namespace core {
+
+namespace {
+
+constexpr std::size_t kInitialCapacity = 256;  // slots, power of two
+constexpr std::size_t kChunkBytes = 64 * 1024;
+
+std::uint64_t hashText(std::string_view text) noexcept {
+    return std::hash<std::string_view>{}(text);
+}
+
+std::uint64_t packSlot(std::uint64_t hash, std::uint32_t id) noexcept {
+    return (hash & 0xFFFF'FFFF'0000'0000ull) | id;
+}
+
+struct EntryPosition {
+    std::size_t segment;
+    std::size_t offset;
+};
+
+// Segment k holds 2^(k + firstBits) entries, so entry i lands at a fixed place
+EntryPosition positionOf(std::uint32_t id, std::size_t firstBits) noexcept {
+    const std::size_t index = std::size_t{id} - 1 + (std::size_t{1} << firstBits);
+    const auto segment = static_cast<std::size_t>(std::bit_width(index)) - 1 - firstBits;
+    return {segment, index - (std::size_t{1} << (segment + firstBits))};
+}
+
+}  // namespace
+
+InternPool::Table::Table(std::size_t capacity)
+    : mask(capacity - 1), slots(new std::atomic<std::uint64_t>[capacity]) {
+    for (std::size_t i = 0; i < capacity; ++i) {
+        slots[i].store(0, std::memory_order_relaxed);
+    }
+}
+
+InternPool::InternPool() {
+    tables_.push_back(std::make_unique<Table>(kInitialCapacity));
+    table_.store(tables_.back().get(), std::memory_order_release);
+}
+
+InternPool::~InternPool() {
+    for (auto& segment : segments_) {
+        delete[] segment.load(std::memory_order_relaxed);
+    }
+}
+
+InternPool& InternPool::global() {
+    // Never destroyed, so symbols stay readable from other static destructors
+    static InternPool* pool = new InternPool;
+    return *pool;
+}
+
+const InternPool::Entry* InternPool::entry(std::uint32_t id) const noexcept {
+    const EntryPosition position = positionOf(id, kFirstSegmentBits);
+    return segments_[position.segment].load(std::memory_order_acquire) + position.offset;
+}
+
+Symbol InternPool::findIn(const Table& table, std::string_view text,
+                          std::uint64_t hash) const noexcept {
+    for (std::size_t i = hash & table.mask;; i = (i + 1) & table.mask) {
+        const std::uint64_t slot = table.slots[i].load(std::memory_order_acquire);
+        if (slot == 0) {
+            return Symbol();
+        }
+        if ((slot ^ hash) >> 32 == 0) {
+            const auto id = static_cast<std::uint32_t>(slot);
+            const Entry* e = entry(id);
+            if (e->length == text.size() && std::memcmp(e->data, text.data(), text.size()) == 0) {
+                return Symbol(id);
+            }
+        }
+    }
+}
+
+void InternPool::insertSlot(Table& table, std::uint64_t hash, std::uint32_t id) noexcept {
+    std::size_t i = hash & table.mask;
+    while (table.slots[i].load(std::memory_order_relaxed) != 0) {
+        i = (i + 1) & table.mask;
+    }
+    table.slots[i].store(packSlot(hash, id), std::memory_order_release);
+}
+
+const char* InternPool::storeText(std::string_view text) {
+    const std::size_t needed = text.size() + 1;  // keep a NUL for C APIs
+    char* stored = nullptr;
+    if (needed > kChunkBytes) {
+        // Oversized strings get a private chunk; the current one keeps filling
+        chunks_.push_back(std::make_unique<char[]>(needed));
+        arenaBytes_ += needed;
+        stored = chunks_.back().get();
+    } else {
+        if (needed > chunkRemaining_) {
+            chunks_.push_back(std::make_unique<char[]>(kChunkBytes));
+            arenaBytes_ += kChunkBytes;
+            chunkCursor_ = chunks_.back().get();
+            chunkRemaining_ = kChunkBytes;
+        }
+        stored = chunkCursor_;
+        chunkCursor_ += needed;
+        chunkRemaining_ -= needed;
+    }
+    std::memcpy(stored, text.data(), text.size());
+    stored[text.size()] = '\0';
+    return stored;
+}
+
+Symbol InternPool::intern(std::string_view text) {
+    const std::uint64_t hash = hashText(text);
+    if (Symbol found = findIn(*table_.load(std::memory_order_acquire), text, hash)) {
+        return found;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    Table* table = tables_.back().get();
+    if (Symbol found = findIn(*table, text, hash)) {
+        return found;  // another thread added it first
+    }
+    if (text.size() > std::numeric_limits<std::uint32_t>::max()) {
+        throw std::length_error("InternPool: string too long");
+    }
+    const std::uint32_t count = count_.load(std::memory_order_relaxed);
+    if (count == std::numeric_limits<std::uint32_t>::max()) {
+        throw std::length_error("InternPool: symbol space exhausted");
+    }
+    const std::uint32_t id = count + 1;
+
+    // Allocate everything that can throw before the new id becomes visible.
+    // The load factor stays at or below one half so probes stay short.
+    std::unique_ptr<Table> grown;
+    if (std::size_t{id} * 2 > table->mask + 1) {
+        grown = std::make_unique<Table>((table->mask + 1) * 2);
+    }
+    const EntryPosition position = positionOf(id, kFirstSegmentBits);
+    std::atomic<Entry*>& segment = segments_[position.segment];
+    if (segment.load(std::memory_order_relaxed) == nullptr) {
+        const std::size_t segmentSize = std::size_t{1} << (position.segment + kFirstSegmentBits);
+        segment.store(new Entry[segmentSize], std::memory_order_release);
+    }
+    segment.load(std::memory_order_relaxed)[position.offset] =
+        Entry{storeText(text), static_cast<std::uint32_t>(text.size()), hash};
+    count_.store(id, std::memory_order_release);
+
+    if (grown) {
+        for (std::uint32_t existing = 1; existing <= id; ++existing) {
+            insertSlot(*grown, entry(existing)->hash, existing);
+        }
+        table = grown.get();
+        tables_.push_back(std::move(grown));
+        table_.store(table, std::memory_order_release);
+    } else {
+        insertSlot(*table, hash, id);
+    }
+    return Symbol(id);
+}
+
+Symbol InternPool::find(std::string_view text) const noexcept {
+    return findIn(*table_.load(std::memory_order_acquire), text, hashText(text));
+}
+
+std::string_view InternPool::view(Symbol symbol) const noexcept {
+    if (!symbol.valid() || symbol.id() > count_.load(std::memory_order_acquire)) {
+        return {};
+    }
+    const Entry* e = entry(symbol.id());
+    return {e->data, e->length};
+}
+
+std::size_t InternPool::arenaBytes() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return arenaBytes_;
+}
+
+}  // namespace core
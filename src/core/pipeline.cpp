@@ -0,0 +1,287 @@
+/**
+ * @file pipeline.cpp
+ * @brief Scheduling loop of core::Pipeline
+ *
+ * Every worker runs the same loop: walk the stages from sink to source and
+ * do whatever work is available, so items already in flight drain before new
+ * ones are admitted. Serial stages are claimed with a per-stage busy flag.
+ * Because no more than maxTokens items exist at once, the inter-stage queues
+ * (capacity maxTokens) can never overflow.
+ *
+ * @author Modern C++ Starter Template
+ * @date 2025
+ */
+
+#include "core/pipeline.hpp"
+#include "core/cpu_relax.hpp"
+#include "core/stress_point.hpp"
+#include <algorithm>
+#include <thread>
+
+namespace core {
+
+namespace {
+
+constexpr int kSpinsBeforeYield = 64;
+constexpr int kSerialBatch = 16;
+
+// Claims a serial stage; released by BusyGuard's destructor
+class BusyGuard {
+public:
+    explicit BusyGuard(std::atomic<bool>& flag)
+        : flag_(flag), owned_(!flag.exchange(true, std::memory_order_acquire)) {}
+
+    ~BusyGuard() {
+        if (owned_) {
+            flag_.store(false, std::memory_order_release);
+        }
+    }
+
+    BusyGuard(const BusyGuard&) = delete;
+    BusyGuard& operator=(const BusyGuard&) = delete;
+
+    bool owned() const { return owned_; }
+
+private:
+    std::atomic<bool>& flag_;
+    bool owned_;
+};
+
+}  // namespace
+
+Pipeline::Pipeline(std::size_t maxTokens)
+    : slots_(std::max<std::size_t>(1, maxTokens)),
+      freeSlots_(std::make_unique<BoundedQueue<std::uint32_t>>(slots_.size())) {}
+
+Pipeline::~Pipeline() = default;
+
+void Pipeline::addStageImpl(std::string name, StageMode mode,
+                            std::function<bool(std::any&)> body, bool isSource) {
+    if (hasSink_) {
+        throw std::runtime_error("Pipeline already has a sink: " + stages_.back()->name);
+    }
+    if (isSource != stages_.empty()) {
+        throw std::runtime_error(isSource ? "Pipeline already has a source"
+                                          : "Pipeline source must be added first");
+    }
+    auto stage = std::make_unique<Stage>();
+    stage->name = std::move(name);
+    stage->mode = mode;
+    stage->body = std::move(body);
+    stage->input = std::make_unique<BoundedQueue<std::uint32_t>>(slots_.size());
+    stage->reorder.assign(slots_.size(), -1);
+    stages_.push_back(std::move(stage));
+}
+
+void Pipeline::run(ThreadPool& pool) {
+    if (stages_.size() < 2 || !hasSink_) {
+        throw std::runtime_error("Pipeline needs a source and a sink");
+    }
+
+    // Reset per-run state (a failed run may have left items behind)
+    freeSlots_ = std::make_unique<BoundedQueue<std::uint32_t>>(slots_.size());
+    for (std::size_t i = 0; i < slots_.size(); ++i) {
+        slots_[i].payload.reset();
+        freeSlots_->tryPush(static_cast<std::uint32_t>(i));
+    }
+    for (auto& stage : stages_) {
+        stage->input = std::make_unique<BoundedQueue<std::uint32_t>>(slots_.size());
+        stage->busy = false;
+        stage->nextSequence = 0;
+        std::fill(stage->reorder.begin(), stage->reorder.end(), -1);
+        stage->buffered = 0;
+        stage->processed = 0;
+        stage->busyNanos = 0;
+        stage->maxDepth = 0;
+    }
+    sourceDone_ = false;
+    failed_ = false;
+    inFlight_ = 0;
+    nextSequence_ = 0;
+
+    const auto start = std::chrono::steady_clock::now();
+    try {
+        pool.parallelFor(pool.size() + 1, [this](std::size_t) { workerLoop(); });
+    } catch (...) {
+        lastRunTime_ = std::chrono::steady_clock::now() - start;
+        throw;
+    }
+    lastRunTime_ = std::chrono::steady_clock::now() - start;
+}
+
+void Pipeline::workerLoop() {
+    int idle = 0;
+    try {
+        while (!finished()) {
+            bool worked = false;
+            for (std::size_t i = stages_.size() - 1; i > 0; --i) {
+                worked |= runStage(i);
+            }
+            worked |= runSource();
+
+            if (worked) {
+                idle = 0;
+            } else if (++idle < kSpinsBeforeYield) {
+                cpuRelax();
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    } catch (...) {
+        failed_.store(true, std::memory_order_release);
+        throw;
+    }
+}
+
+bool Pipeline::finished() const {
+    return failed_.load(std::memory_order_acquire) ||
+           (sourceDone_.load(std::memory_order_acquire) &&
+            inFlight_.load(std::memory_order_acquire) == 0);
+}
+
+bool Pipeline::runSource() {
+    if (sourceDone_.load(std::memory_order_acquire)) {
+        return false;
+    }
+    Stage& source = *stages_.front();
+    BusyGuard guard(source.busy);
+    if (!guard.owned() || sourceDone_.load(std::memory_order_relaxed)) {
+        return false;
+    }
+
+    std::uint32_t slot = 0;
+    if (!freeSlots_->tryPop(slot)) {
+        return false;  // every token is in flight
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    bool produced = false;
+    try {
+        produced = source.body(slots_[slot].payload);
+    } catch (...) {
+        freeSlots_->tryPush(slot);
+        throw;
+    }
+    source.busyNanos.fetch_add(static_cast<std::uint64_t>(
+                                   std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                       std::chrono::steady_clock::now() - start)
+                                       .count()),
+                               std::memory_order_relaxed);
+
+    if (!produced) {
+        freeSlots_->tryPush(slot);
+        sourceDone_.store(true, std::memory_order_release);
+        return true;
+    }
+
+    slots_[slot].sequence = nextSequence_++;
+    source.processed.fetch_add(1, std::memory_order_relaxed);
+    inFlight_.fetch_add(1, std::memory_order_acq_rel);
+    forward(0, slot);
+    return true;
+}
+
+bool Pipeline::runStage(std::size_t index) {
+    Stage& stage = *stages_[index];
+    std::uint32_t slot = 0;
+
+    if (stage.mode == StageMode::Parallel) {
+        if (!stage.input->tryPop(slot)) {
+            return false;
+        }
+        process(index, slot);
+        return true;
+    }
+
+    if (stage.input->emptyApprox() && stage.buffered.load(std::memory_order_relaxed) == 0) {
+        return false;
+    }
+    BusyGuard guard(stage.busy);
+    if (!guard.owned()) {
+        return false;
+    }
+
+    bool worked = false;
+    if (stage.mode == StageMode::SerialOutOfOrder) {
+        for (int i = 0; i < kSerialBatch && stage.input->tryPop(slot); ++i) {
+            process(index, slot);
+            worked = true;
+        }
+        return worked;
+    }
+
+    // SerialInOrder: park arrivals in the reorder window, then run the next ones in sequence
+    const std::size_t window = slots_.size();
+    while (stage.input->tryPop(slot)) {
+        stage.reorder[slots_[slot].sequence % window] = slot;
+        stage.buffered.fetch_add(1, std::memory_order_relaxed);
+    }
+    for (;;) {
+        std::int64_t& entry = stage.reorder[stage.nextSequence % window];
+        if (entry < 0) {
+            break;
+        }
+        slot = static_cast<std::uint32_t>(entry);
+        entry = -1;
+        stage.buffered.fetch_sub(1, std::memory_order_relaxed);
+        ++stage.nextSequence;
+        process(index, slot);
+        worked = true;
+    }
+    return worked;
+}
+
+void Pipeline::process(std::size_t index, std::uint32_t slot) {
+    Stage& stage = *stages_[index];
+    const auto start = std::chrono::steady_clock::now();
+    stage.body(slots_[slot].payload);
+    stage.busyNanos.fetch_add(static_cast<std::uint64_t>(
+                                  std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                      std::chrono::steady_clock::now() - start)
+                                      .count()),
+                              std::memory_order_relaxed);
+    stage.processed.fetch_add(1, std::memory_order_relaxed);
+    forward(index, slot);
+}
+
+void Pipeline::forward(std::size_t index, std::uint32_t slot) {
+    CORE_STRESS_POINT("pipeline.forward");
+    if (index + 1 == stages_.size()) {
+        freeSlots_->tryPush(slot);
+        inFlight_.fetch_sub(1, std::memory_order_acq_rel);
+        return;
+    }
+    Stage& next = *stages_[index + 1];
+    next.input->tryPush(slot);  // cannot fail: capacity >= maxTokens
+    noteDepth(next);
+}
+
+void Pipeline::noteDepth(Stage& stage) {
+    const std::size_t depth =
+        stage.input->sizeApprox() + stage.buffered.load(std::memory_order_relaxed);
+    std::size_t seen = stage.maxDepth.load(std::memory_order_relaxed);
+    while (depth > seen &&
+           !stage.maxDepth.compare_exchange_weak(seen, depth, std::memory_order_relaxed)) {
+    }
+}
+
+std::vector<StageStats> Pipeline::stats() const {
+    const double seconds = std::chrono::duration<double>(lastRunTime_).count();
+    std::vector<StageStats> result;
+    result.reserve(stages_.size());
+    for (const auto& stage : stages_) {
+        StageStats stats;
+        stats.name = stage->name;
+        stats.mode = stage->mode;
+        stats.processed = stage->processed.load(std::memory_order_relaxed);
+        stats.busyTime = std::chrono::nanoseconds(stage->busyNanos.load(std::memory_order_relaxed));
+        stats.queueDepth =
+            stage->input->sizeApprox() + stage->buffered.load(std::memory_order_relaxed);
+        stats.maxQueueDepth = stage->maxDepth.load(std::memory_order_relaxed);
+        stats.itemsPerSecond = seconds > 0 ? static_cast<double>(stats.processed) / seconds : 0.0;
+        result.push_back(std::move(stats));
+    }
+    return result;
+}
+
+}  // namespace core
@@ -0,0 +1,1181 @@
+/**
+ * @file roaring_bitmap.cpp
+ * @brief Implementation of core::RoaringBitmap
+ *
+ * @author Modern C++ Starter Template
+ * @date 2025
+ */
+
+#include "core/roaring_bitmap.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <functional>
+#include <istream>
+#include <iterator>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace core {
+
+namespace {
+
+using Container = detail::RoaringContainer;
+using Array = Container::Array;
+using Bitmap = Container::Bitmap;
+using Runs = Container::Runs;
+using Run = detail::RoaringRun;
+
+constexpr std::size_t kWords = Container::kWords;
+constexpr std::uint32_t kMaxArray = Container::kMaxArray;
+constexpr std::size_t kBitmapBytes = kWords * sizeof(std::uint64_t);
+
+enum Kind : std::size_t { kArray = 0, kBitmap = 1, kRuns = 2 };
+
+Kind kindOf(const Container& c) noexcept { return static_cast<Kind>(c.data.index()); }
+
+// ---------------------------------------------------------------------------
+// Word-level kernels. The loops have no cross-iteration dependencies, so the
+// compiler turns them into SSE2/AVX2 code; the popcount falls back to a
+// vectorizable bit-twiddling sum when the target has no POPCNT instruction.
+
+std::uint32_t countBits(const std::uint64_t* words) noexcept {
+    std::uint64_t total = 0;
+#if defined(__POPCNT__)
+    for (std::size_t w = 0; w < kWords; ++w) {
+        total += static_cast<std::uint64_t>(std::popcount(words[w]));
+    }
+#else
+    for (std::size_t w = 0; w < kWords; ++w) {
+        std::uint64_t x = words[w];
+        x = x - ((x >> 1) & 0x5555555555555555ULL);
+        x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+        x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+        x += x >> 8;
+        x += x >> 16;
+        x += x >> 32;
+        total += x & 0x7F;
+    }
+#endif
+    return static_cast<std::uint32_t>(total);
+}
+
+template<typename Op>
+void combineWords(std::uint64_t* out, const std::uint64_t* other, Op op) noexcept {
+    for (std::size_t w = 0; w < kWords; ++w) {
+        out[w] = op(out[w], other[w]);
+    }
+}
+
+/// Sets bits [first, last] (inclusive) of a bitmap.
+void setBits(std::uint64_t* words, std::uint32_t first, std::uint32_t last) noexcept {
+    const std::size_t firstWord = first / 64;
+    const std::size_t lastWord = last / 64;
+    const std::uint64_t firstMask = ~std::uint64_t{0} << (first % 64);
+    const std::uint64_t lastMask = ~std::uint64_t{0} >> (63 - last % 64);
+    if (firstWord == lastWord) {
+        words[firstWord] |= firstMask & lastMask;
+        return;
+    }
+    words[firstWord] |= firstMask;
+    std::fill(words + firstWord + 1, words + lastWord, ~std::uint64_t{0});
+    words[lastWord] |= lastMask;
+}
+
+void clearBits(std::uint64_t* words, std::uint32_t first, std::uint32_t last) noexcept {
+    const std::size_t firstWord = first / 64;
+    const std::size_t lastWord = last / 64;
+    const std::uint64_t firstMask = ~std::uint64_t{0} << (first % 64);
+    const std::uint64_t lastMask = ~std::uint64_t{0} >> (63 - last % 64);
+    if (firstWord == lastWord) {
+        words[firstWord] &= ~(firstMask & lastMask);
+        return;
+    }
+    words[firstWord] &= ~firstMask;
+    std::fill(words + firstWord + 1, words + lastWord, std::uint64_t{0});
+    words[lastWord] &= ~lastMask;
+}
+
+bool testBit(const Bitmap& words, std::uint16_t low) noexcept {
+    return (words[low / 64] >> (low % 64) & 1) != 0;
+}
+
+// ---------------------------------------------------------------------------
+// Conversions between the three forms
+
+std::uint32_t runsCardinality(const Runs& runs) noexcept {
+    std::uint32_t total = 0;
+    for (const Run& run : runs) {
+        total += std::uint32_t{run.last} - run.start + 1;
+    }
+    return total;
+}
+
+Container makeArray(Array values) {
+    Container c;
+    c.cardinality = static_cast<std::uint32_t>(values.size());
+    c.data = std::move(values);
+    return c;
+}
+
+Container makeBitmap(Bitmap words) {
+    Container c;
+    c.cardinality = countBits(words.data());
+    c.data = std::move(words);
+    return c;
+}
+
+Container makeRuns(Runs runs) {
+    Container c;
+    c.cardinality = runsCardinality(runs);
+    c.data = std::move(runs);
+    return c;
+}
+
+Bitmap toBitmap(const Container& c) {
+    if (kindOf(c) == kBitmap) {
+        return std::get<Bitmap>(c.data);
+    }
+    Bitmap words(kWords, 0);
+    if (const auto* array = std::get_if<Array>(&c.data)) {
+        for (std::uint16_t low : *array) {
+            words[low / 64] |= std::uint64_t{1} << (low % 64);
+        }
+    } else {
+        for (const Run& run : std::get<Runs>(c.data)) {
+            setBits(words.data(), run.start, run.last);
+        }
+    }
+    return words;
+}
+
+Array toArray(const Container& c) {
+    if (kindOf(c) == kArray) {
+        return std::get<Array>(c.data);
+    }
+    Array values;
+    values.reserve(c.cardinality);
+    if (const auto* bitmap = std::get_if<Bitmap>(&c.data)) {
+        for (std::size_t w = 0; w < kWords; ++w) {
+            for (std::uint64_t word = (*bitmap)[w]; word != 0; word &= word - 1) {
+                values.push_back(static_cast<std::uint16_t>(w * 64 + std::countr_zero(word)));
+            }
+        }
+    } else {
+        for (const Run& run : std::get<Runs>(c.data)) {
+            for (std::uint32_t low = run.start; low <= run.last; ++low) {
+                values.push_back(static_cast<std::uint16_t>(low));
+            }
+        }
+    }
+    return values;
+}
+
+/// Number of runs the container would need in run form.
+std::size_t countRuns(const Container& c) noexcept {
+    if (const auto* array = std::get_if<Array>(&c.data)) {
+        std::size_t runs = array->empty() ? 0 : 1;
+        for (std::size_t i = 1; i < array->size(); ++i) {
+            runs += (*array)[i] != (*array)[i - 1] + 1;
+        }
+        return runs;
+    }
+    if (const auto* bitmap = std::get_if<Bitmap>(&c.data)) {
+        // A run starts at every set bit whose lower neighbour is clear
+        std::size_t runs = 0;
+        std::uint64_t carry = 0;
+        for (std::size_t w = 0; w < kWords; ++w) {
+            const std::uint64_t word = (*bitmap)[w];
+            runs += static_cast<std::size_t>(std::popcount(word & ~((word << 1) | carry)));
+            carry = word >> 63;
+        }
+        return runs;
+    }
+    return std::get<Runs>(c.data).size();
+}
+
+Runs toRuns(const Container& c) {
+    if (kindOf(c) == kRuns) {
+        return std::get<Runs>(c.data);
+    }
+    Runs runs;
+    runs.reserve(countRuns(c));
+    const Array values = toArray(c);
+    for (std::uint16_t low : values) {
+        if (!runs.empty() && std::uint32_t{runs.back().last} + 1 == low) {
+            runs.back().last = low;
+        } else {
+            runs.push_back({low, low});
+        }
+    }
+    return runs;
+}
+
+/// Serialized payload bytes of the array/bitmap form chosen by cardinality.
+std::size_t plainBytes(std::uint32_t cardinality) noexcept {
+    return cardinality <= kMaxArray ? cardinality * sizeof(std::uint16_t) : kBitmapBytes;
+}
+
+/// Array at or below kMaxArray values, bitmap above. Run containers stay runs.
+void normalize(Container& c) {
+    if (kindOf(c) == kBitmap && c.cardinality <= kMaxArray) {
+        c.data = toArray(c);
+    } else if (kindOf(c) == kArray && c.cardinality > kMaxArray) {
+        c.data = toBitmap(c);
+    }
+}
+
+/// Turns a run container back into array/bitmap form when runs stopped paying off.
+void settleRuns(Container& c) {
+    if (kindOf(c) == kRuns &&
+        std::get<Runs>(c.data).size() * sizeof(Run) > plainBytes(c.cardinality)) {
+        if (c.cardinality <= kMaxArray) {
+            c.data = toArray(c);
+        } else {
+            c.data = toBitmap(c);
+        }
+    }
+}
+
+/// Converts to run form if that is smaller; returns true if the form changed.
+bool shrinkToRuns(Container& c) {
+    if (kindOf(c) == kRuns) {
+        settleRuns(c);
+        return kindOf(c) != kRuns;
+    }
+    const std::size_t runs = countRuns(c);
+    if (runs * sizeof(Run) < plainBytes(c.cardinality)) {
+        c.data = toRuns(c);
+        return true;
+    }
+    return false;
+}
+
+bool containsLow(const Container& c, std::uint16_t low) noexcept {
+    if (const auto* array = std::get_if<Array>(&c.data)) {
+        return std::binary_search(array->begin(), array->end(), low);
+    }
+    if (const auto* bitmap = std::get_if<Bitmap>(&c.data)) {
+        return testBit(*bitmap, low);
+    }
+    const Runs& runs = std::get<Runs>(c.data);
+    auto it = std::upper_bound(runs.begin(), runs.end(), low,
+                               [](std::uint16_t value, const Run& run) {
+                                   return value < run.start;
+                               });
+    return it != runs.begin() && std::prev(it)->last >= low;
+}
+
+// ---------------------------------------------------------------------------
+// Single-value updates
+
+bool addToRuns(Runs& runs, std::uint16_t low) {
+    const auto it = std::upper_bound(runs.begin(), runs.end(), low,
+                                     [](std::uint16_t value, const Run& run) {
+                                         return value < run.start;
+                                     });
+    const auto index = static_cast<std::size_t>(it - runs.begin());
+    if (index > 0 && runs[index - 1].last >= low) {
+        return false;
+    }
+    const bool joinsPrev = index > 0 && std::uint32_t{runs[index - 1].last} + 1 == low;
+    const bool joinsNext = index < runs.size() && runs[index].start == std::uint32_t{low} + 1;
+    if (joinsPrev && joinsNext) {
+        runs[index - 1].last = runs[index].last;
+        runs.erase(runs.begin() + static_cast<std::ptrdiff_t>(index));
+    } else if (joinsPrev) {
+        runs[index - 1].last = low;
+    } else if (joinsNext) {
+        runs[index].start = low;
+    } else {
+        runs.insert(runs.begin() + static_cast<std::ptrdiff_t>(index), Run{low, low});
+    }
+    return true;
+}
+
+bool addToContainer(Container& c, std::uint16_t low) {
+    if (auto* array = std::get_if<Array>(&c.data)) {
+        const auto it = std::lower_bound(array->begin(), array->end(), low);
+        if (it != array->end() && *it == low) {
+            return false;
+        }
+        if (array->size() < kMaxArray) {
+            array->insert(it, low);
+            ++c.cardinality;
+            return true;
+        }
+        c.data = toBitmap(c);
+    }
+    if (auto* bitmap = std::get_if<Bitmap>(&c.data)) {
+        std::uint64_t& word = (*bitmap)[low / 64];
+        const std::uint64_t bit = std::uint64_t{1} << (low % 64);
+        if ((word & bit) != 0) {
+            return false;
+        }
+        word |= bit;
+        ++c.cardinality;
+        return true;
+    }
+    if (!addToRuns(std::get<Runs>(c.data), low)) {
+        return false;
+    }
+    ++c.cardinality;
+    settleRuns(c);
+    return true;
+}
+
+bool removeFromContainer(Container& c, std::uint16_t low) {
+    if (auto* array = std::get_if<Array>(&c.data)) {
+        const auto it = std::lower_bound(array->begin(), array->end(), low);
+        if (it == array->end() || *it != low) {
+            return false;
+        }
+        array->erase(it);
+        --c.cardinality;
+        return true;
+    }
+    if (auto* bitmap = std::get_if<Bitmap>(&c.data)) {
+        std::uint64_t& word = (*bitmap)[low / 64];
+        const std::uint64_t bit = std::uint64_t{1} << (low % 64);
+        if ((word & bit) == 0) {
+            return false;
+        }
+        word &= ~bit;
+        --c.cardinality;
+        normalize(c);
+        return true;
+    }
+    Runs& runs = std::get<Runs>(c.data);
+    const auto it = std::upper_bound(runs.begin(), runs.end(), low,
+                                     [](std::uint16_t value, const Run& run) {
+                                         return value < run.start;
+                                     });
+    if (it == runs.begin() || std::prev(it)->last < low) {
+        return false;
+    }
+    const auto run = std::prev(it);
+    if (run->start == run->last) {
+        runs.erase(run);
+    } else if (run->start == low) {
+        ++run->start;
+    } else if (run->last == low) {
+        --run->last;
+    } else {
+        const Run upper{static_cast<std::uint16_t>(low + 1), run->last};
+        run->last = static_cast<std::uint16_t>(low - 1);
+        runs.insert(std::next(run), upper);
+    }
+    --c.cardinality;
+    settleRuns(c);
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// Run-run kernels: interval merges, no expansion
+
+Runs uniteRuns(const Runs& a, const Runs& b) {
+    Runs out;
+    out.reserve(a.size() + b.size());
+    auto append = [&out](const Run& run) {
+        if (!out.empty() && std::uint32_t{out.back().last} + 1 >= run.start) {
+            out.back().last = std::max(out.back().last, run.last);
+        } else {
+            out.push_back(run);
+        }
+    };
+    std::size_t i = 0;
+    std::size_t j = 0;
+    while (i < a.size() || j < b.size()) {
+        if (j == b.size() || (i < a.size() && a[i].start <= b[j].start)) {
+            append(a[i++]);
+        } else {
+            append(b[j++]);
+        }
+    }
+    return out;
+}
+
+Runs intersectRuns(const Runs& a, const Runs& b) {
+    Runs out;
+    std::size_t i = 0;
+    std::size_t j = 0;
+    while (i < a.size() && j < b.size()) {
+        const std::uint16_t start = std::max(a[i].start, b[j].start);
+        const std::uint16_t last = std::min(a[i].last, b[j].last);
+        if (start <= last) {
+            out.push_back({start, last});
+        }
+        (a[i].last < b[j].last ? i : j)++;
+    }
+    return out;
+}
+
+Runs subtractRuns(const Runs& a, const Runs& b) {
+    Runs out;
+    std::size_t j = 0;
+    for (Run run : a) {
+        std::uint32_t start = run.start;
+        while (j < b.size() && b[j].last < start) {
+            ++j;
+        }
+        // Cut every overlapping b run out of [start, run.last]
+        std::size_t k = j;
+        for (; k < b.size() && b[k].start <= run.last; ++k) {
+            if (b[k].start > start) {
+                out.push_back({static_cast<std::uint16_t>(start),
+                               static_cast<std::uint16_t>(b[k].start - 1)});
+            }
+            start = std::uint32_t{b[k].last} + 1;
+            if (start > run.last) {
+                break;
+            }
+        }
+        if (start <= run.last) {
+            out.push_back({static_cast<std::uint16_t>(start), run.last});
+        }
+    }
+    return out;
+}
+
+// ---------------------------------------------------------------------------
+// Array kernels
+
+/// Intersection of sorted arrays; gallops through the larger one when sizes differ a lot.
+Array intersectArrays(const Array& a, const Array& b) {
+    const Array& small = a.size() <= b.size() ? a : b;
+    const Array& large = a.size() <= b.size() ? b : a;
+    Array out;
+    out.reserve(small.size());
+    if (small.size() * 32 < large.size()) {
+        auto from = large.begin();
+        for (std::uint16_t value : small) {
+            // Exponential probe, then binary search in the bracket
+            std::size_t step = 1;
+            auto bound = from;
+            while (bound != large.end() && *bound < value) {
+                from = bound;
+                bound = static_cast<std::size_t>(large.end() - bound) > step
+                            ? bound + static_cast<std::ptrdiff_t>(step)
+                            : large.end();
+                step *= 2;
+            }
+            from = std::lower_bound(from, bound, value);
+            if (from != large.end() && *from == value) {
+                out.push_back(value);
+            }
+        }
+        return out;
+    }
+    std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(out));
+    return out;
+}
+
+// ---------------------------------------------------------------------------
+// Container set operations
+
+Container unite(const Container& a, const Container& b) {
+    if (kindOf(a) == kRuns && kindOf(b) == kRuns) {
+        Container c = makeRuns(uniteRuns(std::get<Runs>(a.data), std::get<Runs>(b.data)));
+        settleRuns(c);
+        return c;
+    }
+    if (kindOf(a) == kArray && kindOf(b) == kArray &&
+        a.cardinality + b.cardinality <= kMaxArray) {
+        const Array& x = std::get<Array>(a.data);
+        const Array& y = std::get<Array>(b.data);
+        Array out;
+        out.reserve(x.size() + y.size());
+        std::set_union(x.begin(), x.end(), y.begin(), y.end(), std::back_inserter(out));
+        return makeArray(std::move(out));
+    }
+
+    // Everything else goes through a bitmap, starting from the bitmap operand
+    const bool bFirst = kindOf(b) == kBitmap && kindOf(a) != kBitmap;
+    const Container& base = bFirst ? b : a;
+    const Container& other = bFirst ? a : b;
+    Bitmap words = toBitmap(base);
+    if (const auto* bitmap = std::get_if<Bitmap>(&other.data)) {
+        combineWords(words.data(), bitmap->data(),
+                     [](std::uint64_t x, std::uint64_t y) { return x | y; });
+    } else if (const auto* array = std::get_if<Array>(&other.data)) {
+        for (std::uint16_t low : *array) {
+            words[low / 64] |= std::uint64_t{1} << (low % 64);
+        }
+    } else {
+        for (const Run& run : std::get<Runs>(other.data)) {
+            setBits(words.data(), run.start, run.last);
+        }
+    }
+    Container c = makeBitmap(std::move(words));
+    normalize(c);
+    return c;
+}
+
+Container intersect(const Container& a, const Container& b) {
+    if (kindOf(a) == kRuns && kindOf(b) == kRuns) {
+        Container c = makeRuns(intersectRuns(std::get<Runs>(a.data), std::get<Runs>(b.data)));
+        settleRuns(c);
+        return c;
+    }
+    if (kindOf(a) == kArray && kindOf(b) == kArray) {
+        return makeArray(intersectArrays(std::get<Array>(a.data), std::get<Array>(b.data)));
+    }
+    // One array: keep its values that the other side contains
+    if (kindOf(a) == kArray || kindOf(b) == kArray) {
+        const Array& values = std::get<Array>((kindOf(a) == kArray ? a : b).data);
+        const Container& other = kindOf(a) == kArray ? b : a;
+        Array out;
+        out.reserve(values.size());
+        for (std::uint16_t low : values) {
+            if (containsLow(other, low)) {
+                out.push_back(low);
+            }
+        }
+        return makeArray(std::move(out));
+    }
+    Bitmap words = toBitmap(a);
+    if (const auto* bitmap = std::get_if<Bitmap>(&b.data)) {
+        combineWords(words.data(), bitmap->data(),
+                     [](std::uint64_t x, std::uint64_t y) { return x & y; });
+    } else {
+        const Bitmap mask = toBitmap(b);
+        combineWords(words.data(), mask.data(),
+                     [](std::uint64_t x, std::uint64_t y) { return x & y; });
+    }
+    Container c = makeBitmap(std::move(words));
+    normalize(c);
+    return c;
+}
+
+Container subtract(const Container& a, const Container& b) {
+    if (kindOf(a) == kRuns && kindOf(b) == kRuns) {
+        Container c = makeRuns(subtractRuns(std::get<Runs>(a.data), std::get<Runs>(b.data)));
+        settleRuns(c);
+        return c;
+    }
+    if (const auto* values = std::get_if<Array>(&a.data)) {
+        Array out;
+        out.reserve(values->size());
+        for (std::uint16_t low : *values) {
+            if (!containsLow(b, low)) {
+                out.push_back(low);
+            }
+        }
+        return makeArray(std::move(out));
+    }
+    Bitmap words = toBitmap(a);
+    if (const auto* bitmap = std::get_if<Bitmap>(&b.data)) {
+        combineWords(words.data(), bitmap->data(),
+                     [](std::uint64_t x, std::uint64_t y) { return x & ~y; });
+    } else if (const auto* array = std::get_if<Array>(&b.data)) {
+        for (std::uint16_t low : *array) {
+            words[low / 64] &= ~(std::uint64_t{1} << (low % 64));
+        }
+    } else {
+        for (const Run& run : std::get<Runs>(b.data)) {
+            clearBits(words.data(), run.start, run.last);
+        }
+    }
+    Container c = makeBitmap(std::move(words));
+    normalize(c);
+    return c;
+}
+
+// In-place forms for the compound operators: a bitmap target is updated
+// word by word instead of being copied; other forms are small and rebuilt.
+
+void uniteInto(Container& a, const Container& b) {
+    auto* words = std::get_if<Bitmap>(&a.data);
+    if (words == nullptr) {
+        a = unite(a, b);
+        return;
+    }
+    if (const auto* bitmap = std::get_if<Bitmap>(&b.data)) {
+        combineWords(words->data(), bitmap->data(),
+                     [](std::uint64_t x, std::uint64_t y) { return x | y; });
+    } else if (const auto* array = std::get_if<Array>(&b.data)) {
+        for (std::uint16_t low : *array) {
+            (*words)[low / 64] |= std::uint64_t{1} << (low % 64);
+        }
+    } else {
+        for (const Run& run : std::get<Runs>(b.data)) {
+            setBits(words->data(), run.start, run.last);
+        }
+    }
+    a.cardinality = countBits(words->data());  // only grows, so it stays a bitmap
+}
+
+void intersectInto(Container& a, const Container& b) {
+    auto* words = std::get_if<Bitmap>(&a.data);
+    if (words == nullptr || kindOf(b) == kArray) {
+        a = intersect(a, b);  // an array operand bounds the result: build it from that
+        return;
+    }
+    if (const auto* bitmap = std::get_if<Bitmap>(&b.data)) {
+        combineWords(words->data(), bitmap->data(),
+                     [](std::uint64_t x, std::uint64_t y) { return x & y; });
+    } else {
+        const Bitmap mask = toBitmap(b);
+        combineWords(words->data(), mask.data(),
+                     [](std::uint64_t x, std::uint64_t y) { return x & y; });
+    }
+    a.cardinality = countBits(words->data());
+    normalize(a);
+}
+
+void subtractFrom(Container& a, const Container& b) {
+    auto* words = std::get_if<Bitmap>(&a.data);
+    if (words == nullptr) {
+        a = subtract(a, b);
+        return;
+    }
+    if (const auto* bitmap = std::get_if<Bitmap>(&b.data)) {
+        combineWords(words->data(), bitmap->data(),
+                     [](std::uint64_t x, std::uint64_t y) { return x & ~y; });
+    } else if (const auto* array = std::get_if<Array>(&b.data)) {
+        for (std::uint16_t low : *array) {
+            (*words)[low / 64] &= ~(std::uint64_t{1} << (low % 64));
+        }
+    } else {
+        for (const Run& run : std::get<Runs>(b.data)) {
+            clearBits(words->data(), run.start, run.last);
+        }
+    }
+    a.cardinality = countBits(words->data());
+    normalize(a);
+}
+
+bool containersEqual(const Container& a, const Container& b) {
+    if (a.cardinality != b.cardinality) {
+        return false;
+    }
+    if (a.data.index() == b.data.index()) {
+        return a.data == b.data;
+    }
+    return toBitmap(a) == toBitmap(b);
+}
+
+// ---------------------------------------------------------------------------
+// Serialization helpers: explicit little-endian byte order
+
+constexpr char kMagic[4] = {'R', 'B', 'M', '1'};
+
+template<typename T>
+void put(std::string& out, T value) {
+    for (std::size_t i = 0; i < sizeof(T); ++i) {
+        out.push_back(static_cast<char>(static_cast<std::uint64_t>(value) >> (8 * i) & 0xFF));
+    }
+}
+
+template<typename T>
+T get(std::istream& in) {
+    unsigned char bytes[sizeof(T)];
+    if (!in.read(reinterpret_cast<char*>(bytes), sizeof(T))) {
+        throw std::runtime_error("RoaringBitmap::deserialize: truncated input");
+    }
+    std::uint64_t value = 0;
+    for (std::size_t i = 0; i < sizeof(T); ++i) {
+        value |= std::uint64_t{bytes[i]} << (8 * i);
+    }
+    return static_cast<T>(value);
+}
+
+[[noreturn]] void malformed(const char* what) {
+    throw std::runtime_error(std::string("RoaringBitmap::deserialize: ") + what);
+}
+
+}  // namespace
+
+RoaringBitmap::RoaringBitmap(std::initializer_list<std::uint32_t> values) {
+    addMany(values.begin(), values.size());
+}
+
+std::size_t RoaringBitmap::findKey(std::uint16_t key) const noexcept {
+    return static_cast<std::size_t>(std::lower_bound(keys_.begin(), keys_.end(), key) -
+                                    keys_.begin());
+}
+
+RoaringBitmap::Container& RoaringBitmap::containerFor(std::uint16_t key) {
+    // Ascending input appends, so try the last chunk first
+    if (!keys_.empty() && keys_.back() == key) {
+        return containers_.back();
+    }
+    const std::size_t index = findKey(key);
+    if (index == keys_.size() || keys_[index] != key) {
+        containers_.insert(containers_.begin() + static_cast<std::ptrdiff_t>(index), Container{});
+        try {
+            keys_.insert(keys_.begin() + static_cast<std::ptrdiff_t>(index), key);
+        } catch (...) {
+            containers_.erase(containers_.begin() + static_cast<std::ptrdiff_t>(index));
+            throw;
+        }
+    }
+    return containers_[index];
+}
+
+void RoaringBitmap::eraseContainer(std::size_t index) {
+    keys_.erase(keys_.begin() + static_cast<std::ptrdiff_t>(index));
+    containers_.erase(containers_.begin() + static_cast<std::ptrdiff_t>(index));
+}
+
+bool RoaringBitmap::add(std::uint32_t value) {
+    return addToContainer(containerFor(static_cast<std::uint16_t>(value >> 16)),
+                          static_cast<std::uint16_t>(value));
+}
+
+void RoaringBitmap::addMany(const std::uint32_t* values, std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) {
+        add(values[i]);
+    }
+}
+
+void RoaringBitmap::addRange(std::uint64_t first, std::uint64_t last) {
+    last = std::min<std::uint64_t>(last, std::uint64_t{1} << 32);
+    if (first >= last) {
+        return;
+    }
+    const auto firstKey = static_cast<std::uint32_t>(first >> 16);
+    const auto lastKey = static_cast<std::uint32_t>((last - 1) >> 16);
+    for (std::uint32_t key = firstKey; key <= lastKey; ++key) {
+        const auto low = static_cast<std::uint16_t>(key == firstKey ? first & 0xFFFF : 0);
+        const auto high = static_cast<std::uint16_t>(key == lastKey ? (last - 1) & 0xFFFF : 0xFFFF);
+        Container& c = containerFor(static_cast<std::uint16_t>(key));
+        const Container range = makeRuns({Run{low, high}});
+        c = c.cardinality == 0 ? range : unite(c, range);
+        shrinkToRuns(c);
+    }
+}
+
+bool RoaringBitmap::remove(std::uint32_t value) {
+    const auto key = static_cast<std::uint16_t>(value >> 16);
+    const std::size_t index = findKey(key);
+    if (index == keys_.size() || keys_[index] != key) {
+        return false;
+    }
+    if (!removeFromContainer(containers_[index], static_cast<std::uint16_t>(value))) {
+        return false;
+    }
+    if (containers_[index].cardinality == 0) {
+        eraseContainer(index);
+    }
+    return true;
+}
+
+bool RoaringBitmap::contains(std::uint32_t value) const {
+    const auto key = static_cast<std::uint16_t>(value >> 16);
+    const std::size_t index = findKey(key);
+    return index < keys_.size() && keys_[index] == key &&
+           containsLow(containers_[index], static_cast<std::uint16_t>(value));
+}
+
+std::uint64_t RoaringBitmap::size() const noexcept {
+    std::uint64_t total = 0;
+    for (const Container& c : containers_) {
+        total += c.cardinality;
+    }
+    return total;
+}
+
+void RoaringBitmap::clear() noexcept {
+    keys_.clear();
+    containers_.clear();
+}
+
+std::uint32_t RoaringBitmap::minimum() const {
+    if (empty()) {
+        throw std::out_of_range("RoaringBitmap::minimum: empty set");
+    }
+    const Container& c = containers_.front();
+    std::uint32_t low = 0;
+    if (const auto* array = std::get_if<Array>(&c.data)) {
+        low = array->front();
+    } else if (const auto* bitmap = std::get_if<Bitmap>(&c.data)) {
+        const auto word = std::find_if(bitmap->begin(), bitmap->end(),
+                                       [](std::uint64_t w) { return w != 0; });
+        low = static_cast<std::uint32_t>((word - bitmap->begin()) * 64 + std::countr_zero(*word));
+    } else {
+        low = std::get<Runs>(c.data).front().start;
+    }
+    return std::uint32_t{keys_.front()} << 16 | low;
+}
+
+std::uint32_t RoaringBitmap::maximum() const {
+    if (empty()) {
+        throw std::out_of_range("RoaringBitmap::maximum: empty set");
+    }
+    const Container& c = containers_.back();
+    std::uint32_t low = 0;
+    if (const auto* array = std::get_if<Array>(&c.data)) {
+        low = array->back();
+    } else if (const auto* bitmap = std::get_if<Bitmap>(&c.data)) {
+        const auto word = std::find_if(bitmap->rbegin(), bitmap->rend(),
+                                       [](std::uint64_t w) { return w != 0; });
+        const auto index = static_cast<std::uint32_t>(bitmap->rend() - word - 1);
+        low = index * 64 + 63 - static_cast<std::uint32_t>(std::countl_zero(*word));
+    } else {
+        low = std::get<Runs>(c.data).back().last;
+    }
+    return std::uint32_t{keys_.back()} << 16 | low;
+}
+
+std::vector<std::uint32_t> RoaringBitmap::toVector() const {
+    std::vector<std::uint32_t> values;
+    values.reserve(size());
+    forEach([&values](std::uint32_t value) { values.push_back(value); });
+    return values;
+}
+
+bool RoaringBitmap::runOptimize() {
+    bool changed = false;
+    for (Container& c : containers_) {
+        changed |= shrinkToRuns(c);
+    }
+    return changed;
+}
+
+RoaringBitmap operator|(const RoaringBitmap& a, const RoaringBitmap& b) {
+    RoaringBitmap out;
+    out.keys_.reserve(a.keys_.size() + b.keys_.size());
+    out.containers_.reserve(a.keys_.size() + b.keys_.size());
+    std::size_t i = 0;
+    std::size_t j = 0;
+    while (i < a.keys_.size() || j < b.keys_.size()) {
+        if (j == b.keys_.size() || (i < a.keys_.size() && a.keys_[i] < b.keys_[j])) {
+            out.keys_.push_back(a.keys_[i]);
+            out.containers_.push_back(a.containers_[i++]);
+        } else if (i == a.keys_.size() || b.keys_[j] < a.keys_[i]) {
+            out.keys_.push_back(b.keys_[j]);
+            out.containers_.push_back(b.containers_[j++]);
+        } else {
+            out.keys_.push_back(a.keys_[i]);
+            out.containers_.push_back(unite(a.containers_[i++], b.containers_[j++]));
+        }
+    }
+    return out;
+}
+
+RoaringBitmap operator&(const RoaringBitmap& a, const RoaringBitmap& b) {
+    RoaringBitmap out;
+    std::size_t i = 0;
+    std::size_t j = 0;
+    while (i < a.keys_.size() && j < b.keys_.size()) {
+        if (a.keys_[i] < b.keys_[j]) {
+            ++i;
+        } else if (b.keys_[j] < a.keys_[i]) {
+            ++j;
+        } else {
+            RoaringBitmap::Container c = intersect(a.containers_[i], b.containers_[j]);
+            if (c.cardinality != 0) {
+                out.keys_.push_back(a.keys_[i]);
+                out.containers_.push_back(std::move(c));
+            }
+            ++i;
+            ++j;
+        }
+    }
+    return out;
+}
+
+RoaringBitmap operator-(const RoaringBitmap& a, const RoaringBitmap& b) {
+    RoaringBitmap out;
+    out.keys_.reserve(a.keys_.size());
+    out.containers_.reserve(a.keys_.size());
+    std::size_t j = 0;
+    for (std::size_t i = 0; i < a.keys_.size(); ++i) {
+        while (j < b.keys_.size() && b.keys_[j] < a.keys_[i]) {
+            ++j;
+        }
+        if (j == b.keys_.size() || b.keys_[j] != a.keys_[i]) {
+            out.keys_.push_back(a.keys_[i]);
+            out.containers_.push_back(a.containers_[i]);
+            continue;
+        }
+        RoaringBitmap::Container c = subtract(a.containers_[i], b.containers_[j]);
+        if (c.cardinality != 0) {
+            out.keys_.push_back(a.keys_[i]);
+            out.containers_.push_back(std::move(c));
+        }
+    }
+    return out;
+}
+
+// The compound operators only visit the chunks whose keys appear in
+// other; chunks other does not touch are neither copied nor rebuilt.
+
+RoaringBitmap& RoaringBitmap::operator|=(const RoaringBitmap& other) {
+    if (this == &other) {
+        return *this;
+    }
+    // Copy other's new chunks before touching *this
+    std::vector<std::pair<std::size_t, std::size_t>> shared;  // (ours, theirs)
+    std::vector<std::uint16_t> freshKeys;
+    std::vector<Container> fresh;
+    std::size_t i = 0;
+    for (std::size_t j = 0; j < other.keys_.size(); ++j) {
+        i = static_cast<std::size_t>(
+            std::lower_bound(keys_.begin() + static_cast<std::ptrdiff_t>(i), keys_.end(),
+                             other.keys_[j]) -
+            keys_.begin());
+        if (i < keys_.size() && keys_[i] == other.keys_[j]) {
+            shared.emplace_back(i, j);
+        } else {
+            freshKeys.push_back(other.keys_[j]);
+            fresh.push_back(other.containers_[j]);
+        }
+    }
+    for (const auto& [ours, theirs] : shared) {
+        uniteInto(containers_[ours], other.containers_[theirs]);
+    }
+    if (fresh.empty()) {
+        return *this;
+    }
+
+    // Merge the new chunks in from the back, moving ours rather than copying
+    std::size_t read = keys_.size();
+    keys_.resize(keys_.size() + fresh.size());
+    containers_.resize(keys_.size());
+    std::size_t write = keys_.size();
+    std::size_t next = fresh.size();
+    while (next > 0) {
+        --write;
+        if (read > 0 && keys_[read - 1] > freshKeys[next - 1]) {
+            --read;
+            keys_[write] = keys_[read];
+            containers_[write] = std::move(containers_[read]);
+        } else {
+            --next;
+            keys_[write] = freshKeys[next];
+            containers_[write] = std::move(fresh[next]);
+        }
+    }
+    return *this;
+}
+
+RoaringBitmap& RoaringBitmap::operator&=(const RoaringBitmap& other) {
+    if (this == &other) {
+        return *this;
+    }
+    std::size_t j = 0;
+    for (std::size_t i = 0; i < keys_.size(); ++i) {
+        while (j < other.keys_.size() && other.keys_[j] < keys_[i]) {
+            ++j;
+        }
+        if (j < other.keys_.size() && other.keys_[j] == keys_[i]) {
+            intersectInto(containers_[i], other.containers_[j]);
+        }
+    }
+    // Keep the shared, still non-empty chunks; moves only, so nothing can throw
+    std::size_t write = 0;
+    j = 0;
+    for (std::size_t i = 0; i < keys_.size(); ++i) {
+        while (j < other.keys_.size() && other.keys_[j] < keys_[i]) {
+            ++j;
+        }
+        const bool shared = j < other.keys_.size() && other.keys_[j] == keys_[i];
+        if (!shared || containers_[i].cardinality == 0) {
+            continue;
+        }
+        if (write != i) {
+            keys_[write] = keys_[i];
+            containers_[write] = std::move(containers_[i]);
+        }
+        ++write;
+    }
+    keys_.resize(write);
+    containers_.resize(write);
+    return *this;
+}
+
+RoaringBitmap& RoaringBitmap::operator-=(const RoaringBitmap& other) {
+    if (this == &other) {
+        clear();
+        return *this;
+    }
+    bool emptied = false;
+    std::size_t i = 0;
+    for (std::size_t j = 0; j < other.keys_.size() && i < keys_.size(); ++j) {
+        i = static_cast<std::size_t>(
+            std::lower_bound(keys_.begin() + static_cast<std::ptrdiff_t>(i), keys_.end(),
+                             other.keys_[j]) -
+            keys_.begin());
+        if (i < keys_.size() && keys_[i] == other.keys_[j]) {
+            subtractFrom(containers_[i], other.containers_[j]);
+            emptied |= containers_[i].cardinality == 0;
+        }
+    }
+    if (emptied) {
+        std::size_t write = 0;
+        for (std::size_t read = 0; read < keys_.size(); ++read) {
+            if (containers_[read].cardinality == 0) {
+                continue;
+            }
+            if (write != read) {
+                keys_[write] = keys_[read];
+                containers_[write] = std::move(containers_[read]);
+            }
+            ++write;
+        }
+        keys_.resize(write);
+        containers_.resize(write);
+    }
+    return *this;
+}
+
+bool operator==(const RoaringBitmap& a, const RoaringBitmap& b) {
+    return a.keys_ == b.keys_ && std::equal(a.containers_.begin(), a.containers_.end(),
+                                            b.containers_.begin(), containersEqual);
+}
+
+std::size_t RoaringBitmap::memoryBytes() const noexcept {
+    std::size_t bytes = keys_.capacity() * sizeof(std::uint16_t) +
+                        containers_.capacity() * sizeof(Container);
+    for (const Container& c : containers_) {
+        std::visit([&bytes](const auto& data) {
+            bytes += data.capacity() * sizeof(typename std::decay_t<decltype(data)>::value_type);
+        }, c.data);
+    }
+    return bytes;
+}
+
+RoaringBitmap::Stats RoaringBitmap::stats() const noexcept {
+    Stats result;
+    for (const Container& c : containers_) {
+        switch (kindOf(c)) {
+            case kArray:
+                ++result.arrays;
+                break;
+            case kBitmap:
+                ++result.bitmaps;
+                break;
+            case kRuns:
+                ++result.runs;
+                break;
+        }
+    }
+    return result;
+}
+
+// Layout: "RBM1", u32 container count, then per container
+//   u16 key, u8 kind (0 array, 1 bitmap, 2 runs), u32 element count
+//   array: count x u16 | bitmap: 1024 x u64 (count = cardinality) | runs: count x (u16, u16)
+std::size_t RoaringBitmap::serializedBytes() const noexcept {
+    std::size_t bytes = sizeof(kMagic) + sizeof(std::uint32_t);
+    for (const Container& c : containers_) {
+        bytes += sizeof(std::uint16_t) + sizeof(std::uint8_t) + sizeof(std::uint32_t);
+        switch (kindOf(c)) {
+            case kArray:
+                bytes += c.cardinality * sizeof(std::uint16_t);
+                break;
+            case kBitmap:
+                bytes += kBitmapBytes;
+                break;
+            case kRuns:
+                bytes += std::get<Runs>(c.data).size() * 2 * sizeof(std::uint16_t);
+                break;
+        }
+    }
+    return bytes;
+}
+
+void RoaringBitmap::serialize(std::ostream& out) const {
+    std::string buffer;
+    buffer.reserve(serializedBytes());
+    buffer.append(kMagic, sizeof(kMagic));
+    put(buffer, static_cast<std::uint32_t>(keys_.size()));
+    for (std::size_t i = 0; i < keys_.size(); ++i) {
+        const Container& c = containers_[i];
+        put(buffer, keys_[i]);
+        put(buffer, static_cast<std::uint8_t>(kindOf(c)));
+        if (const auto* array = std::get_if<Array>(&c.data)) {
+            put(buffer, static_cast<std::uint32_t>(array->size()));
+            for (std::uint16_t low : *array) {
+                put(buffer, low);
+            }
+        } else if (const auto* bitmap = std::get_if<Bitmap>(&c.data)) {
+            put(buffer, c.cardinality);
+            for (std::uint64_t word : *bitmap) {
+                put(buffer, word);
+            }
+        } else {
+            const Runs& runs = std::get<Runs>(c.data);
+            put(buffer, static_cast<std::uint32_t>(runs.size()));
+            for (const Run& run : runs) {
+                put(buffer, run.start);
+                put(buffer, run.last);
+            }
+        }
+    }
+    out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+}
+
+RoaringBitmap RoaringBitmap::deserialize(std::istream& in) {
+    char magic[sizeof(kMagic)];
+    if (!in.read(magic, sizeof(magic)) || !std::equal(magic, magic + sizeof(magic), kMagic)) {
+        malformed("bad magic");
+    }
+    const auto count = get<std::uint32_t>(in);
+    if (count > std::uint32_t{1} << 16) {
+        malformed("too many containers");
+    }
+
+    RoaringBitmap result;
+    result.keys_.reserve(count);
+    result.containers_.reserve(count);
+    for (std::uint32_t i = 0; i < count; ++i) {
+        const auto key = get<std::uint16_t>(in);
+        if (!result.keys_.empty() && key <= result.keys_.back()) {
+            malformed("keys out of order");
+        }
+        const auto kind = get<std::uint8_t>(in);
+        const auto items = get<std::uint32_t>(in);
+
+        Container c;
+        if (kind == kArray) {
+            if (items == 0 || items > kMaxArray) {
+                malformed("bad array size");
+            }
+            Array values(items);
+            for (auto& low : values) {
+                low = get<std::uint16_t>(in);
+            }
+            if (std::adjacent_find(values.begin(), values.end(), std::greater_equal<>()) !=
+                values.end()) {
+                malformed("array not strictly increasing");
+            }
+            c = makeArray(std::move(values));
+        } else if (kind == kBitmap) {
+            Bitmap words(kWords);
+            for (auto& word : words) {
+                word = get<std::uint64_t>(in);
+            }
+            c = makeBitmap(std::move(words));
+            if (c.cardinality == 0 || c.cardinality != items) {
+                malformed("bitmap cardinality mismatch");
+            }
+        } else if (kind == kRuns) {
+            if (items == 0 || items > kWords * 32) {
+                malformed("bad run count");
+            }
+            Runs runs(items);
+            for (std::size_t r = 0; r < runs.size(); ++r) {
+                runs[r].start = get<std::uint16_t>(in);
+                runs[r].last = get<std::uint16_t>(in);
+                if (runs[r].start > runs[r].last ||
+                    (r > 0 && runs[r].start <= runs[r - 1].last)) {
+                    malformed("runs overlap or out of order");
+                }
+            }
+            c = makeRuns(std::move(runs));
+        } else {
+            malformed("unknown container kind");
+        }
+        result.keys_.push_back(key);
+        result.containers_.push_back(std::move(c));
+    }
+    return result;
+}
+
+}  // namespace core
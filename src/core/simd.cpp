@@ -0,0 +1,802 @@
+/**
+ * @file simd.cpp
+ * @brief Implementation of the core::simd kernels and their dispatch
+ *
+ * @author Modern C++ Starter Template
+ * @date 2025
+ */
+
+#include "core/simd.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <stdexcept>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define CORE_SIMD_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+// GCC and Clang compile each kernel for its own instruction set; MSVC
+// accepts any intrinsic without an attribute
+#if defined(__GNUC__)
+#define CORE_SIMD_TARGET(isa) __attribute__((target(isa)))
+#else
+#define CORE_SIMD_TARGET(isa)
+#endif
+
+namespace core::simd {
+
+namespace {
+
+struct Kernels {
+    std::size_t (*find)(const std::int32_t*, std::size_t, std::int32_t);
+    std::size_t (*count)(const std::int32_t*, std::size_t, std::int32_t);
+    MinMax (*minMax)(const std::int32_t*, std::size_t);
+    std::int64_t (*sumInt)(const std::int32_t*, std::size_t);
+    float (*sumFloat)(const float*, std::size_t);
+    std::size_t (*findByte)(const std::uint8_t*, std::size_t, std::uint8_t);
+    std::size_t (*countByte)(const std::uint8_t*, std::size_t, std::uint8_t);
+};
+
+// ---------------------------------------------------------------------------
+// Scalar kernels, also used for the tails of the vector loops
+
+std::size_t findScalar(const std::int32_t* data, std::size_t size, std::int32_t value) {
+    for (std::size_t i = 0; i < size; ++i) {
+        if (data[i] == value) {
+            return i;
+        }
+    }
+    return size;
+}
+
+std::size_t countScalar(const std::int32_t* data, std::size_t size, std::int32_t value) {
+    std::size_t hits = 0;
+    for (std::size_t i = 0; i < size; ++i) {
+        hits += data[i] == value;
+    }
+    return hits;
+}
+
+MinMax minMaxScalar(const std::int32_t* data, std::size_t size) {
+    MinMax result{data[0], data[0]};
+    for (std::size_t i = 1; i < size; ++i) {
+        result.min = std::min(result.min, data[i]);
+        result.max = std::max(result.max, data[i]);
+    }
+    return result;
+}
+
+std::int64_t sumIntScalar(const std::int32_t* data, std::size_t size) {
+    std::int64_t total = 0;
+    for (std::size_t i = 0; i < size; ++i) {
+        total += data[i];
+    }
+    return total;
+}
+
+float sumFloatScalar(const float* data, std::size_t size) {
+    float total = 0.0f;
+    for (std::size_t i = 0; i < size; ++i) {
+        total += data[i];
+    }
+    return total;
+}
+
+std::size_t findByteScalar(const std::uint8_t* data, std::size_t size, std::uint8_t byte) {
+    for (std::size_t i = 0; i < size; ++i) {
+        if (data[i] == byte) {
+            return i;
+        }
+    }
+    return size;
+}
+
+std::size_t countByteScalar(const std::uint8_t* data, std::size_t size, std::uint8_t byte) {
+    std::size_t hits = 0;
+    for (std::size_t i = 0; i < size; ++i) {
+        hits += data[i] == byte;
+    }
+    return hits;
+}
+
+constexpr Kernels kScalarKernels{findScalar,     countScalar,    minMaxScalar,   sumIntScalar,
+                                 sumFloatScalar, findByteScalar, countByteScalar};
+
+#if defined(CORE_SIMD_X86)
+
+// ---------------------------------------------------------------------------
+// SSE2 (baseline on x86-64, so no target attribute)
+
+__m128i load128(const void* p) { return _mm_loadu_si128(static_cast<const __m128i*>(p)); }
+
+std::int32_t horizontalAdd(__m128i v) {
+    v = _mm_add_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2)));
+    v = _mm_add_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1)));
+    return _mm_cvtsi128_si32(v);
+}
+
+std::size_t findSse2(const std::int32_t* data, std::size_t size, std::int32_t value) {
+    const __m128i needle = _mm_set1_epi32(value);
+    std::size_t i = 0;
+    // 16 elements per iteration; the OR lets one branch cover four compares
+    for (; i + 16 <= size; i += 16) {
+        const __m128i a = _mm_cmpeq_epi32(load128(data + i), needle);
+        const __m128i b = _mm_cmpeq_epi32(load128(data + i + 4), needle);
+        const __m128i c = _mm_cmpeq_epi32(load128(data + i + 8), needle);
+        const __m128i d = _mm_cmpeq_epi32(load128(data + i + 12), needle);
+        if (_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d))) != 0) {
+            const auto mask = static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(a)) |
+                                                    _mm_movemask_ps(_mm_castsi128_ps(b)) << 4 |
+                                                    _mm_movemask_ps(_mm_castsi128_ps(c)) << 8 |
+                                                    _mm_movemask_ps(_mm_castsi128_ps(d)) << 12);
+            return i + static_cast<std::size_t>(std::countr_zero(mask));
+        }
+    }
+    return i + findScalar(data + i, size - i, value);
+}
+
+std::size_t countSse2(const std::int32_t* data, std::size_t size, std::int32_t value) {
+    const __m128i needle = _mm_set1_epi32(value);
+    std::size_t hits = 0;
+    std::size_t i = 0;
+    while (i + 8 <= size) {
+        // Each lane counts down by one per match; 2^28 elements keep lanes far from overflow
+        const std::size_t blockEnd =
+            i + std::min<std::size_t>((size - i) & ~std::size_t{7}, 1u << 28);
+        __m128i a = _mm_setzero_si128();
+        __m128i b = _mm_setzero_si128();
+        for (; i < blockEnd; i += 8) {
+            a = _mm_sub_epi32(a, _mm_cmpeq_epi32(load128(data + i), needle));
+            b = _mm_sub_epi32(b, _mm_cmpeq_epi32(load128(data + i + 4), needle));
+        }
+        hits += static_cast<std::uint32_t>(horizontalAdd(_mm_add_epi32(a, b)));
+    }
+    return hits + countScalar(data + i, size - i, value);
+}
+
+__m128i select128(__m128i mask, __m128i yes, __m128i no) {
+    return _mm_or_si128(_mm_and_si128(mask, yes), _mm_andnot_si128(mask, no));
+}
+
+MinMax minMaxSse2(const std::int32_t* data, std::size_t size) {
+    if (size < 8) {
+        return minMaxScalar(data, size);
+    }
+    // SSE2 has no pminsd/pmaxsd (SSE4.1), so compare and select
+    __m128i low = load128(data);
+    __m128i high = low;
+    std::size_t i = 4;
+    for (; i + 4 <= size; i += 4) {
+        const __m128i v = load128(data + i);
+        low = select128(_mm_cmpgt_epi32(low, v), v, low);
+        high = select128(_mm_cmpgt_epi32(v, high), v, high);
+    }
+    alignas(16) std::int32_t lows[4];
+    alignas(16) std::int32_t highs[4];
+    _mm_store_si128(reinterpret_cast<__m128i*>(lows), low);
+    _mm_store_si128(reinterpret_cast<__m128i*>(highs), high);
+    MinMax result{*std::min_element(lows, lows + 4), *std::max_element(highs, highs + 4)};
+    for (; i < size; ++i) {
+        result.min = std::min(result.min, data[i]);
+        result.max = std::max(result.max, data[i]);
+    }
+    return result;
+}
+
+std::int64_t sumIntSse2(const std::int32_t* data, std::size_t size) {
+    __m128i a = _mm_setzero_si128();
+    __m128i b = _mm_setzero_si128();
+    std::size_t i = 0;
+    for (; i + 4 <= size; i += 4) {
+        // Sign-extend to 64 bits by interleaving with the sign mask
+        const __m128i v = load128(data + i);
+        const __m128i sign = _mm_srai_epi32(v, 31);
+        a = _mm_add_epi64(a, _mm_unpacklo_epi32(v, sign));
+        b = _mm_add_epi64(b, _mm_unpackhi_epi32(v, sign));
+    }
+    alignas(16) std::int64_t lanes[2];
+    _mm_store_si128(reinterpret_cast<__m128i*>(lanes), _mm_add_epi64(a, b));
+    return lanes[0] + lanes[1] + sumIntScalar(data + i, size - i);
+}
+
+float sumFloatSse2(const float* data, std::size_t size) {
+    // Four accumulators hide the latency of addps
+    __m128 a = _mm_setzero_ps();
+    __m128 b = _mm_setzero_ps();
+    __m128 c = _mm_setzero_ps();
+    __m128 d = _mm_setzero_ps();
+    std::size_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+        a = _mm_add_ps(a, _mm_loadu_ps(data + i));
+        b = _mm_add_ps(b, _mm_loadu_ps(data + i + 4));
+        c = _mm_add_ps(c, _mm_loadu_ps(data + i + 8));
+        d = _mm_add_ps(d, _mm_loadu_ps(data + i + 12));
+    }
+    alignas(16) float lanes[4];
+    _mm_store_ps(lanes, _mm_add_ps(_mm_add_ps(a, b), _mm_add_ps(c, d)));
+    return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]) + sumFloatScalar(data + i, size - i);
+}
+
+std::size_t findByteSse2(const std::uint8_t* data, std::size_t size, std::uint8_t byte) {
+    const __m128i needle = _mm_set1_epi8(static_cast<char>(byte));
+    std::size_t i = 0;
+    for (; i + 64 <= size; i += 64) {
+        const __m128i a = _mm_cmpeq_epi8(load128(data + i), needle);
+        const __m128i b = _mm_cmpeq_epi8(load128(data + i + 16), needle);
+        const __m128i c = _mm_cmpeq_epi8(load128(data + i + 32), needle);
+        const __m128i d = _mm_cmpeq_epi8(load128(data + i + 48), needle);
+        if (_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d))) != 0) {
+            const std::uint64_t mask =
+                static_cast<std::uint64_t>(static_cast<unsigned>(_mm_movemask_epi8(a))) |
+                static_cast<std::uint64_t>(static_cast<unsigned>(_mm_movemask_epi8(b))) << 16 |
+                static_cast<std::uint64_t>(static_cast<unsigned>(_mm_movemask_epi8(c))) << 32 |
+                static_cast<std::uint64_t>(static_cast<unsigned>(_mm_movemask_epi8(d))) << 48;
+            return i + static_cast<std::size_t>(std::countr_zero(mask));
+        }
+    }
+    for (; i + 16 <= size; i += 16) {
+        const int mask = _mm_movemask_epi8(_mm_cmpeq_epi8(load128(data + i), needle));
+        if (mask != 0) {
+            return i + static_cast<std::size_t>(std::countr_zero(static_cast<unsigned>(mask)));
+        }
+    }
+    return i + findByteScalar(data + i, size - i, byte);
+}
+
+std::size_t countByteSse2(const std::uint8_t* data, std::size_t size, std::uint8_t byte) {
+    const __m128i needle = _mm_set1_epi8(static_cast<char>(byte));
+    std::size_t hits = 0;
+    std::size_t i = 0;
+    while (i + 16 <= size) {
+        // Byte lanes count at most 255 matches, then psadbw folds them into 64-bit lanes
+        const std::size_t blockEnd =
+            i + std::min<std::size_t>((size - i) & ~std::size_t{15}, 255 * 16);
+        __m128i counts = _mm_setzero_si128();
+        for (; i < blockEnd; i += 16) {
+            counts = _mm_sub_epi8(counts, _mm_cmpeq_epi8(load128(data + i), needle));
+        }
+        const __m128i sums = _mm_sad_epu8(counts, _mm_setzero_si128());
+        hits += static_cast<std::size_t>(_mm_cvtsi128_si32(sums)) +
+                static_cast<std::size_t>(_mm_cvtsi128_si32(_mm_srli_si128(sums, 8)));
+    }
+    return hits + countByteScalar(data + i, size - i, byte);
+}
+
+constexpr Kernels kSse2Kernels{findSse2,     countSse2,    minMaxSse2,   sumIntSse2,
+                               sumFloatSse2, findByteSse2, countByteSse2};
+
+// ---------------------------------------------------------------------------
+// AVX2
+
+CORE_SIMD_TARGET("avx2")
+__m256i load256(const void* p) { return _mm256_loadu_si256(static_cast<const __m256i*>(p)); }
+
+CORE_SIMD_TARGET("avx2")
+std::size_t findAvx2(const std::int32_t* data, std::size_t size, std::int32_t value) {
+    const __m256i needle = _mm256_set1_epi32(value);
+    std::size_t i = 0;
+    for (; i + 32 <= size; i += 32) {
+        const __m256i a = _mm256_cmpeq_epi32(load256(data + i), needle);
+        const __m256i b = _mm256_cmpeq_epi32(load256(data + i + 8), needle);
+        const __m256i c = _mm256_cmpeq_epi32(load256(data + i + 16), needle);
+        const __m256i d = _mm256_cmpeq_epi32(load256(data + i + 24), needle);
+        const __m256i any = _mm256_or_si256(_mm256_or_si256(a, b), _mm256_or_si256(c, d));
+        if (!_mm256_testz_si256(any, any)) {
+            const auto mask = static_cast<std::uint32_t>(
+                _mm256_movemask_ps(_mm256_castsi256_ps(a)) |
+                _mm256_movemask_ps(_mm256_castsi256_ps(b)) << 8 |
+                _mm256_movemask_ps(_mm256_castsi256_ps(c)) << 16 |
+                static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(d))) << 24);
+            return i + static_cast<std::size_t>(std::countr_zero(mask));
+        }
+    }
+    for (; i + 8 <= size; i += 8) {
+        const int mask =
+            _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(load256(data + i), needle)));
+        if (mask != 0) {
+            return i + static_cast<std::size_t>(std::countr_zero(static_cast<unsigned>(mask)));
+        }
+    }
+    return i + findScalar(data + i, size - i, value);
+}
+
+CORE_SIMD_TARGET("avx2")
+std::size_t countAvx2(const std::int32_t* data, std::size_t size, std::int32_t value) {
+    const __m256i needle = _mm256_set1_epi32(value);
+    std::size_t hits = 0;
+    std::size_t i = 0;
+    while (i + 16 <= size) {
+        const std::size_t blockEnd =
+            i + std::min<std::size_t>((size - i) & ~std::size_t{15}, 1u << 28);
+        __m256i a = _mm256_setzero_si256();
+        __m256i b = _mm256_setzero_si256();
+        for (; i < blockEnd; i += 16) {
+            a = _mm256_sub_epi32(a, _mm256_cmpeq_epi32(load256(data + i), needle));
+            b = _mm256_sub_epi32(b, _mm256_cmpeq_epi32(load256(data + i + 8), needle));
+        }
+        const __m256i both = _mm256_add_epi32(a, b);
+        hits += static_cast<std::uint32_t>(horizontalAdd(
+            _mm_add_epi32(_mm256_castsi256_si128(both), _mm256_extracti128_si256(both, 1))));
+    }
+    return hits + countScalar(data + i, size - i, value);
+}
+
+CORE_SIMD_TARGET("avx2")
+MinMax minMaxAvx2(const std::int32_t* data, std::size_t size) {
+    if (size < 16) {
+        return minMaxScalar(data, size);
+    }
+    __m256i low = load256(data);
+    __m256i high = low;
+    __m256i low2 = load256(data + 8);
+    __m256i high2 = low2;
+    std::size_t i = 16;
+    for (; i + 16 <= size; i += 16) {
+        const __m256i a = load256(data + i);
+        const __m256i b = load256(data + i + 8);
+        low = _mm256_min_epi32(low, a);
+        high = _mm256_max_epi32(high, a);
+        low2 = _mm256_min_epi32(low2, b);
+        high2 = _mm256_max_epi32(high2, b);
+    }
+    alignas(32) std::int32_t lows[8];
+    alignas(32) std::int32_t highs[8];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lows), _mm256_min_epi32(low, low2));
+    _mm256_store_si256(reinterpret_cast<__m256i*>(highs), _mm256_max_epi32(high, high2));
+    MinMax result{*std::min_element(lows, lows + 8), *std::max_element(highs, highs + 8)};
+    for (; i < size; ++i) {
+        result.min = std::min(result.min, data[i]);
+        result.max = std::max(result.max, data[i]);
+    }
+    return result;
+}
+
+CORE_SIMD_TARGET("avx2")
+std::int64_t sumIntAvx2(const std::int32_t* data, std::size_t size) {
+    __m256i a = _mm256_setzero_si256();
+    __m256i b = _mm256_setzero_si256();
+    std::size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        a = _mm256_add_epi64(a, _mm256_cvtepi32_epi64(load128(data + i)));
+        b = _mm256_add_epi64(b, _mm256_cvtepi32_epi64(load128(data + i + 4)));
+    }
+    alignas(32) std::int64_t lanes[4];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), _mm256_add_epi64(a, b));
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3] + sumIntScalar(data + i, size - i);
+}
+
+CORE_SIMD_TARGET("avx2")
+float sumFloatAvx2(const float* data, std::size_t size) {
+    __m256 a = _mm256_setzero_ps();
+    __m256 b = _mm256_setzero_ps();
+    __m256 c = _mm256_setzero_ps();
+    __m256 d = _mm256_setzero_ps();
+    std::size_t i = 0;
+    for (; i + 32 <= size; i += 32) {
+        a = _mm256_add_ps(a, _mm256_loadu_ps(data + i));
+        b = _mm256_add_ps(b, _mm256_loadu_ps(data + i + 8));
+        c = _mm256_add_ps(c, _mm256_loadu_ps(data + i + 16));
+        d = _mm256_add_ps(d, _mm256_loadu_ps(data + i + 24));
+    }
+    const __m256 all = _mm256_add_ps(_mm256_add_ps(a, b), _mm256_add_ps(c, d));
+    alignas(16) float lanes[4];
+    _mm_store_ps(lanes, _mm_add_ps(_mm256_castps256_ps128(all), _mm256_extractf128_ps(all, 1)));
+    return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]) + sumFloatScalar(data + i, size - i);
+}
+
+CORE_SIMD_TARGET("avx2")
+std::size_t findByteAvx2(const std::uint8_t* data, std::size_t size, std::uint8_t byte) {
+    const __m256i needle = _mm256_set1_epi8(static_cast<char>(byte));
+    std::size_t i = 0;
+    for (; i + 64 <= size; i += 64) {
+        const __m256i a = _mm256_cmpeq_epi8(load256(data + i), needle);
+        const __m256i b = _mm256_cmpeq_epi8(load256(data + i + 32), needle);
+        const __m256i any = _mm256_or_si256(a, b);
+        if (!_mm256_testz_si256(any, any)) {
+            const std::uint64_t mask =
+                static_cast<std::uint64_t>(static_cast<std::uint32_t>(_mm256_movemask_epi8(a))) |
+                static_cast<std::uint64_t>(static_cast<std::uint32_t>(_mm256_movemask_epi8(b)))
+                    << 32;
+            return i + static_cast<std::size_t>(std::countr_zero(mask));
+        }
+    }
+    for (; i + 32 <= size; i += 32) {
+        const auto mask = static_cast<std::uint32_t>(
+            _mm256_movemask_epi8(_mm256_cmpeq_epi8(load256(data + i), needle)));
+        if (mask != 0) {
+            return i + static_cast<std::size_t>(std::countr_zero(mask));
+        }
+    }
+    return i + findByteScalar(data + i, size - i, byte);
+}
+
+CORE_SIMD_TARGET("avx2")
+std::size_t countByteAvx2(const std::uint8_t* data, std::size_t size, std::uint8_t byte) {
+    const __m256i needle = _mm256_set1_epi8(static_cast<char>(byte));
+    std::size_t hits = 0;
+    std::size_t i = 0;
+    while (i + 32 <= size) {
+        const std::size_t blockEnd =
+            i + std::min<std::size_t>((size - i) & ~std::size_t{31}, 255 * 32);
+        __m256i counts = _mm256_setzero_si256();
+        for (; i < blockEnd; i += 32) {
+            counts = _mm256_sub_epi8(counts, _mm256_cmpeq_epi8(load256(data + i), needle));
+        }
+        alignas(32) std::uint64_t sums[4];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(sums),
+                           _mm256_sad_epu8(counts, _mm256_setzero_si256()));
+        hits += static_cast<std::size_t>(sums[0] + sums[1] + sums[2] + sums[3]);
+    }
+    return hits + countByteScalar(data + i, size - i, byte);
+}
+
+constexpr Kernels kAvx2Kernels{findAvx2,     countAvx2,    minMaxAvx2,   sumIntAvx2,
+                               sumFloatAvx2, findByteAvx2, countByteAvx2};
+
+// ---------------------------------------------------------------------------
+// AVX-512 (F + BW). Tails use masked loads, which never fault on the
+// lanes they leave out, instead of a scalar loop.
+
+#define CORE_SIMD_AVX512 CORE_SIMD_TARGET("avx512f,avx512bw")
+
+// GCC 12's AVX-512 headers seed masked builtins with a self-initialized
+// "undefined" vector, which -O3 then reports as uninitialized
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+CORE_SIMD_AVX512
+__mmask16 tailMask16(std::size_t remaining) {
+    return static_cast<__mmask16>((1u << remaining) - 1);
+}
+
+CORE_SIMD_AVX512
+std::size_t findAvx512(const std::int32_t* data, std::size_t size, std::int32_t value) {
+    const __m512i needle = _mm512_set1_epi32(value);
+    std::size_t i = 0;
+    for (; i + 64 <= size; i += 64) {
+        const __mmask16 a = _mm512_cmpeq_epi32_mask(_mm512_loadu_si512(data + i), needle);
+        const __mmask16 b = _mm512_cmpeq_epi32_mask(_mm512_loadu_si512(data + i + 16), needle);
+        const __mmask16 c = _mm512_cmpeq_epi32_mask(_mm512_loadu_si512(data + i + 32), needle);
+        const __mmask16 d = _mm512_cmpeq_epi32_mask(_mm512_loadu_si512(data + i + 48), needle);
+        if ((a | b | c | d) != 0) {
+            const std::uint64_t mask = std::uint64_t{a} | std::uint64_t{b} << 16 |
+                                       std::uint64_t{c} << 32 | std::uint64_t{d} << 48;
+            return i + static_cast<std::size_t>(std::countr_zero(mask));
+        }
+    }
+    for (; i < size; i += 16) {
+        const __mmask16 live = size - i >= 16 ? __mmask16(0xFFFF) : tailMask16(size - i);
+        const __mmask16 hit = _mm512_mask_cmpeq_epi32_mask(
+            live, _mm512_maskz_loadu_epi32(live, data + i), needle);
+        if (hit != 0) {
+            return i + static_cast<std::size_t>(std::countr_zero(static_cast<unsigned>(hit)));
+        }
+    }
+    return size;
+}
+
+CORE_SIMD_AVX512
+std::size_t countAvx512(const std::int32_t* data, std::size_t size, std::int32_t value) {
+    const __m512i needle = _mm512_set1_epi32(value);
+    std::size_t hits = 0;
+    std::size_t i = 0;
+    for (; i + 32 <= size; i += 32) {
+        const __mmask16 a = _mm512_cmpeq_epi32_mask(_mm512_loadu_si512(data + i), needle);
+        const __mmask16 b = _mm512_cmpeq_epi32_mask(_mm512_loadu_si512(data + i + 16), needle);
+        hits += static_cast<std::size_t>(std::popcount(static_cast<unsigned>(a) << 16 | b));
+    }
+    for (; i < size; i += 16) {
+        const __mmask16 live = size - i >= 16 ? __mmask16(0xFFFF) : tailMask16(size - i);
+        const __mmask16 hit = _mm512_mask_cmpeq_epi32_mask(
+            live, _mm512_maskz_loadu_epi32(live, data + i), needle);
+        hits += static_cast<std::size_t>(std::popcount(static_cast<unsigned>(hit)));
+    }
+    return hits;
+}
+
+CORE_SIMD_AVX512
+MinMax minMaxAvx512(const std::int32_t* data, std::size_t size) {
+    // Lanes start at the extremes, so masked tails need no special case
+    __m512i low = _mm512_set1_epi32(data[0]);
+    __m512i high = low;
+    __m512i low2 = low;
+    __m512i high2 = low;
+    std::size_t i = 0;
+    for (; i + 32 <= size; i += 32) {
+        const __m512i a = _mm512_loadu_si512(data + i);
+        const __m512i b = _mm512_loadu_si512(data + i + 16);
+        low = _mm512_min_epi32(low, a);
+        high = _mm512_max_epi32(high, a);
+        low2 = _mm512_min_epi32(low2, b);
+        high2 = _mm512_max_epi32(high2, b);
+    }
+    for (; i < size; i += 16) {
+        const __mmask16 live = size - i >= 16 ? __mmask16(0xFFFF) : tailMask16(size - i);
+        const __m512i v = _mm512_maskz_loadu_epi32(live, data + i);
+        low = _mm512_mask_min_epi32(low, live, low, v);
+        high = _mm512_mask_max_epi32(high, live, high, v);
+    }
+    return {_mm512_reduce_min_epi32(_mm512_min_epi32(low, low2)),
+            _mm512_reduce_max_epi32(_mm512_max_epi32(high, high2))};
+}
+
+CORE_SIMD_AVX512
+std::int64_t sumIntAvx512(const std::int32_t* data, std::size_t size) {
+    __m512i a = _mm512_setzero_si512();
+    __m512i b = _mm512_setzero_si512();
+    std::size_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+        a = _mm512_add_epi64(a, _mm512_cvtepi32_epi64(load256(data + i)));
+        b = _mm512_add_epi64(b, _mm512_cvtepi32_epi64(load256(data + i + 8)));
+    }
+    if (i < size) {
+        const __mmask16 live = tailMask16(size - i);
+        const __m512i v = _mm512_maskz_loadu_epi32(live, data + i);
+        a = _mm512_add_epi64(a, _mm512_cvtepi32_epi64(_mm512_castsi512_si256(v)));
+        b = _mm512_add_epi64(b, _mm512_cvtepi32_epi64(_mm512_extracti64x4_epi64(v, 1)));
+    }
+    return _mm512_reduce_add_epi64(_mm512_add_epi64(a, b));
+}
+
+CORE_SIMD_AVX512
+float sumFloatAvx512(const float* data, std::size_t size) {
+    __m512 a = _mm512_setzero_ps();
+    __m512 b = _mm512_setzero_ps();
+    __m512 c = _mm512_setzero_ps();
+    __m512 d = _mm512_setzero_ps();
+    std::size_t i = 0;
+    for (; i + 64 <= size; i += 64) {
+        a = _mm512_add_ps(a, _mm512_loadu_ps(data + i));
+        b = _mm512_add_ps(b, _mm512_loadu_ps(data + i + 16));
+        c = _mm512_add_ps(c, _mm512_loadu_ps(data + i + 32));
+        d = _mm512_add_ps(d, _mm512_loadu_ps(data + i + 48));
+    }
+    for (; i < size; i += 16) {
+        const __mmask16 live = size - i >= 16 ? __mmask16(0xFFFF) : tailMask16(size - i);
+        a = _mm512_add_ps(a, _mm512_maskz_loadu_ps(live, data + i));
+    }
+    return _mm512_reduce_add_ps(_mm512_add_ps(_mm512_add_ps(a, b), _mm512_add_ps(c, d)));
+}
+
+CORE_SIMD_AVX512
+__mmask64 tailMask64(std::size_t remaining) {
+    return remaining >= 64 ? ~__mmask64{0} : (__mmask64{1} << remaining) - 1;
+}
+
+CORE_SIMD_AVX512
+std::size_t findByteAvx512(const std::uint8_t* data, std::size_t size, std::uint8_t byte) {
+    const __m512i needle = _mm512_set1_epi8(static_cast<char>(byte));
+    std::size_t i = 0;
+    for (; i + 128 <= size; i += 128) {
+        const __mmask64 a = _mm512_cmpeq_epi8_mask(_mm512_loadu_si512(data + i), needle);
+        const __mmask64 b = _mm512_cmpeq_epi8_mask(_mm512_loadu_si512(data + i + 64), needle);
+        if ((a | b) != 0) {
+            return i + static_cast<std::size_t>(a != 0 ? std::countr_zero(a)
+                                                       : 64 + std::countr_zero(b));
+        }
+    }
+    for (; i < size; i += 64) {
+        const __mmask64 live = tailMask64(size - i);
+        const __mmask64 hit =
+            _mm512_mask_cmpeq_epi8_mask(live, _mm512_maskz_loadu_epi8(live, data + i), needle);
+        if (hit != 0) {
+            return i + static_cast<std::size_t>(std::countr_zero(hit));
+        }
+    }
+    return size;
+}
+
+CORE_SIMD_AVX512
+std::size_t countByteAvx512(const std::uint8_t* data, std::size_t size, std::uint8_t byte) {
+    const __m512i needle = _mm512_set1_epi8(static_cast<char>(byte));
+    std::size_t hits = 0;
+    for (std::size_t i = 0; i < size; i += 64) {
+        const __mmask64 live = tailMask64(size - i);
+        const __mmask64 hit =
+            _mm512_mask_cmpeq_epi8_mask(live, _mm512_maskz_loadu_epi8(live, data + i), needle);
+        hits += static_cast<std::size_t>(std::popcount(hit));
+    }
+    return hits;
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+#undef CORE_SIMD_AVX512
+
+constexpr Kernels kAvx512Kernels{findAvx512,     countAvx512,    minMaxAvx512,   sumIntAvx512,
+                                 sumFloatAvx512, findByteAvx512, countByteAvx512};
+
+// ---------------------------------------------------------------------------
+// CPU detection
+
+struct CpuidRegisters {
+    unsigned eax = 0;
+    unsigned ebx = 0;
+    unsigned ecx = 0;
+    unsigned edx = 0;
+};
+
+CpuidRegisters cpuid(unsigned leaf, unsigned subleaf) {
+    CpuidRegisters r;
+#if defined(_MSC_VER) && !defined(__clang__)
+    int values[4];
+    __cpuidex(values, static_cast<int>(leaf), static_cast<int>(subleaf));
+    r = {static_cast<unsigned>(values[0]), static_cast<unsigned>(values[1]),
+         static_cast<unsigned>(values[2]), static_cast<unsigned>(values[3])};
+#else
+    if (__get_cpuid_count(leaf, subleaf, &r.eax, &r.ebx, &r.ecx, &r.edx) == 0) {
+        return {};
+    }
+#endif
+    return r;
+}
+
+/// XCR0: which register states the OS saves on context switch.
+std::uint64_t enabledStates() {
+#if defined(_MSC_VER) && !defined(__clang__)
+    return _xgetbv(0);
+#else
+    unsigned low = 0;
+    unsigned high = 0;
+    __asm__ volatile("xgetbv" : "=a"(low), "=d"(high) : "c"(0));
+    return std::uint64_t{high} << 32 | low;
+#endif
+}
+
+Level detect() {
+    const CpuidRegisters basic = cpuid(1, 0);
+    if ((basic.edx & (1u << 26)) == 0) {
+        return Level::kScalar;
+    }
+    const bool osxsave = (basic.ecx & (1u << 27)) != 0;
+    const bool avx = (basic.ecx & (1u << 28)) != 0;
+    if (!osxsave || !avx) {
+        return Level::kSSE2;
+    }
+    const std::uint64_t states = enabledStates();
+    constexpr std::uint64_t kYmm = 0x6;     // SSE + AVX state
+    constexpr std::uint64_t kZmm = 0xE6;    // plus opmask and both ZMM halves
+    if ((states & kYmm) != kYmm) {
+        return Level::kSSE2;
+    }
+    const CpuidRegisters extended = cpuid(7, 0);
+    const bool avx2 = (extended.ebx & (1u << 5)) != 0;
+    const bool avx512f = (extended.ebx & (1u << 16)) != 0;
+    const bool avx512bw = (extended.ebx & (1u << 30)) != 0;
+    if (!avx2) {
+        return Level::kSSE2;
+    }
+    if (avx512f && avx512bw && (states & kZmm) == kZmm) {
+        return Level::kAVX512;
+    }
+    return Level::kAVX2;
+}
+
+#else
+
+Level detect() { return Level::kScalar; }
+
+#endif  // CORE_SIMD_X86
+
+const Kernels& kernelsFor(Level level) {
+    switch (level) {
+#if defined(CORE_SIMD_X86)
+        case Level::kAVX512:
+            return kAvx512Kernels;
+        case Level::kAVX2:
+            return kAvx2Kernels;
+        case Level::kSSE2:
+            return kSse2Kernels;
+#endif
+        default:
+            return kScalarKernels;
+    }
+}
+
+// Constant-initialized, so a call from another file's static initializer
+// finds a null table rather than one not yet constructed. The first call
+// detects the CPU and installs the matching table.
+constinit std::atomic<Level> gActiveLevel{Level::kScalar};
+constinit std::atomic<const Kernels*> gKernels{nullptr};
+
+const Kernels& installDetected() noexcept {
+    // A function-local static runs the install once, even across threads
+    static const bool installed = [] {
+        const Level level = detectedLevel();
+        gActiveLevel.store(level, std::memory_order_relaxed);
+        gKernels.store(&kernelsFor(level), std::memory_order_release);
+        return true;
+    }();
+    static_cast<void>(installed);
+    return *gKernels.load(std::memory_order_acquire);
+}
+
+const Kernels& kernels() noexcept {
+    const Kernels* table = gKernels.load(std::memory_order_acquire);
+    if (table == nullptr) [[unlikely]] {
+        return installDetected();
+    }
+    return *table;
+}
+
+}  // namespace
+
+Level detectedLevel() noexcept {
+    static const Level level = detect();
+    return level;
+}
+
+Level activeLevel() noexcept {
+    kernels();
+    return gActiveLevel.load(std::memory_order_relaxed);
+}
+
+Level setLevel(Level level) noexcept {
+    installDetected();  // so the first-call install cannot overwrite this choice later
+    level = std::min(level, detectedLevel());
+    gActiveLevel.store(level, std::memory_order_relaxed);
+    gKernels.store(&kernelsFor(level), std::memory_order_relaxed);
+    return level;
+}
+
+const char* levelName(Level level) noexcept {
+    switch (level) {
+        case Level::kScalar:
+            return "scalar";
+        case Level::kSSE2:
+            return "SSE2";
+        case Level::kAVX2:
+            return "AVX2";
+        case Level::kAVX512:
+            return "AVX-512";
+    }
+    return "unknown";
+}
+
+std::size_t find(std::span<const std::int32_t> values, std::int32_t value) noexcept {
+    return kernels().find(values.data(), values.size(), value);
+}
+
+std::size_t count(std::span<const std::int32_t> values, std::int32_t value) noexcept {
+    return kernels().count(values.data(), values.size(), value);
+}
+
+MinMax minMax(std::span<const std::int32_t> values) {
+    if (values.empty()) {
+        throw std::invalid_argument("simd::minMax: empty range");
+    }
+    return kernels().minMax(values.data(), values.size());
+}
+
+std::int64_t sum(std::span<const std::int32_t> values) noexcept {
+    return kernels().sumInt(values.data(), values.size());
+}
+
+float sum(std::span<const float> values) noexcept {
+    return kernels().sumFloat(values.data(), values.size());
+}
+
+const void* findByte(const void* data, std::size_t size, std::uint8_t byte) noexcept {
+    const auto* bytes = static_cast<const std::uint8_t*>(data);
+    const std::size_t at = kernels().findByte(bytes, size, byte);
+    return at == size ? nullptr : bytes + at;
+}
+
+std::size_t countByte(const void* data, std::size_t size, std::uint8_t byte) noexcept {
+    return kernels().countByte(static_cast<const std::uint8_t*>(data), size, byte);
+}
+
+}  // namespace core::simd
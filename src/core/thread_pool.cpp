@@ -0,0 +1,129 @@
+/**
+ * @file thread_pool.cpp
+ * @brief Implementation of the core worker pool
+ *
+ * @author Modern C++ Starter Template
+ * @date 2025
+ */
+
+#include "core/thread_pool.hpp"
+#include "core/stress_point.hpp"
+#include <algorithm>
+#include <atomic>
+#include <exception>
+
+namespace core {
+
+ThreadPool::ThreadPool(std::size_t threadCount) {
+    threadCount = std::max<std::size_t>(1, threadCount);
+    workers_.reserve(threadCount);
+    for (std::size_t i = 0; i < threadCount; ++i) {
+        workers_.emplace_back([this]() { workerLoop(); });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    cv_.notify_all();
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+}
+
+ThreadPool& ThreadPool::getInstance() {
+    static ThreadPool instance;
+    return instance;
+}
+
+void ThreadPool::enqueue(std::function<void()> task) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        tasks_.push(std::move(task));
+    }
+    cv_.notify_one();
+}
+
+void ThreadPool::workerLoop() {
+    for (;;) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_.wait(lock, [this]() { return stopping_ || !tasks_.empty(); });
+            if (tasks_.empty()) {
+                return;  // stopping_ and fully drained
+            }
+            task = std::move(tasks_.front());
+            tasks_.pop();
+        }
+        task();
+    }
+}
+
+void ThreadPool::parallelFor(std::size_t count, const std::function<void(std::size_t)>& body) {
+    if (count == 0) {
+        return;
+    }
+    if (count == 1) {
+        body(0);
+        return;
+    }
+
+    // Helpers that start after the caller has returned only touch this
+    // shared state, never the (by then dangling) body reference.
+    struct State {
+        std::atomic<std::size_t> next{0};
+        std::size_t finished = 0;
+        std::size_t count = 0;
+        const std::function<void(std::size_t)>* body = nullptr;
+        std::exception_ptr error;
+        std::mutex mutex;
+        std::condition_variable done;
+    };
+    auto state = std::make_shared<State>();
+    state->count = count;
+    state->body = &body;
+
+    auto drain = [](State& s) {
+        std::size_t completed = 0;
+        std::exception_ptr error;
+        for (std::size_t i = s.next.fetch_add(1); i < s.count; i = s.next.fetch_add(1)) {
+            CORE_STRESS_POINT("thread_pool.parallel_for.claimed");
+            try {
+                (*s.body)(i);
+            } catch (...) {
+                if (!error) {
+                    error = std::current_exception();
+                }
+            }
+            ++completed;
+        }
+        if (completed == 0) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(s.mutex);
+        if (error && !s.error) {
+            s.error = error;
+        }
+        s.finished += completed;
+        if (s.finished == s.count) {
+            s.done.notify_all();
+        }
+    };
+
+    const std::size_t helpers = std::min(workers_.size(), count - 1);
+    for (std::size_t i = 0; i < helpers; ++i) {
+        enqueue([state, drain]() { drain(*state); });
+    }
+    drain(*state);
+
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->done.wait(lock, [&]() { return state->finished == state->count; });
+    if (state->error) {
+        std::rethrow_exception(state->error);
+    }
+}
+
+}  // namespace core
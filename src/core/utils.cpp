@@ -11,6 +11,7 @@
  */
 
 #include "core/utils.hpp"
+#include "core/frozen_map.hpp"
 #include <iostream>
 #include <iomanip>
 #include <sstream>
@@ -22,13 +23,29 @@ namespace core {
 
 // Config implementation
 bool Config::has(const std::string& key) const {
-    return values_.find(key) != values_.end();
+    return has(InternPool::global().find(key));
 }
 
 void Config::remove(const std::string& key) {
+    remove(InternPool::global().find(key));
+}
+
+bool Config::has(Symbol key) const {
+    return lookup(key) != nullptr;
+}
+
+void Config::remove(Symbol key) {
     values_.erase(key);
 }
 
+const Config::ConfigValue* Config::lookup(Symbol key) const {
+    if (!key) {
+        return nullptr;
+    }
+    auto it = values_.find(key);
+    return it == values_.end() ? nullptr : &it->second;
+}
+
 // Logger implementation
 Logger& Logger::getInstance() {
     static Logger instance;
@@ -39,6 +56,26 @@ void Logger::setLevel(LogLevel level) {
     currentLevel_ = level;
 }
 
+void Logger::setLevel(Symbol category, LogLevel level) {
+    categoryLevels_[category] = level;
+}
+
+void Logger::debug(Symbol category, const std::string& message) {
+    write(LogLevel::Debug, category, message);
+}
+
+void Logger::info(Symbol category, const std::string& message) {
+    write(LogLevel::Info, category, message);
+}
+
+void Logger::warning(Symbol category, const std::string& message) {
+    write(LogLevel::Warning, category, message);
+}
+
+void Logger::error(Symbol category, const std::string& message) {
+    write(LogLevel::Error, category, message);
+}
+
 template<typename... Args>
 void Logger::debug(const std::string& format, Args&&... args) {
     log(LogLevel::Debug, format, std::forward<Args>(args)...);
@@ -61,31 +98,59 @@ void Logger::error(const std::string& format, Args&&... args) {
 
 template<typename... Args>
 void Logger::log(LogLevel level, const std::string& format, Args&&... args) {
-    if (level < currentLevel_) {
+    write(level, Symbol(), format);
+}
+
+namespace {
+
+struct LevelStyle {
+    std::string_view name;
+    std::string_view emoji;
+};
+
+// Built at compile time: no switch, no startup cost
+constexpr auto kLevelStyles = makeFrozenMap<LogLevel, LevelStyle>({
+    {LogLevel::Debug, {"DEBUG", "🐛"}},
+    {LogLevel::Info, {"INFO", "ℹ️"}},
+    {LogLevel::Warning, {"WARN", "⚠️"}},
+    {LogLevel::Error, {"ERROR", "❌"}},
+});
+
+constexpr auto kLevelNames = makeFrozenMap<std::string_view, LogLevel>({
+    {"debug", LogLevel::Debug},
+    {"info", LogLevel::Info},
+    {"warning", LogLevel::Warning},
+    {"warn", LogLevel::Warning},
+    {"error", LogLevel::Error},
+});
+
+static_assert(kLevelStyles.at(LogLevel::Warning).name == "WARN");
+static_assert(kLevelNames.at("warn") == LogLevel::Warning);
+static_assert(!kLevelNames.contains("verbose"));
+
+}  // namespace
+
+std::optional<LogLevel> parseLogLevel(std::string_view name) noexcept {
+    auto it = kLevelNames.find(name);
+    if (it == kLevelNames.end()) {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+void Logger::write(LogLevel level, Symbol category, const std::string& message) {
+    LogLevel threshold = currentLevel_;
+    if (category) {
+        auto it = categoryLevels_.find(category);
+        if (it != categoryLevels_.end()) {
+            threshold = it->second;
+        }
+    }
+    if (level < threshold) {
         return;
     }
     
-    const char* levelStr = "INFO";
-    const char* levelEmoji = "ℹ️";
-    
-    switch (level) {
-        case LogLevel::Debug:
-            levelStr = "DEBUG";
-            levelEmoji = "🐛";
-            break;
-        case LogLevel::Info:
-            levelStr = "INFO";
-            levelEmoji = "ℹ️";
-            break;
-        case LogLevel::Warning:
-            levelStr = "WARN";
-            levelEmoji = "⚠️";
-            break;
-        case LogLevel::Error:
-            levelStr = "ERROR";
-            levelEmoji = "❌";
-            break;
-    }
+    const LevelStyle& style = kLevelStyles.at(level);
     
     // Simple format string replacement (for demonstration)
     // In a real implementation, you might use std::format (C++20) or a formatting library
@@ -93,7 +158,11 @@ void Logger::log(LogLevel level, const std::string& format, Args&&... args) {
     auto time_t = std::chrono::system_clock::to_time_t(now);
     
     std::cout << "[" << std::put_time(std::localtime(&time_t), "%H:%M:%S") << "] "
-              << levelEmoji << " " << levelStr << ": " << format << std::endl;
+              << style.emoji << " " << style.name;
+    if (category) {
+        std::cout << " [" << symbolName(category) << "]";
+    }
+    std::cout << ": " << message << std::endl;
 }
 
 // Explicit template instantiations for common types
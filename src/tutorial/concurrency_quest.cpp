@@ -1,5 +1,9 @@
 #include "tutorial/quests.hpp"
 #include "tutorial/quest.hpp"
+#include "core/adaptive_mutex.hpp"
+#include "core/channel.hpp"
+#include "core/parallel_sort.hpp"
+#include "core/task.hpp"
 #include <iostream>
 #include <thread>
 #include <mutex>
@@ -13,6 +17,24 @@
 
 namespace tutorial {
 
+namespace {
+
+// Coroutines for the channel demo (free functions, so nothing they capture can dangle)
+core::Task channelProducer(core::Channel<int>& channel, int count) {
+    for (int i = 1; i <= count; ++i) {
+        co_await channel.send(i);
+    }
+    channel.close();
+}
+
+core::Task channelConsumer(core::Channel<int>& channel, int& total) {
+    while (auto value = co_await channel.receive()) {
+        total += *value;
+    }
+}
+
+}  // namespace
+
 // Level 5: Concurrency Quest Implementation
 ConcurrencyQuest::ConcurrencyQuest() 
     : Quest("Concurrency & Parallel Programming", "Master multithreading, synchronization, and parallel algorithms", 5) {}
@@ -136,6 +158,20 @@ void consumer() {
     cv.wait(lock, []{ return ready; });  // Wait until ready is true
     std::cout << "Consumer notified!\n";
 }
+
+// Coroutine alternative: core::Channel suspends instead of blocking a thread
+core::Task producer(core::Channel<int>& ch) {
+    for (int i = 1; i <= 10; ++i) {
+        co_await ch.send(i);          // suspends while the channel is full
+    }
+    ch.close();
+}
+
+core::Task consumer(core::Channel<int>& ch) {
+    while (auto value = co_await ch.receive()) {  // std::nullopt once closed
+        std::cout << *value << " ";
+    }
+}
 )");
 
     std::cout << "\nLive demonstration:\n";
@@ -162,6 +198,33 @@ void consumer() {
     }
     
     std::cout << "Final counter value: " << demo_counter << " (should be 300)\n";
+    
+    // Any Lockable type works with std::lock_guard, e.g. a spin-then-park mutex
+    core::AdaptiveMutex adaptive_mtx;
+    int adaptive_counter = 0;
+    std::vector<std::thread> adaptive_threads;
+    for (int i = 0; i < 3; ++i) {
+        adaptive_threads.emplace_back([&adaptive_mtx, &adaptive_counter]() {
+            for (int j = 0; j < 100; ++j) {
+                std::lock_guard<core::AdaptiveMutex> lock(adaptive_mtx);
+                ++adaptive_counter;
+            }
+        });
+    }
+    for (auto& t : adaptive_threads) {
+        t.join();
+    }
+    auto stats = adaptive_mtx.stats();
+    std::cout << "core::AdaptiveMutex counter: " << adaptive_counter
+              << " (contended " << stats.contended << ", parked " << stats.parked << ")\n";
+    core::Channel<int> channel(4);
+    int channel_total = 0;
+    auto consumer_task = channelConsumer(channel, channel_total);
+    auto producer_task = channelProducer(channel, 10);
+    producer_task.get();
+    consumer_task.get();
+    std::cout << "core::Channel producer/consumer total: " << channel_total << " (should be 55)\n";
+    
     std::cout << "Synchronization prevents race conditions!\n";
 }
 
@@ -181,6 +244,9 @@ auto calculate = [](int x, int y) -> int {
 std::future<int> result = std::async(std::launch::async, calculate, 6, 7);
 // Do other work while calculation runs...
 int value = result.get();  // Block until result is ready
+// Same arguments again? Memoize instead of recomputing: a sharded, bounded
+// core::LruCache<int, int> returns cache.getOrCompute(n, ...) hits without
+// one global lock (see core/lru_cache.hpp)
 
 // std::promise and std::future for manual control
 std::promise<std::string> promise;
@@ -320,6 +386,10 @@ void parallel_for_each(Iterator first, Iterator last, Func func) {
         t.join();
     }
 }
+
+// Or use the sample sort built on the shared core::ThreadPool
+core::parallel_sort(large_data);                                   // like std::sort
+core::parallel_stable_sort(records, std::less<>{}, &Record::key);  // comparator + projection
 )");
 
     std::cout << "\nLive demonstration:\n";
@@ -337,6 +407,22 @@ void parallel_for_each(Iterator first, Iterator last, Func func) {
     std::cout << "Sequential sum: " << sum_seq 
               << " (time: " << seq_time.count() << " μs)\n";
     
+    std::vector<int> sort_data(demo_data.rbegin(), demo_data.rend());
+    auto sort_copy = sort_data;
+    
+    start = std::chrono::high_resolution_clock::now();
+    std::sort(sort_copy.begin(), sort_copy.end());
+    end = std::chrono::high_resolution_clock::now();
+    std::cout << "std::sort:           "
+              << std::chrono::duration_cast<std::chrono::microseconds>(end - start).count() << " μs\n";
+    
+    start = std::chrono::high_resolution_clock::now();
+    core::parallel_sort(sort_data);
+    end = std::chrono::high_resolution_clock::now();
+    std::cout << "core::parallel_sort: "
+              << std::chrono::duration_cast<std::chrono::microseconds>(end - start).count() << " μs"
+              << (sort_data == sort_copy ? " (same result)" : " (MISMATCH)") << "\n";
+    
     std::cout << "Available CPU cores: " << std::thread::hardware_concurrency() << "\n";
     std::cout << "Parallel algorithms can dramatically improve performance!\n";
 }
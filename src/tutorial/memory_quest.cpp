@@ -1,4 +1,5 @@
 #include "tutorial/quests.hpp"
+#include "core/alloc_tracker.hpp"
 #include <memory>
 #include <iostream>
 #include <vector>
@@ -67,10 +68,19 @@ void heapExampleModern() {
     std::cout << "Live demonstration:\n";
     {
         std::cout << "Creating stack variables...\n";
+        core::alloc::AllocationScope intScope;
         int stackInt = 100;
+        const auto intAllocations = intScope.allocations();
+
+        core::alloc::AllocationScope vectorScope;
         std::vector<int> stackVec{1, 2, 3, 4, 5};
-        std::cout << "Stack int: " << stackInt << "\n";
-        std::cout << "Stack vector size: " << stackVec.size() << "\n";
+        const auto vectorCounters = vectorScope.counters();
+
+        std::cout << "Stack int: " << stackInt << " (heap allocations: " << intAllocations
+                  << ")\n";
+        std::cout << "Stack vector size: " << stackVec.size()
+                  << " (heap allocations: " << vectorCounters.allocations << ", "
+                  << vectorCounters.bytesAllocated << " bytes for its elements)\n";
     } // Variables automatically destroyed here
     std::cout << "Stack variables automatically cleaned up!\n\n";
     
@@ -190,6 +200,38 @@ std::unique_ptr<int, decltype(customDeleter)> customPtr(new int(99), customDelet
     std::cout << "  After move - original is: " << (uniqueDemo ? "valid" : "nullptr") << "\n";
     std::cout << "  Moved pointer value: " << *movedUnique << "\n\n";
     
+    // Allocation counts measured by core::alloc::AllocationScope
+    std::cout << "🔢 Heap allocations per construction:\n";
+    {
+        core::alloc::AllocationScope scope;
+        std::shared_ptr<std::string> separate(new std::string("Two blocks"));
+        std::cout << "  shared_ptr(new T): " << scope.allocations()
+                  << " (object + control block)\n";
+    }
+    {
+        core::alloc::AllocationScope scope;
+        auto combined = std::make_shared<std::string>("One block");
+        std::cout << "  make_shared<T>:    " << scope.allocations()
+                  << " (object inside the control block)\n";
+    }
+    {
+        core::alloc::AllocationScope scope;
+        std::vector<int> grown;
+        for (int i = 0; i < 1000; ++i) {
+            grown.push_back(i);
+        }
+        std::cout << "  1000 x push_back:  " << scope.allocations() << " (geometric growth)\n";
+    }
+    {
+        core::alloc::AllocationScope scope;
+        std::vector<int> reserved;
+        reserved.reserve(1000);
+        for (int i = 0; i < 1000; ++i) {
+            reserved.push_back(i);
+        }
+        std::cout << "  reserve + push_back: " << scope.allocations() << "\n\n";
+    }
+
     // shared_ptr demo
     std::cout << "🤝 shared_ptr demonstration:\n";
     auto shared1 = std::make_shared<std::string>("Shared Resource");
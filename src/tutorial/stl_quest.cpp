@@ -1,5 +1,6 @@
 #include "tutorial/quests.hpp"
 #include "tutorial/quest.hpp"
+#include "core/flat_map.hpp"
 #include <iostream>
 #include <vector>
 #include <deque>
@@ -63,6 +64,8 @@ vec.insert(vec.begin() + 2, 10);     // O(n) - shifts elements
 std::deque<std::string> deq{"b", "c", "d"};
 deq.push_front("a");                 // O(1) - efficient at both ends
 deq.push_back("e");                  // O(1)
+// core::RingDeque keeps the same O(1) ends in one contiguous ring buffer:
+// no per-chunk allocations, faster scans (see core/ring_deque.hpp)
 
 // std::list - Doubly-linked list
 std::list<double> lst{1.1, 2.2, 3.3};
@@ -80,6 +83,8 @@ lst.push_front(0.5);                 // O(1)
     std::cout << "\n";
     
     std::cout << "Choose the right container for your access patterns!\n";
+    std::cout << "Measure them on your machine: build Release and run "
+              << "benchmarks/stl_bench > stl.csv\n";
 }
 
 void STLQuest::demonstrateAssociativeContainers() {
@@ -90,15 +95,33 @@ void STLQuest::demonstrateAssociativeContainers() {
 std::map<std::string, int> ages;
 ages["Alice"] = 30;
 ages["Bob"] = 25;
+// core::BTreeMap<std::string, int> keeps the same order with many keys per
+// node and linked leaves: fewer cache misses per lookup, fast range scans
+// (see core/btree_map.hpp)
 
 // std::unordered_map - Hash table (faster average case)
 std::unordered_map<int, std::string> employees;
 employees[101] = "John Doe";
 employees[102] = "Jane Smith";
+// core::SwissMap<int, std::string> is a drop-in open-addressing alternative
+// that probes 16 slots per SIMD compare (see core/swiss_map.hpp)
+// Most lookups miss? A core::BloomFilter in front answers "definitely
+// absent" from one cache line (see core/bloom_filter.hpp)
 
 // std::set - Ordered unique elements
 std::set<int> unique_numbers{3, 1, 4, 1, 5, 9, 2, 6};
 // Result: {1, 2, 3, 4, 5, 6, 9} - sorted and unique
+// Millions of integer IDs? core::RoaringBitmap stores them in compressed
+// chunks (a few bytes per ID instead of 40) with fast |, & and -
+// (see core/roaring_bitmap.hpp)
+
+// core::FlatMap / core::FlatSet - Same interface, sorted vectors underneath
+// Built once and read often? Binary search over contiguous keys beats tree nodes
+core::FlatMap<std::string, int> flat_ages{{"Bob", 25}, {"Alice", 30}};
+core::FlatSet<int> flat_numbers{3, 1, 4, 1, 5, 9, 2, 6};   // one sort + dedupe
+// Contents known at compile time (keywords, enum names)? core::FrozenMap
+// builds a perfect hash in constexpr: no startup cost, no probing
+// (see core/frozen_map.hpp)
 )");
 
     std::cout << "\nLive demonstration:\n";
@@ -112,6 +135,13 @@ std::set<int> unique_numbers{3, 1, 4, 1, 5, 9, 2, 6};
         std::cout << name << ":" << age << " ";
     }
     std::cout << "\n";
+
+    core::FlatMap<std::string, int> flat_ages{{"Bob", 25}, {"Alice", 30}};
+    std::cout << "Flat map:  ";
+    for (const auto& [name, age] : flat_ages) {
+        std::cout << name << ":" << age << " ";
+    }
+    std::cout << "(keys in one array, values in another)\n";
     
     std::cout << "Associative containers provide efficient lookup!\n";
 }
@@ -139,6 +169,9 @@ pq.push(3);
 pq.push(1);
 pq.push(4);
 // pq.top() == 4 (largest element)
+// No way to change or remove a queued entry: when priorities change, use
+// core::IndexedHeap, whose push() returns a handle for update()/erase()
+// (see core/indexed_heap.hpp)
 )");
 
     std::cout << "\nLive demonstration:\n";
@@ -204,7 +237,11 @@ std::vector<int> numbers{5, 2, 8, 1, 9, 3, 7, 4, 6};
 
 // Sorting and searching
 std::sort(numbers.begin(), numbers.end());
+// For millions of elements: core::parallel_sort(numbers) (see core/parallel_sort.hpp)
 auto it = std::find(numbers.begin(), numbers.end(), 5);
+// Scanning large int arrays? core::simd::find/count/minMax/sum compare 4-16
+// elements per instruction, using the widest SIMD set the CPU has
+// (see core/simd.hpp)
 
 // Transformation algorithms
 std::vector<int> squared(numbers.size());
@@ -1,5 +1,8 @@
 #include "tutorial/quests.hpp"
 #include "tutorial/quest.hpp"
+#include "core/alloc_tracker.hpp"
+#include "core/small_vector.hpp"
+#include "core/static_vector.hpp"
 #include <iostream>
 #include <vector>
 #include <map>
@@ -128,10 +131,35 @@ public:
     T& operator[](size_t index) { return data_[index]; }
     const T& operator[](size_t index) const { return data_[index]; }
 };
+
+// Operators on a class template can return "expression" objects instead of
+// results: core::Vec<double> turns a = b * c + d into one fused loop with no
+// temporaries (see core/vec.hpp)
 )");
 
     std::cout << "\nLive demonstration:\n";
     std::cout << "Templates allow type-safe, efficient generic programming!\n";
+
+    // Container<T> above always heap-allocates; a type + size template can avoid that
+    std::cout << "\ncore::SmallVector<T, N> stores its first N elements inline:\n";
+    core::alloc::AllocationScope scope;
+    core::SmallVector<int, 4> small{1, 2, 3};
+    std::cout << "  3 elements, inline: " << std::boolalpha << small.isInline()
+              << ", heap allocations: " << scope.allocations() << "\n";
+    small.push_back(4);
+    small.push_back(5);
+    std::cout << "  5 elements, inline: " << small.isInline()
+              << ", heap allocations: " << scope.allocations() << "\n";
+
+    // FixedArray<T, N> above always holds N constructed elements; core::StaticVector
+    // has a size of its own and works at compile time
+    constexpr core::StaticVector<int, 8> primes{2, 3, 5, 7};
+    static_assert(primes.size() == 4 && primes.capacity() == 8);
+    constexpr core::StaticString<16> key("server.port");
+    std::cout << "\ncore::StaticVector<int, 8> built at compile time: size " << primes.size()
+              << " of " << primes.capacity() << ", last " << primes.back() << "\n";
+    std::cout << "core::StaticString<16> key: \"" << key << "\" (" << key.size()
+              << " chars, no heap)\n";
 }
 
 void TemplatesQuest::demonstrateVariadicTemplates() {
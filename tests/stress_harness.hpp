@@ -0,0 +1,270 @@
+/**
+ * @file stress_harness.hpp
+ * @brief Seeded schedule-perturbation harness for concurrency stress tests
+ *
+ * The harness installs a hook behind CORE_STRESS_POINT (core/stress_point.hpp)
+ * that randomly yields, sleeps or spins whenever a thread passes an
+ * instrumented point. Every decision comes from a per-thread generator
+ * derived from one 64-bit seed, so a failing trial can be rerun with the same
+ * perturbation schedule:
+ *
+ *   CORE_STRESS_SEED=<seed>           run exactly this seed (one trial)
+ *   CORE_STRESS_ITERATIONS=<n>        trials per scenario (default per test)
+ *   CORE_STRESS_BASELINE=<file>       throughput baselines, "name opsPerSecond" per line
+ *   CORE_STRESS_UPDATE_BASELINE=1     rewrite the baseline file with this run's numbers
+ *
+ * The OS scheduler still has the final say, so a replay reproduces the
+ * injected delays exactly and the interleaving with high probability.
+ *
+ * @author Modern C++ Starter Template
+ * @date 2025
+ */
+
+#pragma once
+
+#include "core/cpu_relax.hpp"
+#include "core/stress_point.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace stress {
+
+/// Knobs for one scenario; environment variables override seed and iterations.
+struct Options {
+    std::size_t iterations = 20;
+    std::uint64_t seed = 0;  ///< 0 picks a fresh base seed from the clock
+    std::uint32_t yieldPerMillion = 50000;
+    std::uint32_t sleepPerMillion = 2000;
+    std::uint32_t spinPerMillion = 100000;
+    std::chrono::microseconds maxSleep{50};
+};
+
+/// Outcome of a scenario; failingSeed is the seed to replay.
+struct Result {
+    bool passed = true;
+    std::uint64_t failingSeed = 0;
+    std::size_t trialsRun = 0;
+    std::uint64_t pointsHit = 0;  ///< instrumented points passed, summed over all trials
+    std::string message;
+};
+
+namespace detail {
+
+inline std::uint64_t splitMix(std::uint64_t& state) {
+    std::uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+struct Schedule {
+    std::atomic<std::uint64_t> generation{0};
+    std::atomic<std::uint64_t> nextAnonymousThread{0};
+    std::atomic<std::uint64_t> pointsHit{0};
+    std::uint64_t seed = 0;
+    Options options;
+};
+
+inline Schedule& schedule() {
+    static Schedule instance;
+    return instance;
+}
+
+/// Per-thread perturbation stream, re-seeded whenever a new trial starts.
+struct ThreadStream {
+    std::uint64_t generation = 0;
+    std::uint64_t state = 0;
+    std::int64_t index = -1;  ///< set by runThreads(); -1 for pool/foreign threads
+};
+
+inline ThreadStream& threadStream() {
+    thread_local ThreadStream stream;
+    return stream;
+}
+
+inline void perturb(const char* /*site*/) {
+    auto& sched = schedule();
+    auto& stream = threadStream();
+    sched.pointsHit.fetch_add(1, std::memory_order_relaxed);
+    const std::uint64_t generation = sched.generation.load(std::memory_order_acquire);
+    if (stream.generation != generation) {
+        // Foreign threads (pool workers) are numbered in order of first contact
+        const std::uint64_t index = stream.index >= 0
+                                        ? static_cast<std::uint64_t>(stream.index)
+                                        : 1000 + sched.nextAnonymousThread.fetch_add(1);
+        stream.generation = generation;
+        stream.state = sched.seed ^ (index * 0xD1B54A32D192ED03ull);
+    }
+
+    const auto& options = sched.options;
+    const std::uint64_t roll = splitMix(stream.state) % 1000000;
+    if (roll < options.sleepPerMillion) {
+        const auto maxSleep = static_cast<std::uint64_t>(options.maxSleep.count()) + 1;
+        const auto micros = static_cast<std::int64_t>(splitMix(stream.state) % maxSleep);
+        std::this_thread::sleep_for(std::chrono::microseconds(micros));
+    } else if (roll < options.sleepPerMillion + options.yieldPerMillion) {
+        std::this_thread::yield();
+    } else if (roll < options.sleepPerMillion + options.yieldPerMillion + options.spinPerMillion) {
+        for (std::uint64_t i = splitMix(stream.state) % 64; i > 0; --i) {
+            core::cpuRelax();
+        }
+    }
+}
+
+inline std::uint64_t envNumber(const char* name, std::uint64_t fallback) {
+    const char* text = std::getenv(name);
+    if (text == nullptr || *text == '\0') {
+        return fallback;
+    }
+    return std::strtoull(text, nullptr, 0);
+}
+
+}  // namespace detail
+
+/// Applies CORE_STRESS_SEED / CORE_STRESS_ITERATIONS on top of @p defaults.
+inline Options optionsFromEnvironment(Options defaults) {
+    if (const std::uint64_t seed = detail::envNumber("CORE_STRESS_SEED", 0); seed != 0) {
+        defaults.seed = seed;
+        defaults.iterations = 1;
+    }
+    defaults.iterations = static_cast<std::size_t>(
+        detail::envNumber("CORE_STRESS_ITERATIONS", defaults.iterations));
+    if (defaults.seed == 0) {
+        defaults.seed = static_cast<std::uint64_t>(
+            std::chrono::steady_clock::now().time_since_epoch().count()) | 1;
+    }
+    return defaults;
+}
+
+/// Enables perturbation for the current scope; only one may be active at a time.
+class ScopedPerturbation {
+public:
+    ScopedPerturbation(std::uint64_t seed, const Options& options) {
+        auto& sched = detail::schedule();
+        sched.seed = seed;
+        sched.options = options;
+        sched.nextAnonymousThread.store(0, std::memory_order_relaxed);
+        sched.generation.fetch_add(1, std::memory_order_release);
+        core::stress::pointHook.store(&detail::perturb, std::memory_order_release);
+    }
+
+    ~ScopedPerturbation() { core::stress::pointHook.store(nullptr, std::memory_order_release); }
+
+    ScopedPerturbation(const ScopedPerturbation&) = delete;
+    ScopedPerturbation& operator=(const ScopedPerturbation&) = delete;
+};
+
+/**
+ * @brief Runs @p body(threadIndex) on @p count threads and joins them
+ *
+ * Threads get stable indices so their perturbation streams replay.
+ */
+inline void runThreads(std::size_t count, const std::function<void(std::size_t)>& body) {
+    std::vector<std::thread> threads;
+    threads.reserve(count);
+    for (std::size_t t = 0; t < count; ++t) {
+        threads.emplace_back([&body, t]() {
+            detail::threadStream().index = static_cast<std::int64_t>(t);
+            body(t);
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+/**
+ * @brief Repeats a concurrent trial under perturbation until one fails
+ *
+ * @p trial returns an empty string on success or a description of the
+ * violated invariant. Trial i runs with seed options.seed + i.
+ */
+inline Result runScenario(const std::string& name, Options options,
+                          const std::function<std::string()>& trial) {
+    options = optionsFromEnvironment(options);
+    Result result;
+    for (std::size_t i = 0; i < options.iterations; ++i) {
+        const std::uint64_t seed = options.seed + i;
+        std::string failure;
+        {
+            ScopedPerturbation perturbation(seed, options);
+            detail::threadStream().index = 999;  // the trial's own thread, distinct from workers
+            failure = trial();
+        }
+        ++result.trialsRun;
+        result.pointsHit += detail::schedule().pointsHit.exchange(0, std::memory_order_relaxed);
+        if (!failure.empty()) {
+            result.passed = false;
+            result.failingSeed = seed;
+            std::ostringstream message;
+            message << name << ": " << failure << " (replay with CORE_STRESS_SEED=" << seed
+                    << ")";
+            result.message = message.str();
+            return result;
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief Times an unperturbed run and compares it with the stored baseline
+ *
+ * Returns an empty string when no baseline exists or throughput is at least
+ * (1 - tolerance) of it, otherwise a description of the regression.
+ */
+inline std::string checkThroughput(const std::string& name, std::uint64_t operations,
+                                   const std::function<void()>& run, double tolerance = 0.3,
+                                   double* opsPerSecond = nullptr) {
+    const auto start = std::chrono::steady_clock::now();
+    run();
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    const double measured = static_cast<double>(operations) / elapsed.count();
+    if (opsPerSecond != nullptr) {
+        *opsPerSecond = measured;
+    }
+
+    const char* path = std::getenv("CORE_STRESS_BASELINE");
+    if (path == nullptr || *path == '\0') {
+        return {};
+    }
+
+    std::map<std::string, double> baselines;
+    {
+        std::ifstream in(path);
+        std::string key;
+        double value = 0.0;
+        while (in >> key >> value) {
+            baselines[key] = value;
+        }
+    }
+
+    if (detail::envNumber("CORE_STRESS_UPDATE_BASELINE", 0) != 0) {
+        baselines[name] = measured;
+        std::ofstream out(path, std::ios::trunc);
+        for (const auto& [key, value] : baselines) {
+            out << key << ' ' << value << '\n';
+        }
+        return {};
+    }
+
+    const auto it = baselines.find(name);
+    if (it == baselines.end() || measured >= it->second * (1.0 - tolerance)) {
+        return {};
+    }
+    std::ostringstream message;
+    message << name << ": " << measured << " ops/s is below baseline " << it->second
+            << " ops/s by more than " << tolerance * 100.0 << "%";
+    return message.str();
+}
+
+}  // namespace stress
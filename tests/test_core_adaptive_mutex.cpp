@@ -0,0 +1,82 @@
+#include <gtest/gtest.h>
+#include "core/adaptive_mutex.hpp"
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+
+std::atomic<int> parkedEvents{0};
+
+void countParked(const core::AdaptiveMutex&, core::AdaptiveMutex::Event event, std::uint32_t) {
+    if (event == core::AdaptiveMutex::Event::Parked) {
+        parkedEvents.fetch_add(1);
+    }
+}
+
+}  // namespace
+
+TEST(AdaptiveMutexTest, WorksWithLockGuard) {
+    core::AdaptiveMutex mtx;
+    int counter = 0;
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&]() {
+            for (int i = 0; i < 10000; ++i) {
+                std::lock_guard<core::AdaptiveMutex> lock(mtx);
+                ++counter;
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(counter, 40000);
+    auto stats = mtx.stats();
+    EXPECT_EQ(stats.acquisitions, 40000u);
+    EXPECT_LE(stats.spinAcquired, stats.contended);
+    EXPECT_GE(stats.spinLimit, core::AdaptiveMutex::kMinSpinLimit);
+    EXPECT_LE(stats.spinLimit, core::AdaptiveMutex::kMaxSpinLimit);
+}
+
+TEST(AdaptiveMutexTest, TryLockFailsWhileHeld) {
+    core::AdaptiveMutex mtx;
+    ASSERT_TRUE(mtx.try_lock());
+
+    bool acquired = true;
+    std::thread other([&]() { acquired = mtx.try_lock(); });
+    other.join();
+    EXPECT_FALSE(acquired);
+
+    mtx.unlock();
+    std::unique_lock<core::AdaptiveMutex> lock(mtx, std::try_to_lock);
+    EXPECT_TRUE(lock.owns_lock());
+}
+
+TEST(AdaptiveMutexTest, LongHoldParksWaiterAndReportsHook) {
+    core::AdaptiveMutex mtx;
+    core::AdaptiveMutex::setContentionHook(&countParked);
+    parkedEvents = 0;
+
+    mtx.lock();
+    std::thread waiter([&]() {
+        std::lock_guard<core::AdaptiveMutex> lock(mtx);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    mtx.unlock();
+    waiter.join();
+    core::AdaptiveMutex::setContentionHook(nullptr);
+
+    auto stats = mtx.stats();
+    EXPECT_EQ(stats.acquisitions, 2u);
+    EXPECT_EQ(stats.contended, 1u);
+    EXPECT_GE(stats.parked, 1u);
+    EXPECT_EQ(parkedEvents.load(), 1);
+
+    mtx.resetStats();
+    EXPECT_EQ(mtx.stats().acquisitions, 0u);
+}
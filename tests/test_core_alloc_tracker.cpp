@@ -0,0 +1,147 @@
+#include <gtest/gtest.h>
+#include "core/alloc_tracker.hpp"
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <new>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+/// Makes a pointer escape, so the optimizer cannot elide the new/delete pair.
+void escape(const void* pointer) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r"(pointer) : "memory");
+#else
+    static const void* volatile sink;
+    sink = pointer;
+#endif
+}
+
+}  // namespace
+
+class AllocTrackerTest : public ::testing::Test {
+protected:
+    void TearDown() override { core::alloc::setSampleRate(0); }
+};
+
+TEST_F(AllocTrackerTest, ScopeSeesZeroAllocationsOnStackOnlyCode) {
+    std::array<int, 64> values{};
+    core::alloc::AllocationScope scope;
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        values[i] = static_cast<int>(i * i);
+    }
+    std::sort(values.begin(), values.end(), std::greater<>());
+    const auto counters = scope.counters();
+
+    EXPECT_EQ(counters.allocations, 0u);
+    EXPECT_EQ(counters.bytesAllocated, 0u);
+    EXPECT_EQ(values.front(), 63 * 63);
+}
+
+TEST_F(AllocTrackerTest, CountsAllocationsBytesAndFrees) {
+    core::alloc::AllocationScope scope;
+    {
+        std::vector<std::int32_t> values;
+        values.reserve(100);
+        auto owned = std::make_unique<std::int64_t>(7);
+        escape(values.data());
+        escape(owned.get());
+    }
+    const auto counters = scope.counters();
+
+    EXPECT_EQ(counters.allocations, 2u);
+    EXPECT_EQ(counters.deallocations, 2u);
+    EXPECT_EQ(counters.bytesAllocated, 100 * sizeof(std::int32_t) + sizeof(std::int64_t));
+    EXPECT_EQ(counters.netBytes(), 0);
+}
+
+TEST_F(AllocTrackerTest, TracksPeakWithinScope) {
+    core::alloc::AllocationScope outer;
+    {
+        std::vector<char> big(1000);
+    }
+    core::alloc::AllocationScope inner;
+    std::vector<char> small(200);
+
+    EXPECT_EQ(inner.counters().peakBytes, 200);
+    EXPECT_EQ(outer.counters().peakBytes, 1000);
+}
+
+TEST_F(AllocTrackerTest, AlignedAllocationsKeepAlignment) {
+    struct alignas(256) Block {
+        char data[256];
+    };
+    core::alloc::AllocationScope scope;
+    auto block = std::make_unique<Block>();
+    auto blocks = std::make_unique<Block[]>(3);
+
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(block.get()) % 256, 0u);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(blocks.get()) % 256, 0u);
+    EXPECT_EQ(scope.allocations(), 2u);
+}
+
+TEST_F(AllocTrackerTest, OversizedRequestsFailInsteadOfWrapping) {
+    // volatile keeps the compiler from rejecting or folding the size
+    volatile std::size_t huge = std::numeric_limits<std::size_t>::max() - 15;
+    core::alloc::AllocationScope scope;
+    EXPECT_THROW(escape(::operator new(huge)), std::bad_alloc);
+    EXPECT_THROW(escape(::operator new[](huge)), std::bad_alloc);
+    EXPECT_THROW(escape(::operator new(huge, std::align_val_t{256})), std::bad_alloc);
+    EXPECT_EQ(::operator new(huge, std::nothrow), nullptr);
+    EXPECT_EQ(::operator new(huge, std::align_val_t{256}, std::nothrow), nullptr);
+
+    // The new_handler still gets its chance before bad_alloc
+    static int handlerCalls;
+    handlerCalls = 0;
+    const std::new_handler previous = std::set_new_handler([] {
+        ++handlerCalls;
+        std::set_new_handler(nullptr);
+    });
+    EXPECT_THROW(escape(::operator new(huge)), std::bad_alloc);
+    std::set_new_handler(previous);
+    EXPECT_EQ(handlerCalls, 1);
+    EXPECT_EQ(scope.allocations(), 0u);
+}
+
+TEST_F(AllocTrackerTest, CountersArePerThread) {
+    core::alloc::AllocationScope scope;
+    std::thread worker([]() {
+        std::vector<std::string> strings(10, std::string(100, 'x'));
+    });
+    worker.join();
+
+    // std::thread allocates its own state on this thread, but the worker's
+    // eleven allocations are not charged here
+    EXPECT_LT(scope.allocations(), 3u);
+}
+
+TEST_F(AllocTrackerTest, SamplesCallSites) {
+    core::alloc::setSampleRate(1);
+    core::alloc::resetCallSites();
+
+    std::vector<std::unique_ptr<char[]>> blocks;
+    for (int i = 0; i < 8; ++i) {
+        blocks.push_back(std::make_unique<char[]>(1 << 20));
+    }
+    core::alloc::setSampleRate(0);
+
+    const auto sites = core::alloc::callSites();
+    ASSERT_FALSE(sites.empty());
+    EXPECT_EQ(sites.front().allocations, 8u);
+    EXPECT_EQ(sites.front().bytes, 8u << 20);
+    EXPECT_EQ(sites.front().peakBytes, std::int64_t{8} << 20);
+    EXPECT_EQ(sites.front().liveBytes, std::int64_t{8} << 20);
+
+    blocks.clear();
+    EXPECT_EQ(core::alloc::callSites().front().liveBytes, 0);
+
+    std::ostringstream report;
+    core::alloc::writeReport(report, 1);
+    EXPECT_NE(report.str().find("8 allocations"), std::string::npos);
+}
@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+#include "core/bloom_filter.hpp"
+#include "core/simd.hpp"
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+TEST(BloomFilterTest, NoFalseNegatives) {
+    core::BloomFilter filter(10'000, 0.01);
+    for (int i = 0; i < 10'000; ++i) {
+        filter.insert(i);
+        filter.insert("key" + std::to_string(i));
+    }
+    for (int i = 0; i < 10'000; ++i) {
+        ASSERT_TRUE(filter.mayContain(i)) << i;
+        ASSERT_TRUE(filter.mayContain("key" + std::to_string(i))) << i;
+    }
+    filter.clear();
+    EXPECT_FALSE(filter.mayContain(1));
+}
+
+TEST(BloomFilterTest, MeasuredRateMeetsTarget) {
+    for (double target : {0.05, 0.01, 0.001}) {
+        const std::size_t n = 100'000;
+        core::BloomFilter filter(n, target);
+        EXPECT_LE(filter.expectedFalsePositiveRate(), target);
+        for (std::uint64_t i = 0; i < n; ++i) {
+            filter.insertHash(i);  // sequential hashes are remixed
+        }
+        std::size_t falsePositives = 0;
+        const std::size_t probes = 1'000'000;
+        for (std::uint64_t i = n; i < n + probes; ++i) {
+            falsePositives += filter.mayContainHash(i);
+        }
+        const double measured = static_cast<double>(falsePositives) / probes;
+        EXPECT_LT(measured, target * 1.3) << target;
+        EXPECT_GT(measured, target * 0.3) << target;  // not wastefully oversized
+    }
+}
+
+TEST(BloomFilterTest, SizingFollowsTarget) {
+    const core::BloomFilter loose(1'000, 0.1);
+    const core::BloomFilter tight(1'000, 0.0001);
+    EXPECT_LT(loose.bitsPerKey(), tight.bitsPerKey());
+    EXPECT_EQ(loose.memoryBytes(), loose.blockCount() * 32);
+    EXPECT_GE(tight.bitsPerKey(), 20.0);
+    EXPECT_EQ(core::BloomFilter(0, 0.01).blockCount(), 1u);
+}
+
+TEST(BloomFilterTest, ScalarAndVectorPathsAgree) {
+    using core::simd::Level;
+    const Level original = core::simd::activeLevel();
+    core::simd::setLevel(Level::kScalar);
+    core::BloomFilter scalar(5'000, 0.01);
+    core::simd::setLevel(original);
+    core::BloomFilter vector(5'000, 0.01);
+    for (std::uint64_t i = 0; i < 5'000; ++i) {
+        scalar.insertHash(i * 7919);
+        vector.insertHash(i * 7919);
+    }
+    // Same bit layout either way, so the answers match for every probe
+    for (std::uint64_t i = 0; i < 200'000; ++i) {
+        ASSERT_EQ(scalar.mayContainHash(i), vector.mayContainHash(i)) << i;
+    }
+}
+
+TEST(BloomFilterTest, RejectsInvalidRates) {
+    EXPECT_THROW(core::BloomFilter(10, 0.0), std::invalid_argument);
+    EXPECT_THROW(core::BloomFilter(10, 1.0), std::invalid_argument);
+    EXPECT_THROW(core::BloomFilter(10, -0.5), std::invalid_argument);
+}
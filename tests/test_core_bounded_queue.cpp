@@ -0,0 +1,60 @@
+#include <gtest/gtest.h>
+#include "core/bounded_queue.hpp"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+TEST(BoundedQueueTest, FifoAndCapacity) {
+    core::BoundedQueue<int> queue(3);
+    EXPECT_EQ(queue.capacity(), 4u);
+
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_TRUE(queue.tryPush(i));
+    }
+    EXPECT_FALSE(queue.tryPush(99));
+    EXPECT_EQ(queue.sizeApprox(), 4u);
+
+    int value = -1;
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(queue.tryPop(value));
+        EXPECT_EQ(value, i);
+    }
+    EXPECT_FALSE(queue.tryPop(value));
+    EXPECT_TRUE(queue.emptyApprox());
+}
+
+TEST(BoundedQueueTest, ConcurrentProducersAndConsumers) {
+    constexpr int kPerProducer = 20000;
+    core::BoundedQueue<int> queue(64);
+    std::atomic<long long> sum{0};
+    std::atomic<int> consumed{0};
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < 2; ++p) {
+        threads.emplace_back([&]() {
+            for (int i = 1; i <= kPerProducer; ++i) {
+                while (!queue.tryPush(i)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (int c = 0; c < 2; ++c) {
+        threads.emplace_back([&]() {
+            int value = 0;
+            while (consumed.load() < 2 * kPerProducer) {
+                if (queue.tryPop(value)) {
+                    sum.fetch_add(value);
+                    consumed.fetch_add(1);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(sum.load(), 2LL * kPerProducer * (kPerProducer + 1) / 2);
+}
@@ -0,0 +1,172 @@
+#include <gtest/gtest.h>
+#include "core/btree_map.hpp"
+#include <cstdint>
+#include <map>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+// 64-byte nodes: 8 entries per leaf, 5 keys per inner node, so small tests
+// already build several levels and exercise every split/borrow/merge path
+using SmallTree = core::BTreeMap<int, int, std::less<>, 64>;
+
+template<typename Map>
+void expectSameContents(const Map& tree, const std::map<int, int>& reference) {
+    ASSERT_EQ(tree.size(), reference.size());
+    auto expected = reference.begin();
+    for (const auto& [key, value] : tree) {
+        ASSERT_EQ(key, expected->first);
+        ASSERT_EQ(value, expected->second);
+        ++expected;
+    }
+}
+
+}  // namespace
+
+TEST(BTreeMapTest, BasicOperations) {
+    core::BTreeMap<int, std::string> map{{3, "three"}, {1, "one"}, {2, "two"}, {1, "uno"}};
+    EXPECT_EQ(map.size(), 3u);
+    EXPECT_EQ(map.at(1), "one");  // first of equal keys wins
+
+    map[4] = "four";
+    EXPECT_TRUE(map.contains(4));
+    EXPECT_FALSE(map.try_emplace(4, "cuatro").second);
+    EXPECT_FALSE(map.insert_or_assign(4, "vier").second);
+    EXPECT_EQ(map.at(4), "vier");
+    EXPECT_THROW(map.at(5), std::out_of_range);
+
+    auto it = map.find(2);
+    ASSERT_NE(it, map.end());
+    EXPECT_EQ(it->second, "two");
+    it->second = "deux";
+    EXPECT_EQ(map.at(2), "deux");
+
+    EXPECT_EQ(map.erase(3), 1u);
+    EXPECT_EQ(map.erase(3), 0u);
+    EXPECT_EQ(map.lower_bound(3)->first, 4);
+    EXPECT_EQ(map.upper_bound(4), map.end());
+    EXPECT_EQ(std::prev(map.end())->first, 4);
+}
+
+TEST(BTreeMapTest, RandomOperationsMatchStdMap) {
+    SmallTree tree;
+    std::map<int, int> reference;
+    std::mt19937 rng(2024);
+
+    for (int step = 0; step < 40'000; ++step) {
+        const int key = static_cast<int>(rng() % 2000);
+        switch (rng() % 4) {
+            case 0:
+            case 1: {
+                const bool inserted = tree.try_emplace(key, step).second;
+                ASSERT_EQ(inserted, reference.try_emplace(key, step).second);
+                break;
+            }
+            case 2:
+                ASSERT_EQ(tree.erase(key), reference.erase(key));
+                break;
+            default: {
+                auto bound = tree.lower_bound(key);
+                auto expected = reference.lower_bound(key);
+                ASSERT_EQ(bound == tree.end(), expected == reference.end());
+                if (expected != reference.end()) {
+                    ASSERT_EQ(bound->first, expected->first);
+                    ASSERT_EQ(bound->second, expected->second);
+                }
+                break;
+            }
+        }
+        if (step % 5000 == 0) {
+            expectSameContents(tree, reference);
+        }
+    }
+    expectSameContents(tree, reference);
+    EXPECT_GE(tree.height(), 3u);
+
+    // Drain everything: merges collapse the tree back to an empty root
+    for (int key = 0; key < 2000; ++key) {
+        ASSERT_EQ(tree.erase(key), reference.erase(key));
+    }
+    EXPECT_TRUE(tree.empty());
+    EXPECT_EQ(tree.begin(), tree.end());
+    EXPECT_EQ(tree.height(), 0u);
+}
+
+TEST(BTreeMapTest, EraseByIteratorReturnsSuccessor) {
+    SmallTree tree;
+    std::map<int, int> reference;
+    for (int key = 0; key < 1000; ++key) {
+        tree.try_emplace(key, key * 10);
+        reference.try_emplace(key, key * 10);
+    }
+
+    // Remove every key divisible by 3, walking with the returned iterators
+    for (auto it = tree.begin(); it != tree.end();) {
+        if (it->first % 3 == 0) {
+            const int next = it->first + 1;
+            it = tree.erase(it);
+            ASSERT_TRUE(it == tree.end() || it->first == next);
+        } else {
+            ++it;
+        }
+    }
+    std::erase_if(reference, [](const auto& entry) { return entry.first % 3 == 0; });
+    expectSameContents(tree, reference);
+}
+
+TEST(BTreeMapTest, BulkLoadAndRangeScan) {
+    std::vector<std::pair<int, int>> sorted;
+    for (int key = 0; key < 10'000; key += 2) {
+        sorted.emplace_back(key, -key);
+    }
+    SmallTree tree(core::sorted_unique, sorted.begin(), sorted.end());
+    ASSERT_EQ(tree.size(), sorted.size());
+
+    std::vector<int> scanned;
+    tree.scan(101, 121, [&](int key, int value) {
+        EXPECT_EQ(value, -key);
+        scanned.push_back(key);
+    });
+    EXPECT_EQ(scanned, (std::vector<int>{102, 104, 106, 108, 110, 112, 114, 116, 118, 120}));
+
+    // Reverse iteration walks the prev links
+    int expected = 9998;
+    for (auto it = tree.rbegin(); it != tree.rend(); ++it, expected -= 2) {
+        ASSERT_EQ(it->first, expected);
+    }
+    EXPECT_EQ(expected, -2);
+
+    // A bulk-loaded tree keeps accepting inserts and erases
+    std::map<int, int> reference(sorted.begin(), sorted.end());
+    for (int key = 1; key < 10'000; key += 4) {
+        tree.try_emplace(key, -key);
+        reference.try_emplace(key, -key);
+    }
+    for (int key = 0; key < 10'000; key += 6) {
+        tree.erase(key);
+        reference.erase(key);
+    }
+    expectSameContents(tree, reference);
+}
+
+TEST(BTreeMapTest, CopyMoveAndTransparentLookup) {
+    core::BTreeMap<std::string, int> words;
+    for (int i = 0; i < 500; ++i) {
+        words.try_emplace("word" + std::to_string(i), i);
+    }
+    EXPECT_TRUE(words.contains(std::string_view("word42")));
+    EXPECT_EQ(words.at("word7"), 7);
+
+    auto copy = words;
+    EXPECT_EQ(copy, words);
+    copy["word0"] = -1;
+    EXPECT_EQ(words.at("word0"), 0);
+
+    auto moved = std::move(copy);
+    EXPECT_TRUE(copy.empty());
+    EXPECT_EQ(moved.size(), 500u);
+    EXPECT_EQ(moved.at("word0"), -1);
+}
@@ -0,0 +1,169 @@
+#include <gtest/gtest.h>
+#include "core/channel.hpp"
+#include "core/task.hpp"
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+core::Task produce(core::Channel<int>& channel, int first, int count, bool closeWhenDone) {
+    for (int i = first; i < first + count; ++i) {
+        co_await channel.send(i);
+    }
+    if (closeWhenDone) {
+        channel.close();
+    }
+}
+
+core::Task consume(core::Channel<int>& channel, long long& sum, int& received) {
+    while (auto value = co_await channel.receive()) {
+        sum += *value;
+        ++received;
+    }
+}
+
+}  // namespace
+
+TEST(ChannelTest, UnbufferedRendezvous) {
+    core::Channel<int> channel;
+    long long sum = 0;
+    int received = 0;
+
+    auto consumer = consume(channel, sum, received);
+    EXPECT_FALSE(consumer.done());  // suspended waiting for a sender
+
+    auto producer = produce(channel, 1, 100, true);
+    producer.get();
+    consumer.get();
+
+    EXPECT_EQ(received, 100);
+    EXPECT_EQ(sum, 5050);
+}
+
+TEST(ChannelTest, BufferedSendSuspendsWhenFull) {
+    core::Channel<int> channel(2);
+    auto producer = produce(channel, 0, 5, true);
+
+    EXPECT_FALSE(producer.done());
+    EXPECT_EQ(channel.size(), 2u);
+
+    std::vector<int> values;
+    while (auto value = channel.tryReceive()) {
+        values.push_back(*value);
+    }
+    EXPECT_TRUE(producer.done());
+    EXPECT_EQ(values, (std::vector<int>{0, 1, 2, 3, 4}));
+}
+
+TEST(ChannelTest, CloseWakesWaiters) {
+    core::Channel<std::string> channel;
+    std::optional<std::string> received = std::string("unset");
+    bool sendResult = true;
+
+    auto receiveOnce = [&]() -> core::Task { received = co_await channel.receive(); };
+    auto receiver = receiveOnce();
+    channel.close();
+    receiver.get();
+    EXPECT_FALSE(received.has_value());
+
+    auto sendOnce = [&]() -> core::Task { sendResult = co_await channel.send("late"); };
+    auto sender = sendOnce();
+    sender.get();
+    EXPECT_FALSE(sendResult);
+
+    std::string value = "try";
+    EXPECT_FALSE(channel.trySend(value));
+    EXPECT_EQ(value, "try");
+}
+
+TEST(ChannelTest, SelectReceivesFromFirstReadyChannel) {
+    core::Channel<int> numbers;
+    core::Channel<std::string> words(1);
+    std::vector<std::string> log;
+
+    // Coroutine lambdas must outlive their tasks, so they are named
+    auto selectLoop = [&]() -> core::Task {
+        for (;;) {
+            auto result = co_await core::select(numbers, words);
+            if (result.index == 0) {
+                if (!result.get<0>()) {
+                    co_return;
+                }
+                log.push_back("n" + std::to_string(*result.get<0>()));
+            } else {
+                log.push_back("w" + *result.get<1>());
+            }
+        }
+    };
+    auto selector = selectLoop();
+
+    auto sendWord = [&]() -> core::Task { co_await words.send("hello"); };
+    auto words_task = sendWord();
+    auto numbers_task = produce(numbers, 7, 2, false);
+    words_task.get();
+    numbers_task.get();
+    numbers.close();
+    selector.get();
+
+    EXPECT_EQ(log, (std::vector<std::string>{"whello", "n7", "n8"}));
+}
+
+TEST(ChannelTest, ProducersOnOtherThreads) {
+    constexpr int kPerProducer = 5000;
+    core::Channel<int> channel(8);
+    long long sum = 0;
+    int received = 0;
+    auto consumer = consume(channel, sum, received);
+
+    std::vector<core::Task> producers(2);
+    std::vector<std::thread> threads;
+    for (int p = 0; p < 2; ++p) {
+        threads.emplace_back([&, p]() {
+            producers[static_cast<std::size_t>(p)] = produce(channel, 1, kPerProducer, false);
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (auto& producer : producers) {
+        producer.get();
+    }
+    channel.close();
+    consumer.get();
+
+    EXPECT_EQ(received, 2 * kPerProducer);
+    EXPECT_EQ(sum, 2LL * kPerProducer * (kPerProducer + 1) / 2);
+}
+
+TEST(ChannelTest, TaskPropagatesExceptions) {
+    auto fail = []() -> core::Task {
+        throw std::runtime_error("coroutine failed");
+        co_return;
+    };
+    auto failing = fail();
+    EXPECT_TRUE(failing.done());
+    EXPECT_THROW(failing.get(), std::runtime_error);
+}
+
+TEST(ChannelTest, TaskDestroyedRightAfterWaitOnAnotherThread) {
+    // The coroutine finishes on the sender's thread while this thread waits
+    // and then frees the frame at once; the final notify must not touch it
+    for (int round = 0; round < 2000; ++round) {
+        core::Channel<int> channel;
+        int value = 0;
+        auto receiveOnce = [&]() -> core::Task { value = *co_await channel.receive(); };
+        std::thread sender;
+        {
+            core::Task task = receiveOnce();
+            sender = std::thread([&]() {
+                auto sendOnce = [&]() -> core::Task { co_await channel.send(round); };
+                sendOnce().wait();
+            });
+            task.wait();
+        }
+        sender.join();
+        ASSERT_EQ(value, round);
+    }
+}
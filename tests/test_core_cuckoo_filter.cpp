@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+#include "core/cuckoo_filter.hpp"
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+TEST(CuckooFilterTest, InsertContainsErase) {
+    core::CuckooFilter filter(1'000, 0.001);
+    EXPECT_EQ(filter.fingerprintBits(), 16u);
+    for (int i = 0; i < 1'000; ++i) {
+        ASSERT_TRUE(filter.insert("session" + std::to_string(i)));
+    }
+    EXPECT_EQ(filter.size(), 1'000u);
+    for (int i = 0; i < 1'000; ++i) {
+        ASSERT_TRUE(filter.contains("session" + std::to_string(i))) << i;
+    }
+    for (int i = 0; i < 1'000; i += 2) {
+        ASSERT_TRUE(filter.erase("session" + std::to_string(i))) << i;
+    }
+    EXPECT_EQ(filter.size(), 500u);
+    for (int i = 1; i < 1'000; i += 2) {
+        ASSERT_TRUE(filter.contains("session" + std::to_string(i))) << i;
+    }
+    filter.clear();
+    EXPECT_EQ(filter.size(), 0u);
+    EXPECT_FALSE(filter.contains(std::string("session1")));
+}
+
+TEST(CuckooFilterTest, DuplicatesAreCounted) {
+    core::CuckooFilter filter(100, 0.01);
+    EXPECT_TRUE(filter.insert(42));
+    EXPECT_TRUE(filter.insert(42));
+    EXPECT_TRUE(filter.erase(42));
+    EXPECT_TRUE(filter.contains(42));
+    EXPECT_TRUE(filter.erase(42));
+    EXPECT_FALSE(filter.contains(42));
+    EXPECT_FALSE(filter.erase(42));
+}
+
+TEST(CuckooFilterTest, EveryFingerprintWidthMeetsItsTarget) {
+    // 8-, 16- and 32-bit fingerprints
+    for (double target : {0.05, 0.001, 0.00001}) {
+        const std::size_t n = 50'000;
+        core::CuckooFilter filter(n, target);
+        EXPECT_LE(filter.expectedFalsePositiveRate(), target);
+        for (std::uint64_t i = 0; i < n; ++i) {
+            ASSERT_TRUE(filter.insertHash(i)) << i;
+        }
+        for (std::uint64_t i = 0; i < n; ++i) {
+            ASSERT_TRUE(filter.containsHash(i)) << i;
+        }
+        std::size_t falsePositives = 0;
+        const std::size_t probes = 500'000;
+        for (std::uint64_t i = n; i < n + probes; ++i) {
+            falsePositives += filter.containsHash(i);
+        }
+        EXPECT_LE(static_cast<double>(falsePositives) / probes, target) << target;
+    }
+}
+
+TEST(CuckooFilterTest, FullFilterRejectsWithoutLosingKeys) {
+    core::CuckooFilter filter(64, 0.01);
+    std::uint64_t inserted = 0;
+    while (filter.insertHash(inserted)) {
+        ++inserted;
+    }
+    // Nearly every slot is used before insertion gives up
+    EXPECT_GT(filter.loadFactor(), 0.9);
+    EXPECT_EQ(filter.size(), inserted);
+    for (std::uint64_t i = 0; i < inserted; ++i) {
+        ASSERT_TRUE(filter.containsHash(i)) << i;
+    }
+    // Erasing makes room again, and the stashed key stays reachable
+    for (std::uint64_t i = 0; i < 16; ++i) {
+        ASSERT_TRUE(filter.eraseHash(i)) << i;
+    }
+    EXPECT_EQ(filter.size(), inserted - 16);
+    EXPECT_TRUE(filter.insertHash(inserted));
+    for (std::uint64_t i = 16; i <= inserted; ++i) {
+        ASSERT_TRUE(filter.containsHash(i)) << i;
+    }
+}
+
+TEST(CuckooFilterTest, RejectsInvalidRates) {
+    EXPECT_THROW(core::CuckooFilter(10, 0.0), std::invalid_argument);
+    EXPECT_THROW(core::CuckooFilter(10, 1.5), std::invalid_argument);
+}
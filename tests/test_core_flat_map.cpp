@@ -0,0 +1,131 @@
+#include <gtest/gtest.h>
+#include "core/flat_map.hpp"
+#include <iterator>
+#include <map>
+#include <memory>
+#include <random>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+TEST(FlatMapTest, BulkConstructionSortsAndKeepsFirstDuplicate) {
+    core::FlatMap<int, std::string> map(std::vector<int>{5, 1, 3, 1, 5},
+                                        std::vector<std::string>{"e", "a", "c", "x", "y"});
+    EXPECT_EQ(map.keys(), (std::vector<int>{1, 3, 5}));
+    EXPECT_EQ(map.values(), (std::vector<std::string>{"a", "c", "e"}));
+
+    EXPECT_THROW((core::FlatMap<int, int>(std::vector<int>{1, 2}, std::vector<int>{1})),
+                 std::invalid_argument);
+}
+
+TEST(FlatMapTest, MatchesStdMapUnderRandomOperations) {
+    std::mt19937 rng(7);
+    std::map<int, int> reference;
+    core::FlatMap<int, int> map;
+    for (int step = 0; step < 5000; ++step) {
+        const int key = static_cast<int>(rng() % 300);
+        switch (rng() % 4) {
+            case 0:
+                reference[key] = step;
+                map[key] = step;
+                break;
+            case 1:
+                EXPECT_EQ(map.erase(key), reference.erase(key));
+                break;
+            case 2:
+                EXPECT_EQ(map.insert({key, step}).second, reference.insert({key, step}).second);
+                break;
+            default:
+                EXPECT_EQ(map.contains(key), reference.count(key) == 1);
+                break;
+        }
+    }
+    ASSERT_EQ(map.size(), reference.size());
+    auto expected = reference.begin();
+    for (const auto& [key, value] : map) {
+        EXPECT_EQ(key, expected->first);
+        EXPECT_EQ(value, expected->second);
+        ++expected;
+    }
+}
+
+TEST(FlatMapTest, HeterogeneousLookupAndAccess) {
+    core::FlatMap<std::string, int> ages{{"Bob", 25}, {"Alice", 30}};
+    ages["Carol"] = 41;
+
+    const std::string_view alice = "Alice";
+    auto it = ages.find(alice);
+    ASSERT_NE(it, ages.end());
+    EXPECT_EQ(it->first, "Alice");
+    it->second += 1;
+    EXPECT_EQ(ages.at("Alice"), 31);
+    EXPECT_TRUE(ages.contains("Carol"));
+    EXPECT_EQ(ages.count(std::string_view("Dave")), 0u);
+    EXPECT_THROW(ages.at("Dave"), std::out_of_range);
+
+    EXPECT_FALSE(ages.try_emplace("Bob", 99).second);
+    EXPECT_EQ(ages.at("Bob"), 25);
+    ages.insert_or_assign("Bob", 26);
+    EXPECT_EQ(ages.at("Bob"), 26);
+    EXPECT_EQ(ages.lower_bound("B")->first, "Bob");
+    EXPECT_EQ(ages.upper_bound("Bob")->first, "Carol");
+}
+
+static_assert(std::random_access_iterator<core::FlatMap<int, int>::iterator>);
+static_assert(std::random_access_iterator<core::FlatMap<int, int>::const_iterator>);
+static_assert(std::ranges::random_access_range<const core::FlatMap<std::string, int>>);
+
+TEST(FlatMapTest, IteratorsAreRandomAccess) {
+    core::FlatMap<int, int> squares;
+    for (int i = 9; i >= 0; --i) {
+        squares.emplace(i, i * i);
+    }
+    auto first = squares.begin();
+    EXPECT_EQ(squares.end() - first, 10);
+    EXPECT_EQ(first[3].second, 9);
+    EXPECT_EQ((first + 4)->second, 16);
+    // Legacy category is input (proxy reference), so std::ranges::prev, not std::prev
+    EXPECT_EQ(std::ranges::prev(squares.cend())->first, 9);
+    EXPECT_EQ(squares.rbegin()->first, 9);
+
+    auto next = squares.erase(squares.begin() + 2, squares.begin() + 5);  // drops 2, 3, 4
+    EXPECT_EQ(next->first, 5);
+    squares.erase(squares.begin());
+    EXPECT_EQ(squares.keys(), (std::vector<int>{1, 5, 6, 7, 8, 9}));
+}
+
+TEST(FlatMapTest, MoveOnlyValues) {
+    core::FlatMap<int, std::unique_ptr<int>> owners;
+    owners.try_emplace(2, std::make_unique<int>(20));
+    owners.try_emplace(1, std::make_unique<int>(10));
+    EXPECT_EQ(*owners.at(1), 10);
+    EXPECT_EQ(*owners.begin()->second, 10);
+}
+
+TEST(FlatSetTest, BulkAndRangeInsertDedupe) {
+    core::FlatSet<int> set{7, 2, 5, 3, 2};
+    EXPECT_EQ(set.keys(), (std::vector<int>{2, 3, 5, 7}));
+
+    set.insert({11, 3, 1});
+    EXPECT_EQ(set.keys(), (std::vector<int>{1, 2, 3, 5, 7, 11}));
+    EXPECT_FALSE(set.insert(5).second);
+    EXPECT_TRUE(set.insert(4).second);
+    EXPECT_EQ(set.erase(7), 1u);
+    EXPECT_EQ(set.erase(8), 0u);
+    EXPECT_EQ(*set.lower_bound(6), 11);
+    EXPECT_EQ(std::move(set).extract(), (std::vector<int>{1, 2, 3, 4, 5, 11}));
+}
+
+TEST(FlatSetTest, HeterogeneousLookup) {
+    core::FlatSet<std::string> names(std::vector<std::string>{"carol", "alice", "bob"});
+    EXPECT_TRUE(names.contains(std::string_view("bob")));
+    EXPECT_TRUE(names.contains("alice"));
+    EXPECT_FALSE(names.contains("dave"));
+    EXPECT_EQ(names.erase(std::string_view("alice")), 1u);
+    EXPECT_EQ(*names.begin(), "bob");
+
+    core::FlatSet<std::string> sorted(core::sorted_unique, {"a", "b"});
+    EXPECT_EQ(sorted.size(), 2u);
+}
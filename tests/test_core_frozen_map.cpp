@@ -0,0 +1,100 @@
+#include <gtest/gtest.h>
+#include "core/frozen_map.hpp"
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace {
+
+enum class Token { If, Else, While, For, Return };
+
+constexpr auto kKeywords = core::makeFrozenMap<std::string_view, Token>({
+    {"if", Token::If},
+    {"else", Token::Else},
+    {"while", Token::While},
+    {"for", Token::For},
+    {"return", Token::Return},
+});
+
+// Lookups are usable in constant expressions
+static_assert(kKeywords.at("while") == Token::While);
+static_assert(kKeywords.contains("return"));
+static_assert(!kKeywords.contains("goto"));
+static_assert(kKeywords.size() == 5);
+
+}  // namespace
+
+TEST(FrozenMapTest, StringKeysFindHitsAndRejectsMisses) {
+    for (const auto& [word, token] : kKeywords) {
+        auto it = kKeywords.find(word);
+        ASSERT_NE(it, kKeywords.end()) << word;
+        EXPECT_EQ(it->second, token);
+    }
+    // Lookups with runtime strings go through string_view
+    const std::string elseWord = "else";
+    EXPECT_EQ(kKeywords.at(elseWord), Token::Else);
+    EXPECT_EQ(kKeywords.find("els"), kKeywords.end());
+    EXPECT_EQ(kKeywords.find(""), kKeywords.end());
+    EXPECT_EQ(kKeywords.count("iff"), 0u);
+    EXPECT_THROW(kKeywords.at("switch"), std::out_of_range);
+}
+
+TEST(FrozenMapTest, IntegerAndEnumKeys) {
+    constexpr auto codes = core::makeFrozenMap<int, std::string_view>({
+        {200, "OK"}, {301, "Moved"}, {404, "Not Found"}, {500, "Server Error"}, {-1, "Unknown"}});
+    static_assert(codes.at(404) == "Not Found");
+    EXPECT_EQ(codes.at(-1), "Unknown");
+    for (int code = -10; code < 1000; ++code) {
+        const bool expected =
+            code == 200 || code == 301 || code == 404 || code == 500 || code == -1;
+        EXPECT_EQ(codes.contains(code), expected) << code;
+    }
+
+    constexpr auto names = core::makeFrozenMap<Token, std::string_view>({
+        {Token::If, "if"}, {Token::Return, "return"}});
+    static_assert(names.at(Token::Return) == "return");
+    EXPECT_FALSE(names.contains(Token::While));
+}
+
+TEST(FrozenMapTest, FrozenSetMembership) {
+    constexpr auto primes = core::makeFrozenSet<std::uint32_t>({2, 3, 5, 7, 11, 13, 17, 19, 23});
+    static_assert(primes.contains(13));
+    static_assert(!primes.contains(15));
+    std::size_t found = 0;
+    for (std::uint32_t n = 0; n < 100; ++n) {
+        found += primes.count(n);
+    }
+    EXPECT_EQ(found, primes.size());
+
+    constexpr auto single = core::makeFrozenSet<std::string_view>({"only"});
+    EXPECT_TRUE(single.contains("only"));
+    EXPECT_FALSE(single.contains("other"));
+}
+
+TEST(FrozenMapTest, LargeTableIsPerfect) {
+    // Built at runtime here to keep the test fast to compile; same code path
+    constexpr std::size_t n = 1000;
+    std::array<std::pair<std::uint64_t, std::uint32_t>, n> entries{};
+    for (std::size_t i = 0; i < n; ++i) {
+        entries[i] = {i * 0x9e3779b97f4a7c15ULL, static_cast<std::uint32_t>(i)};
+    }
+    const core::FrozenMap<std::uint64_t, std::uint32_t, n> map(entries);
+    for (std::size_t i = 0; i < n; ++i) {
+        auto it = map.find(entries[i].first);
+        ASSERT_NE(it, map.end());
+        ASSERT_EQ(it->second, i);
+    }
+    for (std::uint64_t miss = 1; miss < 2000; miss += 2) {
+        EXPECT_FALSE(map.contains(miss * 0x9e3779b97f4a7c15ULL + 1));
+    }
+}
+
+TEST(FrozenMapTest, DuplicateKeysAreRejected) {
+    // In a constexpr table this is a compile error; at runtime it throws
+    const std::array<std::pair<std::string_view, int>, 3> entries{{{"a", 1}, {"b", 2}, {"a", 3}}};
+    EXPECT_THROW((core::FrozenMap<std::string_view, int, 3>(entries)), std::invalid_argument);
+    EXPECT_THROW((core::FrozenSet<int, 2>(std::array<int, 2>{7, 7})), std::invalid_argument);
+}
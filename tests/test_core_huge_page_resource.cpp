@@ -0,0 +1,70 @@
+#include <gtest/gtest.h>
+#include "core/huge_page_resource.hpp"
+#include <cstdint>
+#include <limits>
+#include <memory_resource>
+#include <new>
+#include <sstream>
+#include <vector>
+
+TEST(HugePageResourceTest, RoundsToWholeHugePages) {
+    using core::HugePageResource;
+    static_assert(HugePageResource::roundUp(1) == HugePageResource::kHugePageSize);
+    static_assert(HugePageResource::roundUp(HugePageResource::kHugePageSize) ==
+                  HugePageResource::kHugePageSize);
+    static_assert(HugePageResource::roundUp(HugePageResource::kHugePageSize + 1) ==
+                  2 * HugePageResource::kHugePageSize);
+
+    HugePageResource resource;
+    void* block = resource.allocate(3 << 20, 64);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(block) % HugePageResource::kHugePageSize, 0u);
+    EXPECT_EQ(resource.stats().bytesMapped, 4u << 20);
+
+    const auto stats = resource.stats();
+    EXPECT_EQ(stats.hugetlb + stats.transparent + stats.regular, 1u);
+    resource.deallocate(block, 3 << 20, 64);
+    EXPECT_EQ(resource.stats().bytesMapped, 0u);
+}
+
+TEST(HugePageResourceTest, OversizedRequestsThrow) {
+    using core::HugePageResource;
+    // volatile keeps the compiler from rejecting the sizes at compile time
+    volatile std::size_t max = std::numeric_limits<std::size_t>::max();
+    const std::size_t page = HugePageResource::kHugePageSize;
+    HugePageResource resource;
+    // Each of these wraps either the round-up or the alignment slack
+    EXPECT_THROW((void)resource.allocate(max, 64), std::bad_alloc);
+    EXPECT_THROW((void)resource.allocate(max - page + 2, 64), std::bad_alloc);
+    EXPECT_THROW((void)resource.allocate(max - page, 64), std::bad_alloc);
+    EXPECT_THROW((void)resource.allocate(max / 2 + 1, max / 2 + 1), std::bad_alloc);
+    EXPECT_EQ(resource.stats().bytesMapped, 0u);
+}
+
+TEST(HugePageResourceTest, BacksPmrContainers) {
+    core::HugePageResource resource(core::HugePageResource::Policy::TransparentOnly);
+    {
+        std::pmr::vector<std::uint64_t> table(&resource);
+        table.resize(1 << 20);  // 8 MiB
+        for (std::size_t i = 0; i < table.size(); ++i) {
+            table[i] = i;
+        }
+        EXPECT_EQ(table[12345], 12345u);
+        EXPECT_LE(core::HugePageResource::hugeBytesAt(table.data()), 8u << 20);
+    }
+    EXPECT_EQ(resource.stats().hugetlb, 0u);
+    EXPECT_EQ(resource.stats().bytesMapped, 0u);
+    EXPECT_TRUE(resource.is_equal(resource));
+    EXPECT_FALSE(resource.is_equal(*std::pmr::new_delete_resource()));
+}
+
+TEST(HugePageResourceTest, ReportsSystemState) {
+    core::HugePageResource resource;
+    void* block = resource.allocate(1);
+    std::ostringstream report;
+    resource.writeReport(report);
+    resource.deallocate(block, 1);
+
+    EXPECT_FALSE(core::HugePageResource::systemInfo().transparentMode.empty());
+    EXPECT_NE(report.str().find("transparent huge pages:"), std::string::npos);
+    EXPECT_NE(report.str().find("mapped: 2048 KiB"), std::string::npos);
+}
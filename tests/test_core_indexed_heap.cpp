@@ -0,0 +1,152 @@
+#include <gtest/gtest.h>
+#include "core/indexed_heap.hpp"
+#include <functional>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+// Replays random pushes, pops, updates and erases against a std::set of
+// (priority, handle) pairs and checks the top after every step
+template<std::size_t D>
+void checkAgainstReference(std::uint32_t seed) {
+    core::IndexedHeap<int, int, D, std::greater<>> heap;
+    std::set<std::pair<int, std::uint32_t>> reference;
+    std::map<std::uint32_t, int> live;  // handle -> priority
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> priority(0, 500);
+
+    for (int step = 0; step < 20000; ++step) {
+        const unsigned op = rng() % 10;
+        if (op < 4 || live.empty()) {
+            const int p = priority(rng);
+            const auto handle = heap.push(step, p);
+            ASSERT_FALSE(live.count(handle));
+            live[handle] = p;
+            reference.insert({p, handle});
+        } else {
+            auto it = live.begin();
+            std::advance(it, rng() % live.size());
+            const auto [handle, old] = *it;
+            if (op < 7) {
+                const int p = priority(rng);
+                heap.update(handle, p);
+                reference.erase({old, handle});
+                reference.insert({p, handle});
+                it->second = p;
+            } else if (op < 9) {
+                heap.erase(handle);
+                reference.erase({old, handle});
+                live.erase(it);
+                EXPECT_FALSE(heap.contains(handle));
+            } else {
+                const int top = heap.topPriority();
+                ASSERT_EQ(top, reference.begin()->first);
+                const auto popped = heap.topHandle();
+                heap.pop();
+                reference.erase({top, popped});
+                live.erase(popped);
+            }
+        }
+        ASSERT_EQ(heap.size(), reference.size());
+        if (!reference.empty()) {
+            ASSERT_EQ(heap.topPriority(), reference.begin()->first);
+            ASSERT_EQ(heap.priority(heap.topHandle()), heap.topPriority());
+        }
+    }
+    while (!heap.empty()) {
+        ASSERT_EQ(heap.pop().second, reference.begin()->first);
+        reference.erase(reference.begin());
+    }
+}
+
+}  // namespace
+
+TEST(IndexedHeapTest, PopsInPriorityOrder) {
+    core::IndexedHeap<std::string, int> heap;  // max-heap, like std::priority_queue
+    heap.push("low", 1);
+    heap.push("high", 9);
+    heap.push("mid", 5);
+    EXPECT_EQ(heap.size(), 3u);
+    EXPECT_EQ(heap.topKey(), "high");
+    EXPECT_EQ(heap.topPriority(), 9);
+
+    std::vector<std::string> order;
+    while (!heap.empty()) {
+        order.push_back(heap.pop().first);
+    }
+    EXPECT_EQ(order, (std::vector<std::string>{"high", "mid", "low"}));
+}
+
+TEST(IndexedHeapTest, UpdateMovesEntriesBothWays) {
+    core::IndexedHeap<std::string, double, 4, std::greater<>> deadlines;  // earliest first
+    const auto a = deadlines.push("a", 10.0);
+    const auto b = deadlines.push("b", 20.0);
+    const auto c = deadlines.push("c", 30.0);
+    EXPECT_EQ(deadlines.topKey(), "a");
+
+    deadlines.update(c, 5.0);  // decrease-key
+    EXPECT_EQ(deadlines.topKey(), "c");
+    deadlines.update(c, 50.0);  // and back down
+    EXPECT_EQ(deadlines.topKey(), "a");
+    deadlines.update(a, 25.0);
+    EXPECT_EQ(deadlines.topKey(), "b");
+    EXPECT_EQ(deadlines.key(a), "a");
+    EXPECT_EQ(deadlines.priority(a), 25.0);
+    EXPECT_EQ(deadlines.size(), 3u);
+
+    deadlines.erase(b);
+    EXPECT_FALSE(deadlines.contains(b));
+    EXPECT_EQ(deadlines.pop(), (std::pair<std::string, double>{"a", 25.0}));
+    EXPECT_EQ(deadlines.pop(), (std::pair<std::string, double>{"c", 50.0}));
+    EXPECT_TRUE(deadlines.empty());
+}
+
+TEST(IndexedHeapTest, RandomOperationsMatchReference) {
+    checkAgainstReference<2>(1);
+    checkAgainstReference<4>(2);
+    checkAgainstReference<8>(3);
+}
+
+TEST(IndexedHeapTest, HandlesAreCheckedAndReused) {
+    core::IndexedHeap<int, int> heap;
+    const auto first = heap.push(1, 1);
+    const auto second = heap.push(2, 2);
+    EXPECT_NE(first, second);
+
+    heap.erase(first);
+    EXPECT_THROW(heap.erase(first), std::out_of_range);
+    EXPECT_THROW(heap.update(first, 3), std::out_of_range);
+    EXPECT_THROW(heap.key(first), std::out_of_range);
+    EXPECT_THROW(heap.priority(12345), std::out_of_range);
+
+    // The freed slot is recycled for the next push
+    EXPECT_EQ(heap.push(3, 3), first);
+    EXPECT_EQ(heap.key(first), 3);
+
+    heap.clear();
+    EXPECT_TRUE(heap.empty());
+    EXPECT_FALSE(heap.contains(second));
+}
+
+TEST(IndexedHeapTest, MoveOnlyKeys) {
+    core::IndexedHeap<std::unique_ptr<int>, int> heap;
+    std::vector<core::IndexedHeap<std::unique_ptr<int>, int>::Handle> handles;
+    for (int i = 0; i < 100; ++i) {
+        handles.push_back(heap.push(std::make_unique<int>(i), i));
+    }
+    for (int i = 0; i < 100; i += 2) {
+        heap.update(handles[static_cast<std::size_t>(i)], 1000 + i);  // evens jump ahead
+    }
+    auto [key, priority] = heap.pop();
+    EXPECT_EQ(*key, 98);
+    EXPECT_EQ(priority, 1098);
+    EXPECT_EQ(*heap.topKey(), 96);
+}
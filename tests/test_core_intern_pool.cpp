@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+#include "core/intern_pool.hpp"
+#include "core/utils.hpp"
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+TEST(InternPoolTest, EqualStringsShareOneSymbol) {
+    core::InternPool pool;
+    core::Symbol a = pool.intern("window.width");
+    core::Symbol b = pool.intern(std::string("window.") + "width");
+    core::Symbol c = pool.intern("window.height");
+
+    EXPECT_TRUE(a.valid());
+    EXPECT_EQ(a, b);
+    EXPECT_NE(a, c);
+    EXPECT_EQ(pool.size(), 2u);
+    EXPECT_EQ(pool.view(a), "window.width");
+    EXPECT_EQ(pool.view(a).data()[pool.view(a).size()], '\0');
+}
+
+TEST(InternPoolTest, FindDoesNotInsert) {
+    core::InternPool pool;
+    EXPECT_FALSE(pool.find("missing"));
+    EXPECT_EQ(pool.size(), 0u);
+    EXPECT_EQ(pool.view(core::Symbol()), "");
+
+    core::Symbol empty = pool.intern("");
+    EXPECT_TRUE(empty.valid());
+    EXPECT_EQ(pool.find(""), empty);
+    EXPECT_EQ(pool.view(empty), "");
+}
+
+TEST(InternPoolTest, ViewsStayValidAcrossGrowth) {
+    core::InternPool pool;
+    core::Symbol first = pool.intern("first");
+    const char* firstData = pool.view(first).data();
+
+    std::vector<core::Symbol> symbols;
+    for (int i = 0; i < 20000; ++i) {
+        symbols.push_back(pool.intern("key-" + std::to_string(i)));
+    }
+    pool.intern(std::string(100000, 'x'));  // larger than one arena chunk
+
+    EXPECT_EQ(pool.view(first).data(), firstData);
+    for (int i = 0; i < 20000; ++i) {
+        ASSERT_EQ(pool.find("key-" + std::to_string(i)), symbols[static_cast<std::size_t>(i)]);
+    }
+    std::unordered_set<core::Symbol> distinct(symbols.begin(), symbols.end());
+    EXPECT_EQ(distinct.size(), symbols.size());
+    EXPECT_GT(pool.arenaBytes(), 100000u);
+}
+
+TEST(InternPoolTest, ConcurrentInternAgreesOnSymbols) {
+    core::InternPool pool;
+    constexpr int kThreads = 4;
+    constexpr int kKeys = 5000;
+    std::vector<std::vector<core::Symbol>> seen(kThreads);
+    std::atomic<int> lookupsMissed{0};
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&, t] {
+            auto& mine = seen[static_cast<std::size_t>(t)];
+            for (int i = 0; i < kKeys; ++i) {
+                // Threads walk the keys in different orders to race on inserts
+                const int key = (t % 2 == 0) ? i : kKeys - 1 - i;
+                core::Symbol symbol = pool.intern("k" + std::to_string(key));
+                if (pool.find("k" + std::to_string(key)) != symbol) {
+                    ++lookupsMissed;
+                }
+                mine.push_back(symbol);
+            }
+            if (t % 2 != 0) {
+                std::reverse(mine.begin(), mine.end());
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(lookupsMissed.load(), 0);
+    EXPECT_EQ(pool.size(), static_cast<std::size_t>(kKeys));
+    for (int t = 1; t < kThreads; ++t) {
+        EXPECT_EQ(seen[static_cast<std::size_t>(t)], seen[0]);
+    }
+}
+
+TEST(InternPoolTest, ConfigAcceptsSymbolKeys) {
+    core::Config config;
+    const core::Symbol port = core::intern("intern_test.port");
+    config.set(port, 8080);
+    EXPECT_EQ(config.get<int>("intern_test.port"), 8080);
+    EXPECT_EQ(config.get<int>(port), 8080);
+    EXPECT_TRUE(config.has(port));
+
+    config.remove("intern_test.port");
+    EXPECT_FALSE(config.has(port));
+    EXPECT_EQ(config.getOrDefault(port, 1), 1);
+    EXPECT_THROW(config.get<int>(port), std::runtime_error);
+}
+
+TEST(InternPoolTest, LoggerCategoryLevels) {
+    auto& logger = core::Logger::getInstance();
+    const core::Symbol category = core::intern("intern_test");
+    logger.setLevel(category, core::LogLevel::Error);
+
+    testing::internal::CaptureStdout();
+    logger.warning(category, "hidden");
+    logger.error(category, "shown");
+    const std::string output = testing::internal::GetCapturedStdout();
+
+    EXPECT_EQ(output.find("hidden"), std::string::npos);
+    EXPECT_NE(output.find("[intern_test]: shown"), std::string::npos);
+}
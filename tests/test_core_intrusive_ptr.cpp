@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+#include "core/alloc_tracker.hpp"
+#include "core/intrusive_ptr.hpp"
+#include <atomic>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+namespace {
+
+struct Widget : core::RefCounted<Widget> {
+    static inline int live = 0;
+    std::string name;
+
+    explicit Widget(std::string n) : name(std::move(n)) { ++live; }
+    Widget(const Widget& other) : RefCounted(other), name(other.name) { ++live; }
+    virtual ~Widget() { --live; }
+};
+
+struct Button final : Widget {
+    explicit Button(std::string n) : Widget(std::move(n)) {}
+};
+
+struct LocalNode : core::RefCounted<LocalNode, core::NonAtomicRefCount> {
+    int value = 0;
+};
+
+}  // namespace
+
+TEST(IntrusivePtrTest, CountsReferencesAndDeletesAtZero) {
+    {
+        auto a = core::make_intrusive<Widget>("panel");
+        EXPECT_EQ(a->refCount(), 1u);
+        {
+            auto b = a;
+            core::IntrusivePtr<Widget> c;
+            c = b;
+            EXPECT_EQ(a->refCount(), 3u);
+            EXPECT_EQ(b, c);
+        }
+        EXPECT_EQ(a->refCount(), 1u);
+
+        auto moved = std::move(a);
+        EXPECT_EQ(a, nullptr);
+        EXPECT_EQ(moved->refCount(), 1u);
+        EXPECT_EQ(Widget::live, 1);
+    }
+    EXPECT_EQ(Widget::live, 0);
+}
+
+TEST(IntrusivePtrTest, OneAllocationAndOnePointerWide) {
+    static_assert(sizeof(core::IntrusivePtr<Widget>) == sizeof(void*));
+
+    core::alloc::AllocationScope scope;
+    auto node = core::make_intrusive<LocalNode>();
+    std::vector<core::IntrusivePtr<LocalNode>> copies;
+    copies.reserve(10);
+    const auto beforeCopies = scope.allocations();
+    for (int i = 0; i < 10; ++i) {
+        copies.push_back(node);
+    }
+    EXPECT_EQ(beforeCopies, 2u);  // the node and the vector buffer
+    EXPECT_EQ(scope.allocations(), beforeCopies);
+    EXPECT_EQ(node->refCount(), 11u);
+}
+
+TEST(IntrusivePtrTest, ConvertsAlongHierarchyAndAdoptsRawReferences) {
+    core::IntrusivePtr<Button> button = core::make_intrusive<Button>("ok");
+    core::IntrusivePtr<Widget> widget = button;
+    EXPECT_EQ(widget->refCount(), 2u);
+
+    auto back = core::static_pointer_cast<Button>(widget);
+    EXPECT_EQ(back.get(), button.get());
+
+    Widget* raw = back.detach();
+    EXPECT_EQ(raw->refCount(), 3u);
+    core::IntrusivePtr<Widget> adopted(raw, false);
+    EXPECT_EQ(adopted->refCount(), 3u);
+
+    std::unordered_set<core::IntrusivePtr<Widget>> set{widget, adopted};
+    EXPECT_EQ(set.size(), 1u);
+}
+
+TEST(IntrusivePtrTest, CopiedObjectStartsUnshared) {
+    auto original = core::make_intrusive<Widget>("a");
+    auto extra = original;
+    auto copy = core::make_intrusive<Widget>(*original);
+    EXPECT_EQ(copy->refCount(), 1u);
+    EXPECT_EQ(copy->name, "a");
+}
+
+TEST(IntrusivePtrTest, AtomicCountSurvivesConcurrentCopies) {
+    auto shared = core::make_intrusive<Widget>("shared");
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([shared]() {
+            for (int i = 0; i < 10000; ++i) {
+                core::IntrusivePtr<Widget> copy = shared;
+                core::IntrusivePtr<Widget> another = copy;
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(shared->refCount(), 1u);
+}
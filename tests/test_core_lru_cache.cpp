@@ -0,0 +1,147 @@
+#include <gtest/gtest.h>
+#include "core/lru_cache.hpp"
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+/// Manually advanced clock for TTL tests.
+struct FakeClock {
+    using rep = std::int64_t;
+    using period = std::milli;
+    using duration = std::chrono::duration<rep, period>;
+    using time_point = std::chrono::time_point<FakeClock>;
+    static constexpr bool is_steady = true;
+
+    static inline std::atomic<rep> nowMs{0};
+    static time_point now() noexcept { return time_point(duration(nowMs.load())); }
+};
+
+template<typename Cache>
+typename Cache::Options singleShard(std::size_t maxEntries, core::EvictionPolicy policy) {
+    typename Cache::Options options;
+    options.maxEntries = maxEntries;
+    options.policy = policy;
+    options.shards = 1;
+    return options;
+}
+
+}  // namespace
+
+TEST(LruCacheTest, EvictsLeastRecentlyUsed) {
+    using Cache = core::LruCache<int, std::string>;
+    Cache cache(singleShard<Cache>(3, core::EvictionPolicy::kLru));
+    cache.put(1, "one");
+    cache.put(2, "two");
+    cache.put(3, "three");
+    EXPECT_EQ(cache.get(1), "one");  // 2 is now the oldest
+    cache.put(4, "four");
+    EXPECT_FALSE(cache.get(2).has_value());
+    EXPECT_EQ(cache.get(3), "three");
+    EXPECT_EQ(cache.get(4), "four");
+    cache.put(3, "THREE");  // replacing refreshes recency without inserting
+    EXPECT_EQ(cache.size(), 3u);
+    EXPECT_EQ(cache.get(3), "THREE");
+
+    const auto stats = cache.stats();
+    EXPECT_EQ(stats.hits, 4u);
+    EXPECT_EQ(stats.misses, 1u);
+    EXPECT_EQ(stats.insertions, 4u);
+    EXPECT_EQ(stats.evictions, 1u);
+    EXPECT_DOUBLE_EQ(stats.hitRate(), 0.8);
+    EXPECT_TRUE(cache.erase(4));
+    EXPECT_FALSE(cache.erase(4));
+}
+
+TEST(LruCacheTest, ClockGivesReferencedEntriesASecondChance) {
+    using Cache = core::LruCache<int, int>;
+    Cache cache(singleShard<Cache>(3, core::EvictionPolicy::kClock));
+    cache.put(1, 10);
+    cache.put(2, 20);
+    cache.put(3, 30);
+    EXPECT_EQ(cache.get(1), 10);  // sets 1's reference bit
+    cache.put(4, 40);             // 1 is oldest but referenced: 2 goes
+    EXPECT_EQ(cache.get(1), 10);
+    EXPECT_FALSE(cache.get(2).has_value());
+    EXPECT_EQ(cache.get(4), 40);  // the new entry survives its own insertion
+    EXPECT_EQ(cache.stats().evictions, 1u);
+    EXPECT_EQ(cache.policy(), core::EvictionPolicy::kClock);
+}
+
+TEST(LruCacheTest, ByteLimitUsesWeigher) {
+    using Cache = core::LruCache<std::string, std::string>;
+    Cache::Options options;
+    options.maxBytes = 100;
+    options.shards = 1;
+    options.weigher = [](const std::string& key, const std::string& value) {
+        return key.size() + value.size();
+    };
+    Cache cache(options);
+    cache.put("a", std::string(40, 'x'));
+    cache.put("b", std::string(40, 'y'));
+    EXPECT_EQ(cache.bytes(), 82u);
+    cache.put("c", std::string(40, 'z'));  // 123 bytes: "a" must go
+    EXPECT_FALSE(cache.get("a").has_value());
+    EXPECT_EQ(cache.bytes(), 82u);
+    cache.put("huge", std::string(200, 'h'));  // larger than the whole budget
+    EXPECT_FALSE(cache.get("huge").has_value());
+    EXPECT_EQ(cache.size(), 2u);
+}
+
+TEST(LruCacheTest, EntriesExpireAfterTtl) {
+    using Cache = core::LruCache<int, int, std::hash<int>, FakeClock>;
+    for (auto policy : {core::EvictionPolicy::kLru, core::EvictionPolicy::kClock}) {
+        FakeClock::nowMs = 0;
+        Cache::Options options = singleShard<Cache>(0, policy);
+        options.ttl = FakeClock::duration(100);
+        Cache cache(options);
+        cache.put(1, 1);
+        cache.put(2, 2, FakeClock::duration(500));
+        cache.put(3, 3, FakeClock::duration::zero());  // never expires
+        FakeClock::nowMs = 99;
+        EXPECT_EQ(cache.get(1), 1);
+        FakeClock::nowMs = 100;
+        EXPECT_FALSE(cache.get(1).has_value());
+        EXPECT_EQ(cache.get(2), 2);
+        FakeClock::nowMs = 10'000;
+        EXPECT_FALSE(cache.get(2).has_value());
+        EXPECT_EQ(cache.get(3), 3);
+        EXPECT_EQ(cache.getOrCompute(1, [] { return 11; }), 11);
+        EXPECT_EQ(cache.get(1), 11);
+    }
+}
+
+TEST(LruCacheTest, ConcurrentUseKeepsLimitsAndCounters) {
+    for (auto policy : {core::EvictionPolicy::kLru, core::EvictionPolicy::kClock}) {
+        core::LruCache<int, int>::Options options;
+        options.maxEntries = 1024;
+        options.policy = policy;
+        options.shards = 8;
+        core::LruCache<int, int> cache(options);
+        constexpr int kThreads = 8;
+        constexpr int kOps = 20'000;
+        std::atomic<int> wrong{0};
+        std::vector<std::thread> threads;
+        for (int t = 0; t < kThreads; ++t) {
+            threads.emplace_back([&, t] {
+                for (int i = 0; i < kOps; ++i) {
+                    const int key = (i * 7 + t * 13) % 2048;
+                    if (cache.getOrCompute(key, [key] { return key * 2; }) != key * 2) {
+                        ++wrong;
+                    }
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        EXPECT_EQ(wrong.load(), 0);
+        EXPECT_LE(cache.size(), 1024u);
+        const auto stats = cache.stats();
+        EXPECT_EQ(stats.hits + stats.misses, static_cast<std::uint64_t>(kThreads * kOps));
+        EXPECT_EQ(stats.insertions - stats.evictions, cache.size());
+    }
+}
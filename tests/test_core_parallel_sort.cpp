@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+#include "core/parallel_sort.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+class ParallelSortTest : public ::testing::Test {
+protected:
+    static std::vector<std::uint64_t> randomKeys(std::size_t count, std::uint64_t modulo = 0) {
+        std::mt19937_64 rng(12345);
+        std::vector<std::uint64_t> keys(count);
+        for (auto& key : keys) {
+            key = modulo ? rng() % modulo : rng();
+        }
+        return keys;
+    }
+
+    core::ThreadPool pool{4};
+    static constexpr std::size_t kLarge = core::kParallelSortThreshold * 4;
+};
+
+TEST_F(ParallelSortTest, SmallInputUsesSequentialFallback) {
+    std::vector<int> values{5, 2, 8, 1, 9, 3};
+    core::parallel_sort(pool, values.begin(), values.end());
+    EXPECT_EQ(values, (std::vector<int>{1, 2, 3, 5, 8, 9}));
+}
+
+TEST_F(ParallelSortTest, LargeInputMatchesStdSort) {
+    auto keys = randomKeys(kLarge);
+    auto expected = keys;
+    std::sort(expected.begin(), expected.end());
+
+    core::parallel_sort(pool, keys.begin(), keys.end());
+    EXPECT_EQ(keys, expected);
+}
+
+TEST_F(ParallelSortTest, HeavyDuplicatesAndCustomComparator) {
+    auto keys = randomKeys(kLarge, 7);
+    auto expected = keys;
+    std::sort(expected.begin(), expected.end(), std::greater<>{});
+
+    core::parallel_sort(pool, keys.begin(), keys.end(), std::greater<>{});
+    EXPECT_EQ(keys, expected);
+}
+
+TEST_F(ParallelSortTest, StableSortWithProjectionKeepsOrder) {
+    struct Record {
+        std::uint32_t key;
+        std::uint32_t sequence;
+        std::string payload;
+    };
+
+    const auto keys = randomKeys(kLarge, 1000);
+    std::vector<Record> records;
+    records.reserve(keys.size());
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+        records.push_back({static_cast<std::uint32_t>(keys[i]), static_cast<std::uint32_t>(i),
+                           std::to_string(i)});
+    }
+
+    core::parallel_stable_sort(pool, records.begin(), records.end(), {}, &Record::key);
+
+    for (std::size_t i = 1; i < records.size(); ++i) {
+        ASSERT_LE(records[i - 1].key, records[i].key);
+        if (records[i - 1].key == records[i].key) {
+            ASSERT_LT(records[i - 1].sequence, records[i].sequence);
+        }
+        ASSERT_EQ(records[i].payload, std::to_string(records[i].sequence));
+    }
+}
+
+TEST_F(ParallelSortTest, RangeOverloadUsesSharedPool) {
+    auto keys = randomKeys(1000);
+    core::parallel_sort(keys);
+    EXPECT_TRUE(std::is_sorted(keys.begin(), keys.end()));
+}
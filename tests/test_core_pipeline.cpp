@@ -0,0 +1,117 @@
+#include <gtest/gtest.h>
+#include "core/pipeline.hpp"
+#include <atomic>
+#include <chrono>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+class PipelineTest : public ::testing::Test {
+protected:
+    // Source emitting 0..count-1 as strings
+    static auto counter(int count) {
+        return [next = 0, count]() mutable -> std::optional<std::string> {
+            if (next == count) {
+                return std::nullopt;
+            }
+            return std::to_string(next++);
+        };
+    }
+
+    core::ThreadPool pool{3};
+};
+
+TEST_F(PipelineTest, InOrderSinkSeesSourceOrder) {
+    std::vector<int> emitted;
+    core::Pipeline pipeline(8);
+    pipeline.addSource<std::string>("parse", counter(500))
+        .addStage<std::string, int>("transform", core::StageMode::Parallel,
+                                    [](std::string text) {
+                                        const int value = std::stoi(text);
+                                        if (value % 7 == 0) {
+                                            std::this_thread::sleep_for(std::chrono::microseconds(200));
+                                        }
+                                        return value * 2;
+                                    })
+        .addSink<int>("emit", core::StageMode::SerialInOrder,
+                      [&](int value) { emitted.push_back(value); });
+    pipeline.run(pool);
+
+    ASSERT_EQ(emitted.size(), 500u);
+    for (int i = 0; i < 500; ++i) {
+        EXPECT_EQ(emitted[static_cast<std::size_t>(i)], i * 2);
+    }
+
+    auto stats = pipeline.stats();
+    ASSERT_EQ(stats.size(), 3u);
+    EXPECT_EQ(stats[0].name, "parse");
+    for (const auto& stage : stats) {
+        EXPECT_EQ(stage.processed, 500u);
+        EXPECT_EQ(stage.queueDepth, 0u);
+        EXPECT_LE(stage.maxQueueDepth, pipeline.maxTokens());
+    }
+}
+
+TEST_F(PipelineTest, TokensCapItemsInFlight) {
+    std::atomic<int> inFlight{0};
+    std::atomic<int> peak{0};
+    int total = 0;
+
+    core::Pipeline pipeline(4);
+    pipeline
+        .addSource<int>("source",
+                        [&, next = 0]() mutable -> std::optional<int> {
+                            if (next == 200) {
+                                return std::nullopt;
+                            }
+                            const int now = inFlight.fetch_add(1) + 1;
+                            int seen = peak.load();
+                            while (now > seen && !peak.compare_exchange_weak(seen, now)) {
+                            }
+                            return next++;
+                        })
+        .addStage<int, int>("work", core::StageMode::Parallel,
+                            [](int value) {
+                                std::this_thread::sleep_for(std::chrono::microseconds(50));
+                                return value;
+                            })
+        .addSink<int>("sum", core::StageMode::SerialOutOfOrder, [&](int value) {
+            total += value;
+            inFlight.fetch_sub(1);
+        });
+    pipeline.run(pool);
+
+    EXPECT_EQ(total, 199 * 200 / 2);
+    EXPECT_LE(peak.load(), 4);
+}
+
+TEST_F(PipelineTest, StageExceptionStopsRun) {
+    core::Pipeline pipeline(8);
+    pipeline.addSource<std::string>("parse", counter(1000))
+        .addSink<std::string>("emit", core::StageMode::Parallel, [](const std::string& text) {
+            if (std::stoi(text) >= 42) {
+                throw std::runtime_error("bad record");
+            }
+        });
+    EXPECT_THROW(pipeline.run(pool), std::runtime_error);
+
+    // The pipeline can be run again after a failure; the source resumes where it stopped
+    EXPECT_THROW(pipeline.run(pool), std::runtime_error);
+}
+
+TEST_F(PipelineTest, TypeMismatchAndMisuseThrow) {
+    core::Pipeline mismatched(4);
+    mismatched.addSource<std::string>("parse", counter(3))
+        .addSink<int>("emit", core::StageMode::Parallel, [](int) {});
+    EXPECT_THROW(mismatched.run(pool), std::runtime_error);
+
+    core::Pipeline noSource;
+    EXPECT_THROW(noSource.addSink<int>("emit", core::StageMode::Parallel, [](int) {}),
+                 std::runtime_error);
+
+    core::Pipeline noSink;
+    noSink.addSource<std::string>("parse", counter(3));
+    EXPECT_THROW(noSink.run(pool), std::runtime_error);
+}
@@ -0,0 +1,157 @@
+#include <gtest/gtest.h>
+#include "core/radix_sort.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+class RadixSortTest : public ::testing::Test {
+protected:
+    static std::vector<std::uint64_t> randomKeys(std::size_t count, std::uint64_t modulo = 0) {
+        std::mt19937_64 rng(12345);
+        std::vector<std::uint64_t> keys(count);
+        for (auto& key : keys) {
+            key = modulo ? rng() % modulo : rng();
+        }
+        return keys;
+    }
+
+    static std::vector<std::string> randomWords(std::size_t count) {
+        std::mt19937_64 rng(777);
+        std::vector<std::string> words(count);
+        for (auto& word : words) {
+            // Short alphabet and shared prefixes exercise deep buckets
+            word = rng() % 4 == 0 ? "prefix/" : "";
+            const std::size_t length = rng() % 12;
+            for (std::size_t i = 0; i < length; ++i) {
+                word.push_back(static_cast<char>('a' + rng() % 6));
+            }
+        }
+        return words;
+    }
+
+    core::ThreadPool pool{4};
+    static constexpr std::size_t kLarge = core::kParallelSortThreshold * 4;
+};
+
+TEST_F(RadixSortTest, UnsignedKeysMatchStdSort) {
+    for (std::size_t count : {std::size_t{0}, std::size_t{1}, std::size_t{50}, kLarge}) {
+        auto keys = randomKeys(count);
+        auto expected = keys;
+        std::sort(expected.begin(), expected.end());
+
+        core::radix_sort(keys);
+        EXPECT_EQ(keys, expected) << "count " << count;
+    }
+
+    // Narrow values in a wide type skip the all-zero high digits
+    auto small = randomKeys(10'000, 300);
+    auto expected = small;
+    std::sort(expected.begin(), expected.end());
+    core::radix_sort(small.begin(), small.end());
+    EXPECT_EQ(small, expected);
+}
+
+TEST_F(RadixSortTest, SignedAndFloatingKeysOrderCorrectly) {
+    std::vector<std::int32_t> ints;
+    std::vector<double> doubles;
+    std::mt19937 rng(9);
+    for (int i = 0; i < 5000; ++i) {
+        ints.push_back(static_cast<std::int32_t>(rng()));
+        doubles.push_back(std::uniform_real_distribution<double>(-1e6, 1e6)(rng));
+    }
+    ints.insert(ints.end(), {0, -1, std::numeric_limits<std::int32_t>::min(),
+                             std::numeric_limits<std::int32_t>::max()});
+    doubles.insert(doubles.end(), {0.0, -std::numeric_limits<double>::infinity(),
+                                   std::numeric_limits<double>::infinity(),
+                                   std::numeric_limits<double>::denorm_min(), -1e-300});
+
+    auto expectedInts = ints;
+    std::sort(expectedInts.begin(), expectedInts.end());
+    core::radix_sort(ints);
+    EXPECT_EQ(ints, expectedInts);
+
+    auto expectedDoubles = doubles;
+    std::sort(expectedDoubles.begin(), expectedDoubles.end());
+    core::radix_sort(doubles);
+    EXPECT_EQ(doubles, expectedDoubles);
+
+    std::vector<float> zeros{0.0f, -0.0f, 1.0f, -1.0f};
+    core::radix_sort(zeros);
+    EXPECT_TRUE(std::signbit(zeros[1]));  // -0.0 before +0.0
+    EXPECT_EQ(zeros, (std::vector<float>{-1.0f, -0.0f, 0.0f, 1.0f}));
+}
+
+TEST_F(RadixSortTest, ProjectionSortIsStable) {
+    struct Record {
+        std::int16_t key;
+        std::uint32_t sequence;
+        std::string payload;
+    };
+
+    const auto keys = randomKeys(20'000, 1000);
+    std::vector<Record> records;
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+        records.push_back({static_cast<std::int16_t>(static_cast<int>(keys[i]) - 500),
+                           static_cast<std::uint32_t>(i), std::to_string(i)});
+    }
+
+    core::radix_sort(records, &Record::key);
+
+    for (std::size_t i = 1; i < records.size(); ++i) {
+        ASSERT_LE(records[i - 1].key, records[i].key);
+        if (records[i - 1].key == records[i].key) {
+            ASSERT_LT(records[i - 1].sequence, records[i].sequence);
+        }
+        ASSERT_EQ(records[i].payload, std::to_string(records[i].sequence));
+    }
+}
+
+TEST_F(RadixSortTest, StringKeysUseMsdSort) {
+    auto words = randomWords(20'000);
+    words.push_back(std::string(5000, 'z'));  // deep shared prefix, no recursion
+    words.push_back(std::string(5001, 'z'));
+    auto expected = words;
+    std::sort(expected.begin(), expected.end());
+
+    core::radix_sort(words);
+    EXPECT_EQ(words, expected);
+
+    // Projection returning a temporary std::string
+    std::vector<int> numbers{42, 7, 1000, 19, 3};
+    core::radix_sort(numbers, [](int value) { return std::to_string(value); });
+    EXPECT_EQ(numbers, (std::vector<int>{1000, 19, 3, 42, 7}));
+}
+
+TEST_F(RadixSortTest, ParallelSortMatchesSequential) {
+    auto keys = randomKeys(kLarge);
+    auto expected = keys;
+    std::sort(expected.begin(), expected.end());
+    core::parallel_radix_sort(pool, keys.begin(), keys.end());
+    EXPECT_EQ(keys, expected);
+
+    struct Pair {
+        std::uint32_t key;
+        std::uint32_t sequence;
+    };
+    const auto small = randomKeys(kLarge, 50);
+    std::vector<Pair> pairs;
+    for (std::size_t i = 0; i < small.size(); ++i) {
+        pairs.push_back({static_cast<std::uint32_t>(small[i]), static_cast<std::uint32_t>(i)});
+    }
+    core::parallel_radix_sort(pool, pairs.begin(), pairs.end(), &Pair::key);
+    for (std::size_t i = 1; i < pairs.size(); ++i) {
+        ASSERT_TRUE(pairs[i - 1].key < pairs[i].key ||
+                    (pairs[i - 1].key == pairs[i].key &&
+                     pairs[i - 1].sequence < pairs[i].sequence));
+    }
+
+    auto words = randomWords(kLarge);
+    auto expectedWords = words;
+    std::sort(expectedWords.begin(), expectedWords.end());
+    core::parallel_radix_sort(pool, words.begin(), words.end());
+    EXPECT_EQ(words, expectedWords);
+}
@@ -0,0 +1,178 @@
+#include <gtest/gtest.h>
+#include "core/alloc_tracker.hpp"
+#include "core/ring_deque.hpp"
+#include <algorithm>
+#include <deque>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+/// Counts live instances to catch leaks and double destruction.
+struct Tracked {
+    static inline int live = 0;
+    int value;
+
+    explicit Tracked(int v = 0) : value(v) { ++live; }
+    Tracked(const Tracked& other) : value(other.value) { ++live; }
+    Tracked(Tracked&& other) noexcept : value(other.value) { ++live; }
+    Tracked& operator=(const Tracked&) = default;
+    Tracked& operator=(Tracked&&) noexcept = default;
+    ~Tracked() { --live; }
+};
+
+}  // namespace
+
+TEST(RingDequeTest, MatchesStdDequeUnderRandomOperations) {
+    std::mt19937 rng(17);
+    core::RingDeque<std::string> ring;
+    std::deque<std::string> reference;
+    for (int step = 0; step < 20'000; ++step) {
+        const std::string value = std::to_string(step);
+        switch (rng() % 5) {
+            case 0:
+                ring.push_front(value);
+                reference.push_front(value);
+                break;
+            case 1:
+            case 2:
+                ring.push_back(value);
+                reference.push_back(value);
+                break;
+            case 3:
+                if (!reference.empty()) {
+                    ring.pop_front();
+                    reference.pop_front();
+                }
+                break;
+            default:
+                if (!reference.empty()) {
+                    ring.pop_back();
+                    reference.pop_back();
+                }
+                break;
+        }
+        ASSERT_EQ(ring.size(), reference.size());
+        if (!reference.empty()) {
+            ASSERT_EQ(ring.front(), reference.front());
+            ASSERT_EQ(ring.back(), reference.back());
+        }
+    }
+    EXPECT_TRUE(std::equal(ring.begin(), ring.end(), reference.begin(), reference.end()));
+    EXPECT_TRUE(std::equal(ring.rbegin(), ring.rend(), reference.rbegin(), reference.rend()));
+    EXPECT_EQ(ring.at(3), reference.at(3));
+    EXPECT_THROW(ring.at(ring.size()), std::out_of_range);
+}
+
+TEST(RingDequeTest, GrowsGeometricallyAndStopsAllocatingInSteadyState) {
+    core::RingDeque<int> queue;
+    std::vector<std::size_t> capacities;
+    for (int i = 0; i < 1000; ++i) {
+        queue.push_back(i);
+        if (capacities.empty() || capacities.back() != queue.capacity()) {
+            capacities.push_back(queue.capacity());
+        }
+    }
+    for (std::size_t c : capacities) {
+        EXPECT_EQ(c & (c - 1), 0u) << c;  // always a power of two
+    }
+    EXPECT_EQ(capacities.size(), 8u);  // 8, 16, ..., 1024
+
+    // A FIFO that stays within capacity wraps around without allocating
+    core::alloc::AllocationScope scope;
+    for (int i = 1000; i < 100'000; ++i) {
+        queue.pop_front();
+        queue.push_back(i);
+    }
+    EXPECT_EQ(scope.allocations(), 0u);
+    EXPECT_EQ(queue.front(), 99'000);
+    EXPECT_EQ(queue.back(), 99'999);
+}
+
+TEST(RingDequeTest, SegmentsCoverContentsInOrder) {
+    core::RingDeque<int> ring;
+    ring.reserve(16);
+    for (int i = 0; i < 12; ++i) {
+        ring.push_back(i);
+    }
+    for (int i = 0; i < 8; ++i) {
+        ring.pop_front();
+    }
+    for (int i = 12; i < 20; ++i) {
+        ring.push_back(i);  // wraps to the start of the buffer
+    }
+    auto [first, second] = ring.segments();
+    EXPECT_EQ(first.size(), 8u);
+    EXPECT_EQ(second.size(), 4u);
+    std::vector<int> joined(first.begin(), first.end());
+    joined.insert(joined.end(), second.begin(), second.end());
+    std::vector<int> expected(12);
+    std::iota(expected.begin(), expected.end(), 8);
+    EXPECT_EQ(joined, expected);
+
+    const std::span<int> flat = ring.linearize();
+    EXPECT_TRUE(std::equal(flat.begin(), flat.end(), expected.begin(), expected.end()));
+    EXPECT_TRUE(ring.segments().second.empty());
+    EXPECT_EQ(ring.capacity(), 16u);
+}
+
+TEST(RingDequeTest, CopyMoveAndLifetimes) {
+    Tracked::live = 0;
+    {
+        core::RingDeque<Tracked> ring;
+        for (int i = 0; i < 40; ++i) {
+            if (i % 2 == 0) {
+                ring.emplace_back(i);
+            } else {
+                ring.emplace_front(i);
+            }
+        }
+        EXPECT_EQ(Tracked::live, 40);
+
+        core::RingDeque<Tracked> copy(ring);
+        EXPECT_EQ(Tracked::live, 80);
+        core::RingDeque<Tracked> moved(std::move(copy));
+        EXPECT_TRUE(copy.empty());
+        EXPECT_EQ(Tracked::live, 80);
+        for (std::size_t i = 0; i < ring.size(); ++i) {
+            ASSERT_EQ(moved[i].value, ring[i].value);
+        }
+
+        moved.pop_front();
+        moved.pop_back();
+        EXPECT_EQ(Tracked::live, 78);
+        ring = moved;
+        EXPECT_EQ(Tracked::live, 76);
+        moved.clear();
+        EXPECT_EQ(Tracked::live, 38);
+        ring.shrink_to_fit();
+        EXPECT_EQ(ring.capacity(), 64u);
+    }
+    EXPECT_EQ(Tracked::live, 0);
+
+    core::RingDeque<std::unique_ptr<int>> owners;
+    owners.push_back(std::make_unique<int>(1));
+    owners.push_front(std::make_unique<int>(0));
+    EXPECT_EQ(*owners[0], 0);
+    EXPECT_EQ(*owners[1], 1);
+}
+
+TEST(RingDequeTest, PushOfOwnElementSurvivesGrowth) {
+    core::RingDeque<std::string> words{"first", "second", "third", "fourth",
+                                       "fifth", "sixth", "seventh", "eighth"};
+    ASSERT_EQ(words.size(), words.capacity());
+    words.push_back(words.front());  // grows while referring to an element
+    EXPECT_EQ(words.back(), "first");
+
+    while (words.size() < words.capacity()) {
+        words.push_back("filler");
+    }
+    words.push_front(words.back());
+    EXPECT_EQ(words.front(), "filler");
+    EXPECT_EQ(words[1], "first");
+    EXPECT_EQ(words, (core::RingDeque<std::string>(words.begin(), words.end())));
+}
@@ -0,0 +1,274 @@
+#include <gtest/gtest.h>
+#include "core/roaring_bitmap.hpp"
+#include "core/alloc_tracker.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <random>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+std::vector<std::uint32_t> asVector(const std::set<std::uint32_t>& values) {
+    return {values.begin(), values.end()};
+}
+
+// Mixes all three container kinds: a sparse chunk (array), a dense chunk
+// (bitmap) and a long stretch that runOptimize() turns into runs
+std::set<std::uint32_t> mixedValues(std::uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::set<std::uint32_t> values;
+    std::uniform_int_distribution<std::uint32_t> sparse(0, 0xFFFF);
+    for (int i = 0; i < 300; ++i) {
+        values.insert(sparse(rng));
+    }
+    std::uniform_int_distribution<std::uint32_t> dense(0x10000, 0x1FFFF);
+    for (int i = 0; i < 20000; ++i) {
+        values.insert(dense(rng));
+    }
+    const std::uint32_t start = 0x20000 + rng() % 5000;
+    const std::uint32_t length = 30000 + rng() % 20000;
+    for (std::uint32_t v = start; v < start + length; ++v) {
+        values.insert(v);
+    }
+    values.insert(0xFFFFFFFFu - rng() % 10);
+    return values;
+}
+
+core::RoaringBitmap fromSet(const std::set<std::uint32_t>& values, bool optimize) {
+    core::RoaringBitmap bitmap;
+    const std::vector<std::uint32_t> sorted = asVector(values);
+    bitmap.addMany(sorted.data(), sorted.size());
+    if (optimize) {
+        bitmap.runOptimize();
+    }
+    return bitmap;
+}
+
+}  // namespace
+
+TEST(RoaringBitmapTest, RandomOperationsMatchStdSet) {
+    std::mt19937 rng(7);
+    // Narrow range so chunks cross the array/bitmap threshold both ways
+    std::uniform_int_distribution<std::uint32_t> value(0, 3 * 65536);
+    core::RoaringBitmap bitmap;
+    std::set<std::uint32_t> reference;
+
+    for (int step = 0; step < 60000; ++step) {
+        const std::uint32_t v = value(rng);
+        if (step < 40000 || rng() % 2 == 0) {
+            EXPECT_EQ(bitmap.add(v), reference.insert(v).second);
+        } else {
+            EXPECT_EQ(bitmap.remove(v), reference.erase(v) == 1);
+        }
+        if (step % 997 == 0) {
+            EXPECT_EQ(bitmap.contains(v), reference.count(v) == 1);
+        }
+    }
+    ASSERT_EQ(bitmap.size(), reference.size());
+    EXPECT_EQ(bitmap.toVector(), asVector(reference));
+    EXPECT_GT(bitmap.stats().bitmaps, 0u);
+
+    // Removing everything drops every container
+    for (std::uint32_t v : reference) {
+        ASSERT_TRUE(bitmap.remove(v));
+    }
+    EXPECT_TRUE(bitmap.empty());
+    EXPECT_FALSE(bitmap.remove(1));
+}
+
+TEST(RoaringBitmapTest, RangesAndRunContainers) {
+    core::RoaringBitmap bitmap;
+    bitmap.addRange(100, 200000);  // spans four chunks
+    EXPECT_EQ(bitmap.size(), 199900u);
+    EXPECT_EQ(bitmap.stats().runs, 4u);
+    EXPECT_LT(bitmap.memoryBytes(), 1024u);
+    EXPECT_FALSE(bitmap.contains(99));
+    EXPECT_TRUE(bitmap.contains(100));
+    EXPECT_TRUE(bitmap.contains(199999));
+    EXPECT_FALSE(bitmap.contains(200000));
+
+    // Punching holes splits runs; values still add and remove one at a time
+    EXPECT_TRUE(bitmap.remove(150));
+    EXPECT_FALSE(bitmap.contains(150));
+    EXPECT_TRUE(bitmap.add(150));
+    EXPECT_FALSE(bitmap.add(150));
+    EXPECT_TRUE(bitmap.add(200000));  // extends the last run
+    EXPECT_EQ(bitmap.maximum(), 200000u);
+
+    // Every other value: runs would be larger than a bitmap, so they give way
+    core::RoaringBitmap comb;
+    comb.addRange(0, 65536);
+    for (std::uint32_t v = 0; v < 65536; v += 2) {
+        comb.remove(v);
+    }
+    EXPECT_EQ(comb.size(), 32768u);
+    EXPECT_EQ(comb.stats().runs, 0u);
+    EXPECT_FALSE(comb.runOptimize());
+
+    // A plain dense build shrinks to runs on request
+    core::RoaringBitmap built;
+    for (std::uint32_t v = 1000; v < 60000; ++v) {
+        built.add(v);
+    }
+    const std::size_t before = built.memoryBytes();
+    EXPECT_TRUE(built.runOptimize());
+    EXPECT_EQ(built.stats().runs, 1u);
+    EXPECT_LT(built.memoryBytes(), before);
+    EXPECT_EQ(built.size(), 59000u);
+
+    bitmap.addRange(0xFFFFFFF0u, std::uint64_t{1} << 32);
+    EXPECT_EQ(bitmap.maximum(), 0xFFFFFFFFu);
+}
+
+TEST(RoaringBitmapTest, SetOperationsMatchStdAlgorithms) {
+    for (std::uint32_t seed = 1; seed <= 4; ++seed) {
+        const std::set<std::uint32_t> left = mixedValues(seed);
+        const std::set<std::uint32_t> right = mixedValues(seed + 100);
+        std::vector<std::uint32_t> unionRef;
+        std::vector<std::uint32_t> interRef;
+        std::vector<std::uint32_t> diffRef;
+        std::set_union(left.begin(), left.end(), right.begin(), right.end(),
+                       std::back_inserter(unionRef));
+        std::set_intersection(left.begin(), left.end(), right.begin(), right.end(),
+                              std::back_inserter(interRef));
+        std::set_difference(left.begin(), left.end(), right.begin(), right.end(),
+                            std::back_inserter(diffRef));
+
+        // Every pairing of plain and run-optimized operands hits a different kernel
+        for (bool optimizeLeft : {false, true}) {
+            for (bool optimizeRight : {false, true}) {
+                const core::RoaringBitmap a = fromSet(left, optimizeLeft);
+                const core::RoaringBitmap b = fromSet(right, optimizeRight);
+                EXPECT_EQ((a | b).toVector(), unionRef);
+                EXPECT_EQ((a & b).toVector(), interRef);
+                EXPECT_EQ((a - b).toVector(), diffRef);
+
+                core::RoaringBitmap inPlace = a;
+                inPlace -= b;
+                inPlace |= b;
+                inPlace &= a;
+                EXPECT_EQ(inPlace, a);
+            }
+        }
+    }
+
+    // Equality ignores representation
+    core::RoaringBitmap runs;
+    runs.addRange(10, 5000);
+    core::RoaringBitmap plain;
+    for (std::uint32_t v = 10; v < 5000; ++v) {
+        plain.add(v);
+    }
+    EXPECT_EQ(runs, plain);
+    plain.remove(11);
+    EXPECT_FALSE(runs == plain);
+}
+
+TEST(RoaringBitmapTest, CompoundOperatorsWorkInPlace) {
+    // Interleaved chunk keys: other has chunks before, between and after ours
+    std::set<std::uint32_t> left = mixedValues(7);
+    std::set<std::uint32_t> right;
+    for (std::uint32_t chunk : {0u, 1u, 5u, 9u, 0xFFFFu}) {
+        for (std::uint32_t v = 0; v < 6000; v += 1 + chunk % 3) {
+            right.insert((chunk << 16) | v);
+        }
+    }
+    for (std::uint32_t chunk : {7u, 8u}) {
+        for (std::uint32_t v = 0; v < 5000; v += 2) {
+            left.insert((chunk << 16) | v);
+        }
+    }
+    for (bool optimize : {false, true}) {
+        const core::RoaringBitmap a = fromSet(left, optimize);
+        const core::RoaringBitmap b = fromSet(right, !optimize);
+        core::RoaringBitmap x = a;
+        EXPECT_EQ(x |= b, a | b);
+        x = a;
+        EXPECT_EQ(x &= b, a & b);
+        x = a;
+        EXPECT_EQ(x -= b, a - b);
+        x = b;
+        EXPECT_EQ(x -= a, b - a);
+    }
+
+    core::RoaringBitmap self = fromSet(left, false);
+    self |= self;
+    self &= self;
+    EXPECT_EQ(self.toVector(), asVector(left));
+    self -= self;
+    EXPECT_TRUE(self.empty());
+
+    // Touching one chunk of a large bitmap must not copy the others
+    core::RoaringBitmap big;
+    for (std::uint32_t v = 0; v < (64u << 16); v += 2) {
+        big.add(v);  // every other value: 64 bitmap chunks of 8 KiB
+    }
+    ASSERT_EQ(big.stats().bitmaps, 64u);
+    core::RoaringBitmap small{41, 43};
+    core::alloc::AllocationScope scope;
+    big |= small;
+    big -= small;
+    EXPECT_LT(scope.allocations(), 10u);
+    EXPECT_FALSE(big.contains(41));
+    EXPECT_TRUE(big.contains(44));
+    EXPECT_EQ(big.size(), 32u << 16);
+}
+
+TEST(RoaringBitmapTest, SerializationRoundTrip) {
+    core::RoaringBitmap original = fromSet(mixedValues(42), true);
+    const core::RoaringBitmap::Stats stats = original.stats();
+    EXPECT_GT(stats.arrays, 0u);
+    EXPECT_GT(stats.bitmaps, 0u);
+    EXPECT_GT(stats.runs, 0u);
+
+    std::stringstream buffer;
+    original.serialize(buffer);
+    EXPECT_EQ(buffer.str().size(), original.serializedBytes());
+    const core::RoaringBitmap copy = core::RoaringBitmap::deserialize(buffer);
+    EXPECT_EQ(copy, original);
+    EXPECT_EQ(copy.toVector(), original.toVector());
+
+    std::stringstream empty;
+    core::RoaringBitmap().serialize(empty);
+    EXPECT_TRUE(core::RoaringBitmap::deserialize(empty).empty());
+
+    // Truncated and corrupted input must throw, never crash
+    const std::string bytes = buffer.str();
+    std::stringstream truncated(bytes.substr(0, bytes.size() - 3));
+    EXPECT_THROW(core::RoaringBitmap::deserialize(truncated), std::runtime_error);
+    std::stringstream badMagic("XBM1" + bytes.substr(4));
+    EXPECT_THROW(core::RoaringBitmap::deserialize(badMagic), std::runtime_error);
+    std::string badKind = bytes;
+    badKind[10] = 7;  // kind byte of the first container
+    std::stringstream badKindStream(badKind);
+    EXPECT_THROW(core::RoaringBitmap::deserialize(badKindStream), std::runtime_error);
+}
+
+TEST(RoaringBitmapTest, IterationAndExtremes) {
+    core::RoaringBitmap bitmap{70000, 5, 1u << 31, 5, 65535};
+    EXPECT_EQ(bitmap.size(), 4u);
+    EXPECT_EQ(bitmap.minimum(), 5u);
+    EXPECT_EQ(bitmap.maximum(), 1u << 31);
+
+    std::vector<std::uint32_t> seen;
+    bitmap.forEach([&seen](std::uint32_t v) { seen.push_back(v); });
+    EXPECT_EQ(seen, (std::vector<std::uint32_t>{5, 65535, 70000, 1u << 31}));
+
+    // Bitmap containers report their extremes too
+    core::RoaringBitmap dense;
+    for (std::uint32_t v = 300; v < 60000; v += 3) {
+        dense.add(v);
+    }
+    EXPECT_EQ(dense.stats().bitmaps, 1u);
+    EXPECT_EQ(dense.minimum(), 300u);
+    EXPECT_EQ(dense.maximum(), 59997u);
+
+    bitmap.clear();
+    EXPECT_TRUE(bitmap.empty());
+    EXPECT_THROW(bitmap.minimum(), std::out_of_range);
+    EXPECT_THROW(bitmap.maximum(), std::out_of_range);
+}
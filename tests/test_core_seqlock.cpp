@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+#include "core/seqlock.hpp"
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace {
+
+struct Quad {
+    std::uint64_t a = 0;
+    std::uint64_t b = 0;
+    std::uint64_t c = 0;
+    std::uint32_t d = 0;
+};
+
+// Trivially copyable but not default-constructible
+struct Reading {
+    explicit Reading(std::int32_t v) : value(v) {}
+    std::int32_t value;
+};
+
+}  // namespace
+
+TEST(SeqLockTest, StoreThenLoad) {
+    core::SeqLock<Quad> lock(Quad{1, 2, 3, 4});
+    EXPECT_EQ(lock.load().c, 3u);
+    EXPECT_EQ(lock.version(), 0u);
+
+    lock.store(Quad{5, 6, 7, 8});
+    auto value = lock.load();
+    EXPECT_EQ(value.a, 5u);
+    EXPECT_EQ(value.d, 8u);
+    EXPECT_EQ(lock.version(), 1u);
+
+    lock.update([](Quad& q) { q.b += 10; });
+    EXPECT_EQ(lock.load().b, 16u);
+    EXPECT_EQ(lock.version(), 2u);
+}
+
+TEST(SeqLockTest, ValueWithoutDefaultConstructor) {
+    static_assert(!std::is_default_constructible_v<core::SeqLock<Reading>>);
+    core::SeqLock<Reading> lock(Reading{7});
+    EXPECT_EQ(lock.load().value, 7);
+    lock.update([](Reading& r) { r.value *= 3; });
+    Reading out{0};
+    ASSERT_TRUE(lock.tryLoad(out));
+    EXPECT_EQ(out.value, 21);
+}
+
+TEST(SeqLockTest, ThrowingUpdateLeavesLockUsable) {
+    core::SeqLock<Quad> lock(Quad{1, 2, 3, 4});
+    const auto failing = [](Quad& q) {
+        q.a = 99;
+        throw std::runtime_error("mutate failed");
+    };
+    EXPECT_THROW(lock.update(failing), std::runtime_error);
+    EXPECT_EQ(lock.load().a, 1u);
+    EXPECT_EQ(lock.version(), 0u);
+
+    // Readers and later writers must not spin on a stuck odd sequence
+    Quad out{};
+    EXPECT_TRUE(lock.tryLoad(out));
+    lock.store(Quad{5, 6, 7, 8});
+    EXPECT_EQ(lock.load().d, 8u);
+    EXPECT_EQ(lock.version(), 1u);
+}
+
+TEST(SeqLockTest, ReadersNeverSeeTornValues) {
+    core::SeqLock<Quad> lock;
+    std::atomic<bool> stop{false};
+    std::atomic<int> torn{0};
+
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 3; ++r) {
+        readers.emplace_back([&]() {
+            while (!stop.load(std::memory_order_relaxed)) {
+                auto q = lock.load();
+                if (q.a != q.b || q.b != q.c || q.d != static_cast<std::uint32_t>(q.a)) {
+                    torn.fetch_add(1);
+                }
+            }
+        });
+    }
+
+    std::vector<std::thread> writers;
+    for (int w = 0; w < 2; ++w) {
+        writers.emplace_back([&]() {
+            for (std::uint64_t i = 1; i <= 20000; ++i) {
+                lock.update([](Quad& q) {
+                    ++q.a;
+                    q.b = q.a;
+                    q.c = q.a;
+                    q.d = static_cast<std::uint32_t>(q.a);
+                });
+            }
+        });
+    }
+    for (auto& writer : writers) {
+        writer.join();
+    }
+    stop = true;
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    EXPECT_EQ(torn.load(), 0);
+    EXPECT_EQ(lock.load().a, 40000u);
+    EXPECT_EQ(lock.version(), 40000u);
+}
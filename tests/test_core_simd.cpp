@@ -0,0 +1,150 @@
+#include <gtest/gtest.h>
+#include "core/simd.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+using core::simd::Level;
+
+// Runs @p check once per level this machine supports, then restores dispatch
+template<typename Check>
+void forEachLevel(Check check) {
+    const Level original = core::simd::activeLevel();
+    for (Level level : {Level::kScalar, Level::kSSE2, Level::kAVX2, Level::kAVX512}) {
+        if (level > core::simd::detectedLevel()) {
+            break;
+        }
+        ASSERT_EQ(core::simd::setLevel(level), level);
+        SCOPED_TRACE(core::simd::levelName(level));
+        check();
+    }
+    core::simd::setLevel(original);
+}
+
+// Lengths around every vector width and unroll factor, plus a large one
+const std::vector<std::size_t> kLengths = [] {
+    std::vector<std::size_t> lengths;
+    for (std::size_t n = 0; n <= 300; ++n) {
+        lengths.push_back(n);
+    }
+    lengths.push_back(100'003);
+    return lengths;
+}();
+
+// Dynamic initialization of this file may run before simd.cpp's own
+const std::size_t kCountAtStaticInit = [] {
+    const std::int32_t values[] = {7, 1, 7, 7};
+    return core::simd::count(values, 7);
+}();
+
+}  // namespace
+
+TEST(SimdTest, DispatchFollowsDetectedLevel) {
+    const Level original = core::simd::activeLevel();
+    EXPECT_EQ(original, core::simd::detectedLevel());
+    // Asking for more than the CPU has clamps to what it has
+    EXPECT_EQ(core::simd::setLevel(Level::kAVX512), core::simd::detectedLevel());
+    EXPECT_EQ(core::simd::setLevel(Level::kScalar), Level::kScalar);
+    EXPECT_EQ(core::simd::activeLevel(), Level::kScalar);
+    EXPECT_STREQ(core::simd::levelName(Level::kAVX2), "AVX2");
+    core::simd::setLevel(original);
+}
+
+TEST(SimdTest, UsableFromStaticInitializers) {
+    EXPECT_EQ(kCountAtStaticInit, 3u);
+}
+
+TEST(SimdTest, FindAndCountMatchStd) {
+    std::mt19937 rng(3);
+    std::vector<std::int32_t> storage(100'010);
+    for (auto& v : storage) {
+        v = static_cast<std::int32_t>(rng() % 64);
+    }
+    forEachLevel([&] {
+        for (std::size_t n : kLengths) {
+            // Offset by one element so loads are misaligned
+            const std::span<const std::int32_t> values(storage.data() + 1, n);
+            for (std::int32_t needle : {0, 17, 63, -1}) {
+                const auto expected = static_cast<std::size_t>(
+                    std::find(values.begin(), values.end(), needle) - values.begin());
+                ASSERT_EQ(core::simd::find(values, needle), expected) << n;
+                const auto hits = std::count(values.begin(), values.end(), needle);
+                ASSERT_EQ(core::simd::count(values, needle), static_cast<std::size_t>(hits)) << n;
+            }
+        }
+    });
+}
+
+TEST(SimdTest, MinMaxAndSumMatchStd) {
+    std::mt19937 rng(5);
+    std::vector<std::int32_t> storage(100'010);
+    for (auto& v : storage) {
+        v = static_cast<std::int32_t>(rng());  // full range: sums overflow int32
+    }
+    forEachLevel([&] {
+        for (std::size_t n : kLengths) {
+            const std::span<const std::int32_t> values(storage.data() + 3, n);
+            ASSERT_EQ(core::simd::sum(values),
+                      std::accumulate(values.begin(), values.end(), std::int64_t{0}))
+                << n;
+            if (n == 0) {
+                EXPECT_THROW(core::simd::minMax(values), std::invalid_argument);
+                continue;
+            }
+            const auto [low, high] = std::minmax_element(values.begin(), values.end());
+            const core::simd::MinMax result = core::simd::minMax(values);
+            ASSERT_EQ(result.min, *low) << n;
+            ASSERT_EQ(result.max, *high) << n;
+        }
+    });
+}
+
+TEST(SimdTest, FloatSumIsCloseToExact) {
+    std::mt19937 rng(9);
+    std::uniform_real_distribution<float> value(-1.0f, 1.0f);
+    std::vector<float> storage(100'010);
+    for (auto& v : storage) {
+        v = value(rng);
+    }
+    forEachLevel([&] {
+        for (std::size_t n : kLengths) {
+            const std::span<const float> values(storage.data() + 1, n);
+            double exact = 0.0;
+            for (float v : values) {
+                exact += v;
+            }
+            // Lane order only changes rounding
+            ASSERT_NEAR(core::simd::sum(values), exact, 1e-5 * static_cast<double>(n) + 1e-6)
+                << n;
+        }
+    });
+}
+
+TEST(SimdTest, ByteScansMatchMemchr) {
+    std::mt19937 rng(11);
+    std::vector<std::uint8_t> storage(100'100);
+    for (auto& b : storage) {
+        b = static_cast<std::uint8_t>(rng() % 200);
+    }
+    forEachLevel([&] {
+        for (std::size_t n : kLengths) {
+            const std::uint8_t* data = storage.data() + 7;
+            for (std::uint8_t needle : {0, 42, 199, 255}) {
+                ASSERT_EQ(core::simd::findByte(data, n, needle), std::memchr(data, needle, n)) << n;
+                ASSERT_EQ(core::simd::countByte(data, n, needle),
+                          static_cast<std::size_t>(std::count(data, data + n, needle)))
+                    << n;
+            }
+        }
+        // Long runs of matches exercise the byte-counter flush
+        const std::vector<std::uint8_t> ones(70'000, 1);
+        ASSERT_EQ(core::simd::countByte(ones.data(), ones.size(), 1), ones.size());
+        ASSERT_EQ(core::simd::findByte(ones.data(), ones.size(), 1), ones.data());
+    });
+}
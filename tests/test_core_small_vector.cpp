@@ -0,0 +1,131 @@
+#include <gtest/gtest.h>
+#include "core/alloc_tracker.hpp"
+#include "core/small_vector.hpp"
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+/// Counts live instances to catch leaks and double destruction.
+struct Tracked {
+    static inline int live = 0;
+    int value;
+
+    explicit Tracked(int v = 0) : value(v) { ++live; }
+    Tracked(const Tracked& other) : value(other.value) { ++live; }
+    Tracked(Tracked&& other) noexcept : value(other.value) { ++live; }
+    Tracked& operator=(const Tracked&) = default;
+    Tracked& operator=(Tracked&&) noexcept = default;
+    ~Tracked() { --live; }
+
+    bool operator==(const Tracked& other) const { return value == other.value; }
+};
+
+}  // namespace
+
+TEST(SmallVectorTest, StaysInlineUntilCapacityExceeded) {
+    core::alloc::AllocationScope scope;
+    core::SmallVector<int, 4> values{1, 2, 3};
+    values.push_back(4);
+    EXPECT_TRUE(values.isInline());
+    EXPECT_EQ(values.capacity(), 4u);
+    EXPECT_EQ(scope.allocations(), 0u);
+
+    values.push_back(5);
+    EXPECT_FALSE(values.isInline());
+    EXPECT_EQ(scope.allocations(), 1u);
+    EXPECT_EQ((std::vector<int>(values.begin(), values.end())),
+              (std::vector<int>{1, 2, 3, 4, 5}));
+}
+
+TEST(SmallVectorTest, InsertEraseAndResize) {
+    core::SmallVector<std::string, 2> words{"b", "d"};
+    words.insert(words.begin(), "a");
+    words.insert(words.begin() + 2, "c");
+    words.insert(words.end(), {"e", "f"});
+    EXPECT_EQ(words.size(), 6u);
+    EXPECT_EQ(words[2], "c");
+    EXPECT_EQ(words.back(), "f");
+
+    words.erase(words.begin() + 1, words.begin() + 3);
+    EXPECT_EQ((std::vector<std::string>(words.begin(), words.end())),
+              (std::vector<std::string>{"a", "d", "e", "f"}));
+
+    words.resize(6, "z");
+    EXPECT_EQ(words[5], "z");
+    words.resize(1);
+    EXPECT_EQ(words.size(), 1u);
+    EXPECT_THROW(words.at(1), std::out_of_range);
+}
+
+TEST(SmallVectorTest, PushBackOfOwnElementSurvivesGrowth) {
+    core::SmallVector<std::string, 2> words{"first", "second"};
+    words.push_back(words[0]);  // forces growth while referring to an element
+    EXPECT_EQ(words[2], "first");
+
+    words.insert(words.begin(), words.back());
+    EXPECT_EQ(words[0], "first");
+}
+
+TEST(SmallVectorTest, MoveStealsHeapBufferAndMovesInlineElements) {
+    core::SmallVector<std::unique_ptr<int>, 2> small;
+    small.push_back(std::make_unique<int>(1));
+    auto movedSmall = std::move(small);
+    EXPECT_TRUE(small.empty());
+    EXPECT_EQ(*movedSmall[0], 1);
+
+    core::SmallVector<int, 2> big{1, 2, 3, 4};
+    const int* buffer = big.data();
+    core::SmallVector<int, 2> movedBig;
+    movedBig = std::move(big);
+    EXPECT_EQ(movedBig.data(), buffer);
+    EXPECT_TRUE(big.isInline());
+    EXPECT_TRUE(big.empty());
+}
+
+TEST(SmallVectorTest, ElementLifetimesAreBalanced) {
+    {
+        core::SmallVector<Tracked, 3> values;
+        for (int i = 0; i < 10; ++i) {
+            values.emplace_back(i);
+        }
+        auto copy = values;
+        EXPECT_EQ(copy, values);
+
+        values.erase(values.begin() + 2);
+        values.insert(values.begin(), 3, Tracked(7));
+        values.resize(2);
+        values.shrink_to_fit();
+        EXPECT_TRUE(values.isInline());
+        EXPECT_EQ(values[1].value, 7);
+
+        core::SmallVector<Tracked, 3> other{Tracked(1)};
+        swap(values, other);
+        EXPECT_EQ(values.size(), 1u);
+        EXPECT_EQ(other.size(), 2u);
+    }
+    EXPECT_EQ(Tracked::live, 0);
+}
+
+TEST(SmallVectorTest, OverAlignedElements) {
+    struct alignas(64) Line {
+        int value;
+    };
+    core::SmallVector<Line, 1> lines;
+    for (int i = 0; i < 5; ++i) {
+        lines.push_back(Line{i});
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(&lines.back()) % 64, 0u);
+    }
+    EXPECT_EQ(lines[4].value, 4);
+}
+
+TEST(SmallVectorTest, Comparison) {
+    core::SmallVector<int, 4> a{1, 2, 3};
+    core::SmallVector<int, 4> b{1, 2, 4};
+    EXPECT_TRUE(a < b);
+    EXPECT_FALSE(a == b);
+    b[2] = 3;
+    EXPECT_TRUE(a == b);
+}
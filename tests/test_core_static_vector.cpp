@@ -0,0 +1,153 @@
+#include <gtest/gtest.h>
+#include "core/alloc_tracker.hpp"
+#include "core/static_vector.hpp"
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+namespace {
+
+/// No default constructor, so a plain T[N] could not hold it.
+struct Point {
+    int x;
+    int y;
+    constexpr Point(int px, int py) : x(px), y(py) {}
+    constexpr bool operator==(const Point&) const = default;
+};
+
+constexpr int sumOfSquares(int count) {
+    core::StaticVector<int, 16> values;
+    for (int i = 1; i <= count; ++i) {
+        values.push_back(i * i);
+    }
+    values.erase(values.begin());  // drop 1
+    int total = 0;
+    for (int v : values) {
+        total += v;
+    }
+    return total;
+}
+
+constexpr core::StaticString<32> makeKey(std::string_view section, std::string_view name) {
+    core::StaticString<32> key(section);
+    key += '.';
+    key += name;
+    return key;
+}
+
+}  // namespace
+
+// Compile-time checks: these fail the build, not the test run
+static_assert(sumOfSquares(4) == 4 + 9 + 16);
+static_assert(makeKey("server", "port") == "server.port");
+static_assert(std::is_trivially_copyable_v<core::StaticVector<int, 8>>);
+static_assert(std::is_trivially_destructible_v<core::StaticString<8>>);
+
+constexpr core::StaticVector<int, 4> kPrimes{2, 3, 5};
+static_assert(kPrimes.size() == 3 && kPrimes.back() == 5);
+
+constexpr bool buildsPoints() {
+    core::StaticVector<Point, 3> points;
+    points.emplace_back(1, 2);
+    points.insert(points.begin(), Point(0, 0));
+    return points.size() == 2 && points[1] == Point(1, 2);
+}
+static_assert(buildsPoints());
+
+TEST(StaticVectorTest, HoldsNonDefaultConstructibleTypes) {
+    core::StaticVector<Point, 4> points{Point(1, 1), Point(2, 2)};
+    points.emplace(points.begin() + 1, 9, 9);
+    EXPECT_EQ(points.size(), 3u);
+    EXPECT_EQ(points[1], Point(9, 9));
+    EXPECT_EQ(points.back(), Point(2, 2));
+}
+
+TEST(StaticVectorTest, CapacityIsEnforced) {
+    core::StaticVector<std::string, 2> names{"a", "b"};
+    EXPECT_TRUE(names.full());
+    EXPECT_EQ(names.tryPushBack("c"), nullptr);
+    EXPECT_THROW(names.push_back("c"), std::length_error);
+    EXPECT_THROW(names.resize(3), std::length_error);
+    EXPECT_THROW(names.at(2), std::out_of_range);
+
+    names.pop_back();
+    ASSERT_NE(names.tryPushBack("c"), nullptr);
+    EXPECT_EQ(names.back(), "c");
+}
+
+TEST(StaticVectorTest, RangeInsertOverflowLeavesContentsUnchanged) {
+    core::StaticVector<int, 5> values{1, 2, 3};
+    const std::vector<int> fits{8, 9};
+    values.insert(values.begin() + 1, fits.begin(), fits.end());
+    EXPECT_EQ(values, (core::StaticVector<int, 5>{1, 8, 9, 2, 3}));
+
+    values.pop_back();
+    values.pop_back();
+    const std::vector<int> tooMany{7, 7, 7};
+    EXPECT_THROW(values.insert(values.begin(), tooMany.begin(), tooMany.end()),
+                 std::length_error);
+    EXPECT_EQ(values, (core::StaticVector<int, 5>{1, 8, 9}));
+
+    // Input iterators can't be measured up front; the partial append is undone
+    std::istringstream input("4 5 6");
+    EXPECT_THROW(values.insert(values.begin(), std::istream_iterator<int>(input),
+                               std::istream_iterator<int>()),
+                 std::length_error);
+    EXPECT_EQ(values, (core::StaticVector<int, 5>{1, 8, 9}));
+}
+
+TEST(StaticVectorTest, NeverAllocatesForElementsAndBalancesLifetimes) {
+    auto counter = std::make_shared<int>(0);
+    {
+        core::alloc::AllocationScope scope;
+        core::StaticVector<std::shared_ptr<int>, 8> owners(5, counter);
+        auto copy = owners;
+        auto moved = std::move(copy);
+        moved.erase(moved.begin(), moved.begin() + 2);
+        owners.swap(moved);
+        EXPECT_EQ(owners.size(), 3u);
+        EXPECT_EQ(moved.size(), 5u);
+        EXPECT_EQ(counter.use_count(), 9);
+        EXPECT_EQ(scope.allocations(), 0u);
+    }
+    EXPECT_EQ(counter.use_count(), 1);
+}
+
+TEST(StaticVectorTest, Comparison) {
+    core::StaticVector<int, 4> a{1, 2};
+    core::StaticVector<int, 4> b{1, 3};
+    EXPECT_TRUE(a < b);
+    EXPECT_NE(a, b);
+}
+
+TEST(StaticStringTest, AppendsAndTerminates) {
+    core::alloc::AllocationScope scope;
+    core::StaticString<16> text("log");
+    text += ':';
+    text.append(" ready");
+    EXPECT_EQ(text, "log: ready");
+    EXPECT_EQ(std::string_view(text.c_str()), "log: ready");
+    EXPECT_TRUE(text.starts_with("log"));
+    EXPECT_EQ(text.find("ready"), 5u);
+
+    text.truncate(3);
+    EXPECT_EQ(text.size(), 3u);
+    EXPECT_EQ(text.c_str()[3], '\0');
+    EXPECT_EQ(scope.allocations(), 0u);
+
+    EXPECT_THROW(text.append("this does not fit in 16"), std::length_error);
+    EXPECT_EQ(text, "log");
+}
+
+TEST(StaticStringTest, HashesLikeStringView) {
+    std::unordered_set<core::StaticString<8>> keys{"alpha", "beta"};
+    EXPECT_EQ(keys.count("beta"), 1u);
+    EXPECT_EQ(std::hash<core::StaticString<8>>{}("alpha"),
+              std::hash<std::string_view>{}("alpha"));
+}
@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+#include "core/swiss_map.hpp"
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+/// Sends every key to the same bucket so probing and tombstones get exercised.
+struct CollidingHash {
+    std::size_t operator()(int) const noexcept { return 42; }
+};
+
+}  // namespace
+
+TEST(SwissMapTest, BasicOperations) {
+    core::SwissMap<int, std::string> employees;
+    EXPECT_TRUE(employees.empty());
+    EXPECT_EQ(employees.find(101), employees.end());
+
+    employees[101] = "John Doe";
+    EXPECT_TRUE(employees.try_emplace(102, "Jane Smith").second);
+    EXPECT_FALSE(employees.try_emplace(102, "Someone Else").second);
+    EXPECT_EQ(employees.at(102), "Jane Smith");
+    EXPECT_EQ(employees.size(), 2u);
+    EXPECT_THROW(employees.at(103), std::out_of_range);
+
+    employees.insert_or_assign(101, "John Q. Doe");
+    EXPECT_EQ(employees.find(101)->second, "John Q. Doe");
+    EXPECT_EQ(employees.erase(101), 1u);
+    EXPECT_EQ(employees.erase(101), 0u);
+    EXPECT_FALSE(employees.contains(101));
+}
+
+TEST(SwissMapTest, MatchesUnorderedMapUnderRandomOperations) {
+    std::mt19937 rng(11);
+    std::unordered_map<int, int> reference;
+    core::SwissMap<int, int> map;
+    for (int step = 0; step < 200000; ++step) {
+        const int key = static_cast<int>(rng() % 5000);
+        switch (rng() % 3) {
+            case 0:
+                reference[key] = step;
+                map[key] = step;
+                break;
+            case 1:
+                ASSERT_EQ(map.erase(key), reference.erase(key));
+                break;
+            default:
+                ASSERT_EQ(map.contains(key), reference.count(key) == 1);
+                break;
+        }
+    }
+    ASSERT_EQ(map.size(), reference.size());
+    std::size_t visited = 0;
+    for (const auto& [key, value] : map) {
+        ASSERT_EQ(reference.at(key), value);
+        ++visited;
+    }
+    EXPECT_EQ(visited, reference.size());
+    EXPECT_LE(map.load_factor(), (core::SwissMap<int, int>::max_load_factor()));
+}
+
+TEST(SwissMapTest, FullCollisionsProbeAndReuseSlots) {
+    core::SwissMap<int, int, CollidingHash, std::equal_to<int>> map;
+    for (int i = 0; i < 100; ++i) {
+        map[i] = i;
+    }
+    for (int i = 0; i < 100; i += 2) {
+        map.erase(i);
+    }
+    for (int i = 1; i < 100; i += 2) {
+        ASSERT_EQ(map.at(i), i);
+    }
+    for (int i = 0; i < 1000; ++i) {  // churn: tombstones must not exhaust the table
+        map[1000 + i] = i;
+        map.erase(1000 + i);
+    }
+    EXPECT_EQ(map.size(), 50u);
+    EXPECT_FALSE(map.contains(0));
+}
+
+TEST(SwissMapTest, HeterogeneousStringLookup) {
+    core::SwissMap<std::string, int> counts{{"apple", 1}, {"pear", 2}};
+    EXPECT_EQ(counts.find(std::string_view("pear"))->second, 2);
+    EXPECT_TRUE(counts.contains("apple"));
+    EXPECT_EQ(counts.count(std::string_view("plum")), 0u);
+    EXPECT_EQ(counts.erase(std::string_view("apple")), 1u);
+    EXPECT_EQ(counts.size(), 1u);
+}
+
+TEST(SwissMapTest, CopyMoveAndIteratorErase) {
+    core::SwissMap<int, std::unique_ptr<int>> owners;
+    for (int i = 0; i < 40; ++i) {
+        owners.try_emplace(i, std::make_unique<int>(i));
+    }
+    auto moved = std::move(owners);
+    EXPECT_TRUE(owners.empty());
+    EXPECT_EQ(*moved.at(39), 39);
+
+    for (auto it = moved.begin(); it != moved.end();) {
+        it = (*it->second % 2 == 0) ? moved.erase(it) : std::next(it);
+    }
+    EXPECT_EQ(moved.size(), 20u);
+
+    core::SwissMap<int, std::string> names{{1, "one"}, {2, "two"}};
+    auto copy = names;
+    EXPECT_EQ(copy, names);
+    copy[3] = "three";
+    EXPECT_FALSE(copy == names);
+    copy.clear();
+    EXPECT_TRUE(copy.empty());
+    copy.reserve(1000);
+    EXPECT_GE(copy.capacity(), 1000u);
+}
@@ -0,0 +1,47 @@
+#include <gtest/gtest.h>
+#include "core/thread_pool.hpp"
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+class ThreadPoolTest : public ::testing::Test {
+protected:
+    core::ThreadPool pool{4};
+};
+
+TEST_F(ThreadPoolTest, SubmitReturnsResult) {
+    auto future = pool.submit([](int a, int b) { return a * b; }, 6, 7);
+    EXPECT_EQ(future.get(), 42);
+    EXPECT_EQ(pool.size(), 4u);
+}
+
+TEST_F(ThreadPoolTest, SubmitPropagatesExceptions) {
+    auto future = pool.submit([]() -> int { throw std::runtime_error("boom"); });
+    EXPECT_THROW(future.get(), std::runtime_error);
+}
+
+TEST_F(ThreadPoolTest, ParallelForVisitsEveryIndexOnce) {
+    std::vector<std::atomic<int>> hits(1000);
+    pool.parallelFor(hits.size(), [&](std::size_t i) { hits[i].fetch_add(1); });
+    for (const auto& hit : hits) {
+        EXPECT_EQ(hit.load(), 1);
+    }
+}
+
+TEST_F(ThreadPoolTest, ParallelForRethrowsFirstException) {
+    EXPECT_THROW(pool.parallelFor(100,
+                                  [](std::size_t i) {
+                                      if (i == 37) {
+                                          throw std::runtime_error("index 37");
+                                      }
+                                  }),
+                 std::runtime_error);
+}
+
+TEST_F(ThreadPoolTest, NestedParallelForDoesNotDeadlock) {
+    std::atomic<int> total{0};
+    pool.parallelFor(8, [&](std::size_t) {
+        pool.parallelFor(8, [&](std::size_t) { total.fetch_add(1); });
+    });
+    EXPECT_EQ(total.load(), 64);
+}
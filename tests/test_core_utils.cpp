@@ -122,3 +122,12 @@ TEST_F(CoreUtilsTest, LoggerLevels) {
     // Reset to info level for other tests
     logger.setLevel(core::LogLevel::Info);
 }
+
+TEST_F(CoreUtilsTest, ParseLogLevel) {
+    EXPECT_EQ(core::parseLogLevel("debug"), core::LogLevel::Debug);
+    EXPECT_EQ(core::parseLogLevel("warn"), core::LogLevel::Warning);
+    EXPECT_EQ(core::parseLogLevel("warning"), core::LogLevel::Warning);
+    EXPECT_EQ(core::parseLogLevel("error"), core::LogLevel::Error);
+    EXPECT_FALSE(core::parseLogLevel("ERROR").has_value());
+    EXPECT_FALSE(core::parseLogLevel("").has_value());
+}
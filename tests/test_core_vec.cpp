@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+#include "core/alloc_tracker.hpp"
+#include "core/vec.hpp"
+#include <cmath>
+#include <numeric>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+TEST(VecTest, ExpressionsMatchElementwiseLoop) {
+    const std::size_t n = 1003;  // not a multiple of any vector width
+    core::Vec<double> b(n), c(n), d(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        b[i] = 0.5 * static_cast<double>(i);
+        c[i] = 3.0 - static_cast<double>(i % 7);
+        d[i] = static_cast<double>(i * i % 11) + 1.0;
+    }
+    core::Vec<double> a = b * c + d;
+    core::Vec<double> e = (b - 2.0) / d * -c + core::sqrt(d) - core::abs(c) + core::max(b, 4.0);
+    for (std::size_t i = 0; i < n; ++i) {
+        ASSERT_DOUBLE_EQ(a[i], b[i] * c[i] + d[i]) << i;
+        const double expected = (b[i] - 2.0) / d[i] * -c[i] + std::sqrt(d[i]) -
+                                std::abs(c[i]) + std::max(b[i], 4.0);
+        ASSERT_DOUBLE_EQ(e[i], expected) << i;
+    }
+    core::Vec<double> f = core::min(2.0 * b, c);
+    EXPECT_DOUBLE_EQ(f[10], std::min(10.0, c[10]));
+}
+
+TEST(VecTest, ExpressionsAreLazyAndAllocationFree) {
+    core::Vec<float> a(4096), b(4096, 1.5f), c(4096, 2.0f), d(4096, -1.0f);
+    auto expression = b * c + d;
+    static_assert(!std::is_same_v<decltype(expression), core::Vec<float>>);
+    static_assert(std::is_same_v<decltype(expression)::value_type, float>);
+    // Scalars take the vector's element type: float math stays float
+    static_assert(std::is_same_v<decltype(2.0 * b)::value_type, float>);
+
+    core::alloc::AllocationScope scope;
+    a = expression;
+    a = a * 2.0f + b * c * d - a;  // *this as an operand is fine at equal size
+    a += b;
+    a *= 0.5;
+    EXPECT_EQ(scope.allocations(), 0u);
+    EXPECT_FLOAT_EQ(a[0], ((1.5f * 2.0f - 1.0f) + (1.5f * 2.0f * -1.0f) + 1.5f) * 0.5f);
+}
+
+TEST(VecTest, SizeMismatchThrows) {
+    core::Vec<int> a(3, 1), b(4, 2);
+    EXPECT_THROW(a + b, std::invalid_argument);
+    EXPECT_THROW(a += b, std::invalid_argument);
+    EXPECT_THROW(core::dot(a, b), std::invalid_argument);
+    // An empty Vec is a real operand, not a broadcast scalar
+    const core::Vec<double> empty, ten(10, 1.0);
+    EXPECT_THROW(empty + ten, std::invalid_argument);
+    EXPECT_THROW(ten * (empty - 1.0), std::invalid_argument);
+    EXPECT_EQ((empty + empty * 2.0).size(), 0u);
+    // Assigning resizes the target
+    a = b * 3;
+    EXPECT_EQ(a.size(), 4u);
+    EXPECT_EQ(a, (core::Vec<int>{6, 6, 6, 6}));
+}
+
+TEST(VecTest, ReductionsMatchStd) {
+    std::vector<double> x(10'001), y(10'001);
+    for (std::size_t i = 0; i < x.size(); ++i) {
+        x[i] = std::sin(static_cast<double>(i));
+        y[i] = std::cos(static_cast<double>(i));
+    }
+    const core::Vec<double> vx{std::span<const double>(x)};
+    const core::Vec<double> vy{std::span<const double>(y)};
+    EXPECT_NEAR(core::sum(vx), std::accumulate(x.begin(), x.end(), 0.0), 1e-9);
+    EXPECT_NEAR(core::dot(vx, vy), std::inner_product(x.begin(), x.end(), y.begin(), 0.0), 1e-9);
+    EXPECT_NEAR(core::sum(vx * vx + vy * vy), 10'001.0, 1e-8);
+    EXPECT_EQ(core::sum(core::Vec<int>{1, 2, 3}), 6);
+    EXPECT_EQ(core::sum(core::Vec<int>()), 0);
+}
+
+TEST(VecTest, CopyMoveAndAccess) {
+    core::Vec<int> a{1, 2, 3};
+    core::Vec<int> b = a;
+    b[0] = 10;
+    EXPECT_EQ(a[0], 1);
+    core::Vec<int> c = std::move(b);
+    EXPECT_TRUE(b.empty());
+    EXPECT_EQ(c.size(), 3u);
+    EXPECT_EQ(std::accumulate(c.begin(), c.end(), 0), 15);
+    c = 7;
+    EXPECT_EQ(c, (core::Vec<int>{7, 7, 7}));
+    EXPECT_EQ(c.span().size(), 3u);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(c.data()) % 64, 0u);
+}